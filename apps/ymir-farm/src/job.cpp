@@ -0,0 +1,172 @@
+#include "job.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <set>
+#include <string_view>
+
+namespace fs = std::filesystem;
+
+static std::string_view Trim(std::string_view str) {
+    const auto first = str.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    const auto last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+}
+
+static std::optional<uint64> ParseUint(std::string_view str) {
+    uint64 value = 0;
+    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec != std::errc{} || ptr != str.data() + str.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+static std::optional<bool> ParseBool(std::string_view str) {
+    if (str == "true" || str == "yes" || str == "1") {
+        return true;
+    }
+    if (str == "false" || str == "no" || str == "0") {
+        return false;
+    }
+    return std::nullopt;
+}
+
+// Applies a key = value pair to the job.
+// Returns false if the key is unknown or the value is invalid.
+static bool ApplyKey(Job &job, std::string_view key, std::string_view value, const fs::path &baseDir) {
+    if (key == "ipl") {
+        job.iplPath = baseDir / value;
+    } else if (key == "disc") {
+        job.discPath = baseDir / value;
+    } else if (key == "movie") {
+        job.moviePath = baseDir / value;
+    } else if (key == "frames") {
+        const auto frames = ParseUint(value);
+        if (!frames) {
+            return false;
+        }
+        job.frames = *frames;
+    } else if (key == "video") {
+        if (value == "ntsc") {
+            job.videoStandard = ymir::core::config::sys::VideoStandard::NTSC;
+        } else if (value == "pal") {
+            job.videoStandard = ymir::core::config::sys::VideoStandard::PAL;
+        } else {
+            return false;
+        }
+    } else if (key == "hashes") {
+        const auto enable = ParseBool(value);
+        if (!enable) {
+            return false;
+        }
+        job.frameHashes = *enable;
+    } else if (key == "audio") {
+        const auto enable = ParseBool(value);
+        if (!enable) {
+            return false;
+        }
+        job.audioHash = *enable;
+    } else if (key == "screenshots") {
+        job.screenshots.clear();
+        while (!value.empty()) {
+            const auto sep = value.find(',');
+            const auto frame = ParseUint(Trim(value.substr(0, sep)));
+            if (!frame) {
+                return false;
+            }
+            job.screenshots.push_back(*frame);
+            value = sep == std::string_view::npos ? std::string_view{} : value.substr(sep + 1);
+        }
+        std::sort(job.screenshots.begin(), job.screenshots.end());
+        job.screenshots.erase(std::unique(job.screenshots.begin(), job.screenshots.end()), job.screenshots.end());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool ValidateJob(const Job &job, std::string &error) {
+    if (job.iplPath.empty()) {
+        error = fmt::format("job {}: missing ipl", job.name);
+        return false;
+    }
+    if (job.frames == 0 && job.moviePath.empty()) {
+        error = fmt::format("job {}: missing or zero frames", job.name);
+        return false;
+    }
+    // Jobs that run for the length of their movie have their screenshots checked once the movie is loaded
+    if (job.frames != 0 && !job.screenshots.empty() && job.screenshots.back() >= job.frames) {
+        error = fmt::format("job {}: screenshot frame {} is past the last frame", job.name, job.screenshots.back());
+        return false;
+    }
+    return true;
+}
+
+std::optional<std::vector<Job>> LoadJobFile(const fs::path &path, std::string &error) {
+    std::ifstream in{path};
+    if (!in) {
+        error = fmt::format("could not open {}", path.string());
+        return std::nullopt;
+    }
+
+    const fs::path baseDir = path.parent_path();
+
+    Job defaults{};
+    std::vector<Job> jobs;
+    std::set<std::string, std::less<>> names;
+
+    std::string line;
+    uint64 lineNum = 0;
+    while (std::getline(in, line)) {
+        ++lineNum;
+        std::string_view view = Trim(line);
+        if (view.empty() || view.starts_with('#')) {
+            continue;
+        }
+
+        if (view.starts_with('[')) {
+            if (!view.ends_with(']')) {
+                error = fmt::format("line {}: malformed section header", lineNum);
+                return std::nullopt;
+            }
+            const std::string_view name = Trim(view.substr(1, view.size() - 2));
+            if (name.empty() || name.find_first_of("/\\") != std::string_view::npos) {
+                error = fmt::format("line {}: invalid job name", lineNum);
+                return std::nullopt;
+            }
+            if (!names.emplace(name).second) {
+                error = fmt::format("line {}: duplicate job name {}", lineNum, name);
+                return std::nullopt;
+            }
+            Job &job = jobs.emplace_back(defaults);
+            job.name = name;
+            continue;
+        }
+
+        const auto sep = view.find('=');
+        if (sep == std::string_view::npos) {
+            error = fmt::format("line {}: expected key = value", lineNum);
+            return std::nullopt;
+        }
+        const std::string_view key = Trim(view.substr(0, sep));
+        const std::string_view value = Trim(view.substr(sep + 1));
+        if (!ApplyKey(jobs.empty() ? defaults : jobs.back(), key, value, baseDir)) {
+            error = fmt::format("line {}: invalid key or value: {} = {}", lineNum, key, value);
+            return std::nullopt;
+        }
+    }
+
+    for (const Job &job : jobs) {
+        if (!ValidateJob(job, error)) {
+            return std::nullopt;
+        }
+    }
+    return jobs;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <ymir/core/configuration_defs.hpp>
+
+#include <ymir/core/types.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+// A single emulation job: boots a Saturn with the given IPL ROM and disc and runs it for a number of frames, producing
+// the requested outputs.
+struct Job {
+    std::string name; // [<name>]
+
+    std::filesystem::path iplPath;   // ipl    = <file>; required
+    std::filesystem::path discPath;  // disc   = <file>; optional, boots without a disc if omitted
+    std::filesystem::path moviePath; // movie  = <file>; optional, replays an input movie from power on
+    uint64 frames = 0;               // frames = <count>; required unless a movie is given, defaults to its length
+
+    // video = ntsc|pal
+    ymir::core::config::sys::VideoStandard videoStandard = ymir::core::config::sys::VideoStandard::NTSC;
+
+    bool frameHashes = false;        // hashes      = true|false; write per-frame video and audio hashes
+    bool audioHash = false;          // audio       = true|false; report a hash of the entire audio output
+    std::vector<uint64> screenshots; // screenshots = <frame>[, <frame>...]; frames to save as PNG images
+};
+
+// Loads jobs from a job file.
+//
+// Job files consist of key = value pairs grouped into [<job name>] sections. Pairs that appear before the first section
+// set defaults for every job that follows. Relative paths are resolved against the job file's directory. Lines starting
+// with # are comments.
+//
+// Returns std::nullopt and sets error to a description of the problem if the file could not be read or is invalid.
+std::optional<std::vector<Job>> LoadJobFile(const std::filesystem::path &path, std::string &error);
@@ -0,0 +1,239 @@
+#include "job_runner.hpp"
+
+#include <ymir/sys/input_movie.hpp>
+#include <ymir/sys/saturn.hpp>
+
+#include <serdes/movie_cereal.hpp>
+
+#include <cereal/archives/portable_binary.hpp>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+using namespace ymir;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// A headless Saturn instance that captures the output of every frame
+struct Instance {
+    std::unique_ptr<Saturn> saturn = std::make_unique<Saturn>();
+    sys::MoviePlayer player{*saturn};
+
+    std::vector<uint32> framebuffer;
+    uint32 width = 0;
+    uint32 height = 0;
+    std::vector<sint16> audio; // Interleaved stereo samples output during the current frame
+
+    Instance(const Job &job, IPLROM &ipl, media::Disc &&disc) {
+        // Use a fixed virtual RTC time and avoid host-dependent disc access timing so that runs are reproducible.
+        // Parallelism comes from running many instances at once, so keep each instance on a single thread.
+        saturn->configuration.rtc.mode = core::config::rtc::Mode::Virtual;
+        saturn->configuration.rtc.virtHardResetStrategy = core::config::rtc::HardResetStrategy::ResetToFixedTime;
+        saturn->configuration.cdblock.readAhead = false;
+        saturn->configuration.video.threadedVDP1 = false;
+        saturn->configuration.video.threadedVDP2 = false;
+        saturn->configuration.video.threadedDeinterlacer = false;
+        saturn->SetVideoStandard(job.videoStandard);
+
+        saturn->VDP.SetRenderCallback(util::MakeClassMemberOptionalCallback<&Instance::FrameComplete>(this));
+        saturn->SCSP.SetSampleCallback(util::MakeClassMemberOptionalCallback<&Instance::OutputSample>(this));
+
+        saturn->LoadIPL(ipl);
+        if (!disc.sessions.empty()) {
+            saturn->LoadDisc(std::move(disc));
+        }
+        saturn->Reset(true);
+    }
+
+    void RunFrame() {
+        audio.clear();
+        player.RunFrame();
+    }
+
+    XXH128Hash VideoHash() const {
+        return CalcHash128(framebuffer.data(), framebuffer.size() * sizeof(uint32), (width << 16u) | height);
+    }
+
+    XXH128Hash AudioHash(uint64 seed = 0) const {
+        return CalcHash128(audio.data(), audio.size() * sizeof(sint16), seed);
+    }
+
+    void FrameComplete(uint32 *fb, uint32 width, uint32 height) {
+        this->width = width;
+        this->height = height;
+        framebuffer.resize(width * height);
+        // Ignore the unused X component
+        std::transform(fb, fb + width * height, framebuffer.begin(), [](uint32 px) { return px & 0xFFFFFF; });
+    }
+
+    void OutputSample(sint16 left, sint16 right) {
+        audio.push_back(left);
+        audio.push_back(right);
+    }
+};
+
+// Loads an input movie written with the serializers in serdes/movie_cereal.hpp
+bool LoadMovie(const fs::path &path, sys::InputMovie &movie, std::string &error) {
+    std::ifstream in{path, std::ios::binary};
+    if (!in) {
+        error = "could not open file";
+        return false;
+    }
+    try {
+        cereal::PortableBinaryInputArchive archive{in};
+        archive(movie);
+    } catch (const std::exception &e) {
+        error = e.what();
+        return false;
+    }
+    return true;
+}
+
+void ConnectPeripheral(peripheral::PeripheralPort &port, peripheral::PeripheralType type) {
+    switch (type) {
+    case peripheral::PeripheralType::None: port.DisconnectPeripherals(); break;
+    case peripheral::PeripheralType::ControlPad: port.ConnectControlPad(); break;
+    case peripheral::PeripheralType::AnalogPad: port.ConnectAnalogPad(); break;
+    case peripheral::PeripheralType::ArcadeRacer: port.ConnectArcadeRacer(); break;
+    case peripheral::PeripheralType::MissionStick: port.ConnectMissionStick(); break;
+    }
+}
+
+// Derives a hash seed from a previous hash in order to chain hashes of consecutive blocks of data
+uint64 ChainSeed(const XXH128Hash &hash) {
+    uint64 seed = 0;
+    for (size_t i = 0; i < sizeof(uint64); ++i) {
+        seed = (seed << 8ull) | hash[i];
+    }
+    return seed;
+}
+
+// Writes XRGB8888 pixels as an opaque RGBA8888 PNG image
+bool WritePNG(const fs::path &path, const std::vector<uint32> &pixels, uint32 width, uint32 height) {
+    std::vector<uint32> rgba(pixels.size());
+    std::transform(pixels.begin(), pixels.end(), rgba.begin(), [](uint32 px) {
+        const uint32 r = (px >> 16u) & 0xFF;
+        const uint32 g = (px >> 8u) & 0xFF;
+        const uint32 b = (px >> 0u) & 0xFF;
+        return (0xFFu << 24u) | (b << 16u) | (g << 8u) | (r << 0u);
+    });
+    return stbi_write_png(path.string().c_str(), width, height, 4, rgba.data(), width * sizeof(uint32)) != 0;
+}
+
+} // namespace
+
+JobResult RunJob(const Job &job, SharedResources &resources, const fs::path &outputDir) {
+    JobResult result{};
+
+    auto ipl = resources.GetIPL(job.iplPath);
+    if (!ipl) {
+        result.error = fmt::format("could not load IPL ROM from {}", job.iplPath);
+        return result;
+    }
+
+    media::Disc disc{};
+    std::string discError{};
+    if (!job.discPath.empty() && !resources.GetDisc(job.discPath, disc, discError)) {
+        if (discError.empty()) {
+            result.error = fmt::format("could not load disc image from {}", job.discPath);
+        } else {
+            result.error = fmt::format("could not load disc image from {}: {}", job.discPath, discError);
+        }
+        return result;
+    }
+
+    sys::InputMovie movie{};
+    uint64 frames = job.frames;
+    if (!job.moviePath.empty()) {
+        std::string movieError{};
+        if (!LoadMovie(job.moviePath, movie, movieError)) {
+            result.error = fmt::format("could not load input movie from {}: {}", job.moviePath, movieError);
+            return result;
+        }
+        if (frames == 0) {
+            frames = movie.frames.size();
+        }
+        if (frames == 0) {
+            result.error = fmt::format("input movie {} is empty", job.moviePath);
+            return result;
+        }
+        if (!job.screenshots.empty() && job.screenshots.back() >= frames) {
+            result.error = fmt::format("screenshot frame {} is past the end of the movie", job.screenshots.back());
+            return result;
+        }
+    }
+
+    const fs::path jobDir = outputDir / job.name;
+    std::error_code error{};
+    fs::create_directories(jobDir, error);
+    if (error) {
+        result.error = fmt::format("could not create output directory {}: {}", jobDir, error.message());
+        return result;
+    }
+
+    std::ofstream hashesOut{};
+    if (job.frameHashes) {
+        hashesOut.open(jobDir / "hashes.txt");
+        if (!hashesOut) {
+            result.error = fmt::format("could not create {}", jobDir / "hashes.txt");
+            return result;
+        }
+    }
+
+    Instance instance{job, *ipl, std::move(disc)};
+    if (!job.moviePath.empty()) {
+        // Playback hard resets the system with the movie's RTC timestamp and replaces every report with the recording
+        ConnectPeripheral(instance.saturn->SMPC.GetPeripheralPort1(), movie.peripheralTypes[0]);
+        ConnectPeripheral(instance.saturn->SMPC.GetPeripheralPort2(), movie.peripheralTypes[1]);
+        if (!instance.player.StartPlayback(std::move(movie))) {
+            result.error = fmt::format("input movie {} was recorded with a different IPL ROM or disc", job.moviePath);
+            return result;
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    auto nextScreenshot = job.screenshots.begin();
+    for (uint64 frame = 0; frame < frames; ++frame) {
+        instance.RunFrame();
+
+        if (job.audioHash) {
+            result.audioHash = instance.AudioHash(ChainSeed(result.audioHash));
+        }
+        if (job.frameHashes) {
+            hashesOut << fmt::format("{} {} {}\n", frame, ToString(instance.VideoHash()),
+                                     ToString(instance.AudioHash()));
+        }
+        if (nextScreenshot != job.screenshots.end() && *nextScreenshot == frame) {
+            const fs::path path = jobDir / fmt::format("frame_{:05d}.png", frame);
+            if (!WritePNG(path, instance.framebuffer, instance.width, instance.height)) {
+                result.error = fmt::format("could not write {}", path);
+                return result;
+            }
+            ++nextScreenshot;
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    if (instance.player.GetMismatchCount() > 0) {
+        result.error = fmt::format("input movie playback desynchronized; {} reports did not match the recording",
+                                   instance.player.GetMismatchCount());
+        return result;
+    }
+
+    result.success = true;
+    result.frames = frames;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.videoHash = instance.VideoHash();
+    return result;
+}
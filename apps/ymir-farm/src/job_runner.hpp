@@ -0,0 +1,26 @@
+#pragma once
+
+#include "job.hpp"
+#include "shared_resources.hpp"
+
+#include <ymir/core/hash.hpp>
+
+#include <filesystem>
+#include <string>
+
+// Outcome of a job
+struct JobResult {
+    bool success = false;
+    std::string error;
+
+    uint64 frames = 0;            // number of frames emulated
+    double seconds = 0.0;         // wall-clock time spent emulating
+    ymir::XXH128Hash videoHash{}; // hash of the last frame
+    ymir::XXH128Hash audioHash{}; // hash of the entire audio output; only computed if requested
+};
+
+// Runs the job on a new Saturn instance and writes its outputs into <outputDir>/<job name>/:
+// - hashes.txt: one line per frame with "<frame> <video hash> <audio hash>", in the same format as the golden files
+//   used by the golden-frame tests
+// - frame_NNNNN.png: screenshots of the requested frames
+JobResult RunJob(const Job &job, SharedResources &resources, const std::filesystem::path &outputDir);
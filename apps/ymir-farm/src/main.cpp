@@ -0,0 +1,158 @@
+#include "job.hpp"
+#include "job_runner.hpp"
+#include "shared_resources.hpp"
+#include "thread_pool.hpp"
+
+#include <cxxopts.hpp>
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char *argv[]) {
+    bool showHelp = false;
+    uint32 numThreads = 0;
+    std::string outputDir{};
+    std::string preload{};
+    std::string jobFile{};
+
+    cxxopts::Options options("ymir-farm", "Ymir batch runner\nVersion " Ymir_VERSION);
+    options.add_options()("h,help", "Display this help text.", cxxopts::value(showHelp)->default_value("false"));
+    options.add_options()("j,threads", "Number of jobs to run in parallel. 0 uses one job per hardware thread.",
+                          cxxopts::value(numThreads)->default_value("0"), "count");
+    options.add_options()("o,output", "Directory where job outputs and the summary are written.",
+                          cxxopts::value(outputDir)->default_value("farm-out"), "path");
+    options.add_options()("p,preload", "Disc image preload mode: none, uncompressed, compressed",
+                          cxxopts::value(preload)->default_value("none"), "mode");
+
+    options.add_options()("jobs", "Job file", cxxopts::value(jobFile));
+
+    options.parse_positional({"jobs"});
+    options.positional_help("<job file>");
+
+    auto printHelp = [&] {
+        fmt::println("{}", options.help());
+        fmt::println("  <job file> lists the jobs to run. See README.md for the file format.");
+        fmt::println("");
+        fmt::println("  Each job writes its outputs into <output>/<job name>/. A summary of all jobs");
+        fmt::println("  is written to <output>/summary.txt once every job has finished.");
+    };
+
+    try {
+        auto result = options.parse(argc, argv);
+
+        // Show help if requested
+        if (showHelp) {
+            printHelp();
+            return 0;
+        }
+
+        // Job file is required
+        if (!result.contains("jobs")) {
+            fmt::println("Missing argument: <job file>");
+            fmt::println("");
+            printHelp();
+            return 1;
+        }
+
+        ymir::media::PreloadMode preloadMode;
+        if (preload == "none") {
+            preloadMode = ymir::media::PreloadMode::None;
+        } else if (preload == "uncompressed") {
+            preloadMode = ymir::media::PreloadMode::Uncompressed;
+        } else if (preload == "compressed") {
+            preloadMode = ymir::media::PreloadMode::Compressed;
+        } else {
+            fmt::println("Invalid preload mode: {}", preload);
+            fmt::println("");
+            printHelp();
+            return 1;
+        }
+
+        std::string error{};
+        const auto jobs = LoadJobFile(jobFile, error);
+        if (!jobs) {
+            fmt::println("Failed to load job file: {}", error);
+            return 1;
+        }
+        if (jobs->empty()) {
+            fmt::println("No jobs to run");
+            return 0;
+        }
+
+        if (numThreads == 0) {
+            numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        numThreads = std::min<size_t>(numThreads, jobs->size());
+
+        fs::create_directories(outputDir);
+
+        SharedResources resources{preloadMode};
+        std::vector<JobResult> results(jobs->size());
+        std::mutex printMutex{};
+        size_t completed = 0;
+
+        fmt::println("Running {} jobs on {} threads", jobs->size(), numThreads);
+        const auto start = std::chrono::steady_clock::now();
+        {
+            WorkStealingThreadPool pool{numThreads};
+            for (size_t i = 0; i < jobs->size(); ++i) {
+                pool.Submit([&, i] {
+                    const Job &job = (*jobs)[i];
+                    results[i] = RunJob(job, resources, outputDir);
+
+                    const JobResult &jobResult = results[i];
+                    std::unique_lock lock{printMutex};
+                    ++completed;
+                    if (jobResult.success) {
+                        fmt::println("[{}/{}] {}: {} frames in {:.2f} s ({:.1f} fps)", completed, jobs->size(),
+                                     job.name, jobResult.frames, jobResult.seconds,
+                                     jobResult.frames / std::max(jobResult.seconds, 1e-9));
+                    } else {
+                        fmt::println("[{}/{}] {}: FAILED: {}", completed, jobs->size(), job.name, jobResult.error);
+                    }
+                });
+            }
+            pool.Wait();
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        // Write summary: <job name> <status> <frames> <last frame hash> <audio hash>
+        size_t failed = 0;
+        const fs::path summaryPath = fs::path{outputDir} / "summary.txt";
+        std::ofstream summary{summaryPath};
+        for (size_t i = 0; i < jobs->size(); ++i) {
+            const JobResult &jobResult = results[i];
+            if (jobResult.success) {
+                summary << fmt::format("{} ok {} {} {}\n", (*jobs)[i].name, jobResult.frames,
+                                       ymir::ToString(jobResult.videoHash), ymir::ToString(jobResult.audioHash));
+            } else {
+                summary << fmt::format("{} failed\n", (*jobs)[i].name);
+                ++failed;
+            }
+        }
+
+        fmt::println("Finished {} jobs in {:.2f} s; {} failed", jobs->size(),
+                     std::chrono::duration<double>(end - start).count(), failed);
+        fmt::println("Summary written to {}", summaryPath);
+        return failed == 0 ? 0 : 2;
+    } catch (const cxxopts::exceptions::exception &e) {
+        fmt::println("Failed to parse arguments: {}", e.what());
+        return -1;
+    } catch (const std::system_error &e) {
+        fmt::println("System error: {}", e.what());
+        return e.code().value();
+    } catch (const std::exception &e) {
+        fmt::println("Unhandled exception: {}", e.what());
+        return -1;
+    }
+}
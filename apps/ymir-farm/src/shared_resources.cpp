@@ -0,0 +1,75 @@
+#include "shared_resources.hpp"
+
+#include <ymir/media/loader/loader.hpp>
+
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+SharedResources::SharedResources(ymir::media::PreloadMode preload)
+    : m_preload(preload) {}
+
+std::shared_ptr<IPLROM> SharedResources::GetIPL(const fs::path &path) {
+    auto entry = GetEntry(m_ipls, path);
+    std::unique_lock lock{entry->mutex};
+    if (!entry->loaded) {
+        entry->loaded = true;
+
+        std::error_code error{};
+        const auto size = fs::file_size(path, error);
+        if (error || size != ymir::sys::kIPLSize) {
+            return nullptr;
+        }
+
+        auto rom = std::make_shared<IPLROM>();
+        std::ifstream in{path, std::ios::binary};
+        in.read(reinterpret_cast<char *>(rom->data()), rom->size());
+        if (!in) {
+            return nullptr;
+        }
+        entry->rom = rom;
+    }
+    return entry->rom;
+}
+
+bool SharedResources::GetDisc(const fs::path &path, ymir::media::Disc &disc, std::string &error) {
+    auto entry = GetEntry(m_discs, path);
+    std::unique_lock lock{entry->mutex};
+    if (!entry->loaded) {
+        entry->loaded = true;
+        entry->valid = ymir::media::LoadDisc(path, entry->disc, m_preload,
+                                             [&](ymir::media::MessageType type, std::string message) {
+                                                 // Keep the last error to report it with every job using this disc
+                                                 if (type == ymir::media::MessageType::Error ||
+                                                     type == ymir::media::MessageType::NotValid) {
+                                                     entry->error = std::move(message);
+                                                 }
+                                             });
+        if (entry->valid) {
+            entry->disc.MakeThreadSafe();
+        }
+    }
+    if (!entry->valid) {
+        error = entry->error;
+        return false;
+    }
+    disc = entry->disc.Share();
+    return true;
+}
+
+template <typename TEntry>
+std::shared_ptr<TEntry> SharedResources::GetEntry(std::map<std::string, std::shared_ptr<TEntry>> &entries,
+                                                  const fs::path &path) {
+    std::error_code error{};
+    fs::path key = fs::weakly_canonical(path, error);
+    if (error) {
+        key = path;
+    }
+
+    std::unique_lock lock{m_mutex};
+    auto &entry = entries[key.string()];
+    if (!entry) {
+        entry = std::make_shared<TEntry>();
+    }
+    return entry;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <ymir/media/disc.hpp>
+#include <ymir/media/loader/loader_preload.hpp>
+
+#include <ymir/sys/memory_defs.hpp>
+
+#include <array>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using IPLROM = std::array<uint8, ymir::sys::kIPLSize>;
+
+// Loads IPL ROM images and discs once and shares them between all jobs that use them.
+//
+// Each resource is loaded by the first job that requests it; other jobs requesting the same resource wait for the load
+// to complete instead of loading their own copies. Different resources are loaded concurrently.
+//
+// Discs are made thread-safe with media::Disc::MakeThreadSafe() and handed out as shared views through
+// media::Disc::Share(), so every instance reads from the same image data.
+class SharedResources {
+public:
+    explicit SharedResources(ymir::media::PreloadMode preload);
+
+    // Retrieves the IPL ROM image at the given path.
+    // Returns nullptr if the file could not be read or does not have the expected size.
+    std::shared_ptr<IPLROM> GetIPL(const std::filesystem::path &path);
+
+    // Retrieves a view of the disc image at the given path.
+    // Returns false if the disc image could not be loaded, in which case `error` receives the loader's error message, if
+    // it reported one.
+    bool GetDisc(const std::filesystem::path &path, ymir::media::Disc &disc, std::string &error);
+
+private:
+    const ymir::media::PreloadMode m_preload;
+
+    struct IPLEntry {
+        std::mutex mutex;
+        bool loaded = false;
+        std::shared_ptr<IPLROM> rom;
+    };
+
+    struct DiscEntry {
+        std::mutex mutex;
+        bool loaded = false;
+        bool valid = false;
+        std::string error;
+        ymir::media::Disc disc;
+    };
+
+    std::mutex m_mutex;
+    std::map<std::string, std::shared_ptr<IPLEntry>> m_ipls;
+    std::map<std::string, std::shared_ptr<DiscEntry>> m_discs;
+
+    // Finds or creates the cache entry for the given path
+    template <typename TEntry>
+    std::shared_ptr<TEntry> GetEntry(std::map<std::string, std::shared_ptr<TEntry>> &entries,
+                                     const std::filesystem::path &path);
+};
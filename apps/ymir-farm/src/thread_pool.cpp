@@ -0,0 +1,98 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t numThreads) {
+    numThreads = std::max<size_t>(numThreads, 1);
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_threads.emplace_back([this, i] { WorkerLoop(i); });
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+    Wait();
+    {
+        std::unique_lock lock{m_mutex};
+        m_stop = true;
+    }
+    m_taskAvailable.notify_all();
+    for (auto &thread : m_threads) {
+        thread.join();
+    }
+}
+
+void WorkStealingThreadPool::Submit(std::function<void()> &&task) {
+    size_t index;
+    {
+        std::unique_lock lock{m_mutex};
+        index = m_nextQueue;
+        m_nextQueue = (m_nextQueue + 1) % m_queues.size();
+        ++m_pending;
+    }
+    {
+        Queue &queue = *m_queues[index];
+        std::unique_lock lock{queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        // Only publish the task after it is in a queue so that claimed tasks can always be found
+        std::unique_lock lock{m_mutex};
+        ++m_queued;
+    }
+    m_taskAvailable.notify_one();
+}
+
+void WorkStealingThreadPool::Wait() {
+    std::unique_lock lock{m_mutex};
+    m_allDone.wait(lock, [&] { return m_pending == 0; });
+}
+
+void WorkStealingThreadPool::WorkerLoop(size_t index) {
+    while (true) {
+        {
+            std::unique_lock lock{m_mutex};
+            m_taskAvailable.wait(lock, [&] { return m_stop || m_queued > 0; });
+            if (m_queued == 0) {
+                return;
+            }
+            // Claim a task; there is at least one task in the queues for every claim
+            --m_queued;
+        }
+
+        std::function<void()> task;
+        while (!TryPop(index, task)) {
+            std::this_thread::yield();
+        }
+        task();
+
+        std::unique_lock lock{m_mutex};
+        if (--m_pending == 0) {
+            m_allDone.notify_all();
+        }
+    }
+}
+
+bool WorkStealingThreadPool::TryPop(size_t index, std::function<void()> &task) {
+    {
+        Queue &queue = *m_queues[index];
+        std::unique_lock lock{queue.mutex};
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+    }
+    for (size_t i = 1; i < m_queues.size(); ++i) {
+        Queue &queue = *m_queues[(index + i) % m_queues.size()];
+        std::unique_lock lock{queue.mutex};
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A thread pool where every worker owns a task queue and steals tasks from the other workers' queues when its own runs
+// dry.
+//
+// Workers take tasks from the back of their own queue and steal from the front of other queues, so owners and thieves
+// rarely contend for the same end of a queue. Tasks are distributed round-robin on submission; stealing balances out
+// tasks with very different run times.
+class WorkStealingThreadPool {
+public:
+    // Starts the given number of worker threads. At least one worker is always started.
+    explicit WorkStealingThreadPool(size_t numThreads);
+
+    // Waits for all submitted tasks to complete and stops the workers.
+    ~WorkStealingThreadPool();
+
+    WorkStealingThreadPool(const WorkStealingThreadPool &) = delete;
+    WorkStealingThreadPool &operator=(const WorkStealingThreadPool &) = delete;
+
+    // Submits a task to be executed by any of the workers.
+    void Submit(std::function<void()> &&task);
+
+    // Blocks until all submitted tasks have completed.
+    void Wait();
+
+    // Returns the number of worker threads.
+    size_t ThreadCount() const {
+        return m_threads.size();
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    std::condition_variable m_allDone;
+    size_t m_queued = 0;  // tasks sitting in queues that no worker has claimed yet
+    size_t m_pending = 0; // tasks submitted but not yet completed
+    size_t m_nextQueue = 0;
+    bool m_stop = false;
+
+    void WorkerLoop(size_t index);
+
+    // Pops a task from the worker's own queue or steals one from another worker.
+    bool TryPop(size_t index, std::function<void()> &task);
+};
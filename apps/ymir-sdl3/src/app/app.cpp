@@ -395,6 +395,14 @@ int App::Run(const CommandLineOptions &options) {
 
     util::BoostCurrentProcessPriority(m_context.settings.general.boostProcessPriority);
 
+    // Load ROM and disc image indices so that scans only need to process new or modified files.
+    // Must be done before LoadRecentDiscs because it queues the recent discs for indexing.
+    {
+        const auto statePath = m_context.profile.GetPath(ProfilePath::PersistentState);
+        m_context.romManager.LoadIndex(statePath / "rom_index.bin");
+        m_context.discIndex.Load(statePath / "disc_index.bin");
+    }
+
     // Load recent discs list.
     // Must be done before LoadDiscImage because it saves the recent list to the file.
     LoadRecentDiscs();
@@ -809,6 +817,9 @@ void App::RunEmulator() {
              }
              ++screen.VDP2Frames;
 
+             sharedCtx.avCapture.ReceiveFrame(fb, width, height);
+             sharedCtx.traceSink.MarkFrame();
+
              if (sharedCtx.emuSpeed.limitSpeed && screen.videoSync) {
                  screen.frameRequestEvent.Wait();
                  screen.frameRequestEvent.Reset();
@@ -824,8 +835,10 @@ void App::RunEmulator() {
 
              // Limit emulation speed if requested and not using video sync.
              // When video sync is enabled, frame pacing is done by the GUI thread.
+             // At 100% speed, audio sync paces emulation unless dynamic rate control is enabled.
              if (sharedCtx.emuSpeed.limitSpeed && !screen.videoSync &&
-                 sharedCtx.emuSpeed.GetCurrentSpeedFactor() != 1.0) {
+                 (sharedCtx.emuSpeed.GetCurrentSpeedFactor() != 1.0 ||
+                  sharedCtx.audioSystem.IsDynamicRateControl())) {
 
                  const auto frameInterval = std::chrono::duration_cast<std::chrono::nanoseconds>(
                      screen.frameInterval / sharedCtx.emuSpeed.GetCurrentSpeedFactor());
@@ -882,6 +895,8 @@ void App::RunEmulator() {
     // Connect gain and mute to settings
     m_context.settings.audio.volume.ObserveAndNotify([&](float volume) { m_context.audioSystem.SetGain(volume); });
     m_context.settings.audio.mute.ObserveAndNotify([&](bool mute) { m_context.audioSystem.SetMute(mute); });
+    m_context.settings.audio.dynamicRateControl.ObserveAndNotify(
+        [&](bool enable) { m_context.audioSystem.SetDynamicRateControl(enable); });
 
     m_context.settings.audio.stepGranularity.ObserveAndNotify(
         [&](uint32 granularity) { m_context.EnqueueEvent(events::emu::SetSCSPStepGranularity(granularity)); });
@@ -920,9 +935,10 @@ void App::RunEmulator() {
         return;
     }
 
-    m_context.saturn.instance->SCSP.SetSampleCallback(
+    m_context.saturn.instance->SCSP.SetSampleRingBuffer(
+        &m_context.audioSystem.GetSampleRing(), AudioSystem::kSampleBlockSize,
         {&m_context.audioSystem,
-         [](sint16 left, sint16 right, void *ctx) { static_cast<AudioSystem *>(ctx)->ReceiveSample(left, right); }});
+         [](uint32 count, void *ctx) { static_cast<AudioSystem *>(ctx)->ReceiveSampleBlock(count); }});
 
     m_context.saturn.instance->SCSP.SetSendMidiOutputCallback(
         {&m_context.midi.midiOutput, [](std::span<uint8> payload, void *ctx) {
@@ -988,6 +1004,9 @@ void App::RunEmulator() {
         inputContext.SetTriggerHandler(actions::general::TakeScreenshot, [&](void *, const input::InputElement &) {
             m_context.EnqueueEvent(events::gui::TakeScreenshot());
         });
+        inputContext.SetTriggerHandler(actions::general::ToggleAVCapture, [&](void *, const input::InputElement &) {
+            m_context.EnqueueEvent(events::gui::ToggleAVCapture());
+        });
         inputContext.SetTriggerHandler(actions::general::ExitApp, [&](void *, const input::InputElement &) {
             SDL_Event quitEvent{.type = SDL_EVENT_QUIT};
             SDL_PushEvent(&quitEvent);
@@ -1616,6 +1635,9 @@ void App::RunEmulator() {
     auto t = clk::now();
     m_mouseHideTime = t;
 
+    // Make sure the emulator thread sees released buttons until the first inputs are processed
+    PublishPeripheralReports();
+
     // Start emulator thread
     m_emuThread = std::thread([&] { EmulatorThread(); });
     ScopeGuard sgStopEmuThread{[&] {
@@ -1674,6 +1696,64 @@ void App::RunEmulator() {
         assert(freePlayerIndices.insert(free).second);
     };
 
+    // Handles keyboard and gamepad events that map to emulator inputs
+    auto processInputEvent = [&](const SDL_Event &evt) {
+        switch (evt.type) {
+        case SDL_EVENT_KEY_DOWN: [[fallthrough]];
+        case SDL_EVENT_KEY_UP:
+            if (!io.WantCaptureKeyboard || inputContext.IsCapturing()) {
+                // TODO: consider supporting multiple keyboards (evt.key.which)
+                inputContext.ProcessPrimitive(input::SDL3ScancodeToKeyboardKey(evt.key.scancode),
+                                              input::SDL3ToKeyModifier(evt.key.mod), evt.key.down);
+            }
+
+            // Leave full screen when pressing Esc while not focused on ImGui windows
+            if (!io.WantCaptureKeyboard && evt.key.scancode == SDL_SCANCODE_ESCAPE && evt.key.down) {
+                m_context.settings.video.fullScreen = false;
+                m_context.settings.MakeDirty();
+            }
+            break;
+        case SDL_EVENT_GAMEPAD_AXIS_MOTION: //
+        {
+            const int playerIndex = getGamepadPlayerIndex(evt.gaxis.which);
+            const float value = evt.gaxis.value < 0 ? evt.gaxis.value / 32768.0f : evt.gaxis.value / 32767.0f;
+            inputContext.ProcessPrimitive(playerIndex, input::SDL3ToGamepadAxis1D((SDL_GamepadAxis)evt.gaxis.axis),
+                                          value);
+            break;
+        }
+        case SDL_EVENT_GAMEPAD_BUTTON_DOWN: [[fallthrough]];
+        case SDL_EVENT_GAMEPAD_BUTTON_UP: //
+        {
+            const int playerIndex = getGamepadPlayerIndex(evt.gbutton.which);
+            inputContext.ProcessPrimitive(
+                playerIndex, input::SDL3ToGamepadButton((SDL_GamepadButton)evt.gbutton.button), evt.gbutton.down);
+            break;
+        }
+        default: break;
+        }
+    };
+
+    // Input events consumed while waiting for the emulator to finish a frame with late polling enabled.
+    // These are forwarded to ImGui on the next pass through the event loop.
+    std::vector<SDL_Event> latePolledEvents{};
+
+    // Reads pending keyboard and gamepad events and publishes the updated peripheral reports to the emulator thread.
+    // Other events are left in the queue for the main event loop.
+    auto pollInputsLate = [&] {
+        SDL_PumpEvents();
+        SDL_Event evt{};
+        auto peepRange = [&](SDL_EventType first, SDL_EventType last) {
+            while (SDL_PeepEvents(&evt, 1, SDL_GETEVENT, first, last) > 0) {
+                processInputEvent(evt);
+                latePolledEvents.push_back(evt);
+            }
+        };
+        peepRange(SDL_EVENT_KEY_DOWN, SDL_EVENT_KEY_UP);
+        peepRange(SDL_EVENT_GAMEPAD_AXIS_MOTION, SDL_EVENT_GAMEPAD_BUTTON_UP);
+        m_context.inputContext.ProcessAxes();
+        PublishPeripheralReports();
+    };
+
     std::array<GUIEvent, 64> evts{};
 
 #if Ymir_ENABLE_IMGUI_DEMO
@@ -1699,7 +1779,10 @@ void App::RunEmulator() {
         const double frameIntervalAdjustFactor = 0.2; // how much adjustment is applied to the frame interval
 
         if (m_context.emuSpeed.limitSpeed) {
-            if (m_context.emuSpeed.GetCurrentSpeedFactor() == 1.0) {
+            if (m_context.audioSystem.IsDynamicRateControl()) {
+                // The audio system adjusts its playback rate to the emulator, so keep the regular frame interval
+                avgFrameDelay = 0.0;
+            } else if (m_context.emuSpeed.GetCurrentSpeedFactor() == 1.0) {
                 // Deliver frame early if audio buffer is emptying (video sync is slowing down emulation too much).
                 // Attempt to maintain the audio buffer between 30% and 70%.
                 // Smoothly adjust frame interval up or down if audio buffer exceeds either threshold.
@@ -1822,6 +1905,12 @@ void App::RunEmulator() {
             screen.frameRequestEvent.Set();
         }
 
+        // Let ImGui see the input events consumed by late polling during the previous frame
+        for (const SDL_Event &lateEvt : latePolledEvents) {
+            ImGui_ImplSDL3_ProcessEvent(&lateEvt);
+        }
+        latePolledEvents.clear();
+
         // Process SDL events
         SDL_Event evt{};
         while (SDL_PollEvent(&evt)) {
@@ -1847,19 +1936,7 @@ void App::RunEmulator() {
                 // evt.kdevice.which;
                 break;
             case SDL_EVENT_KEY_DOWN: [[fallthrough]];
-            case SDL_EVENT_KEY_UP:
-                if (!io.WantCaptureKeyboard || inputContext.IsCapturing()) {
-                    // TODO: consider supporting multiple keyboards (evt.key.which)
-                    inputContext.ProcessPrimitive(input::SDL3ScancodeToKeyboardKey(evt.key.scancode),
-                                                  input::SDL3ToKeyModifier(evt.key.mod), evt.key.down);
-                }
-
-                // Leave full screen when pressing Esc while not focused on ImGui windows
-                if (!io.WantCaptureKeyboard && evt.key.scancode == SDL_SCANCODE_ESCAPE && evt.key.down) {
-                    m_context.settings.video.fullScreen = false;
-                    m_context.settings.MakeDirty();
-                }
-                break;
+            case SDL_EVENT_KEY_UP: processInputEvent(evt); break;
 
             case SDL_EVENT_MOUSE_ADDED: [[fallthrough]];
             case SDL_EVENT_MOUSE_REMOVED:
@@ -1935,22 +2012,9 @@ void App::RunEmulator() {
                 // evt.gdevice.type;
                 // evt.gdevice.which;
                 break;
-            case SDL_EVENT_GAMEPAD_AXIS_MOTION: //
-            {
-                const int playerIndex = getGamepadPlayerIndex(evt.gaxis.which);
-                const float value = evt.gaxis.value < 0 ? evt.gaxis.value / 32768.0f : evt.gaxis.value / 32767.0f;
-                inputContext.ProcessPrimitive(playerIndex, input::SDL3ToGamepadAxis1D((SDL_GamepadAxis)evt.gaxis.axis),
-                                              value);
-                break;
-            }
+            case SDL_EVENT_GAMEPAD_AXIS_MOTION: [[fallthrough]];
             case SDL_EVENT_GAMEPAD_BUTTON_DOWN: [[fallthrough]];
-            case SDL_EVENT_GAMEPAD_BUTTON_UP: //
-            {
-                const int playerIndex = getGamepadPlayerIndex(evt.gbutton.which);
-                inputContext.ProcessPrimitive(
-                    playerIndex, input::SDL3ToGamepadButton((SDL_GamepadButton)evt.gbutton.button), evt.gbutton.down);
-                break;
-            }
+            case SDL_EVENT_GAMEPAD_BUTTON_UP: processInputEvent(evt); break;
 
             case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN: [[fallthrough]];
             case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION: [[fallthrough]];
@@ -2023,6 +2087,7 @@ void App::RunEmulator() {
 
         // Process all axis changes
         m_context.inputContext.ProcessAxes();
+        PublishPeripheralReports();
 
         // Make emulator thread process next frame
         m_emuProcessEvent.Set();
@@ -2158,6 +2223,22 @@ void App::RunEmulator() {
                 break;
             }
 
+            case EvtType::ToggleAVCapture: //
+            {
+                if (m_context.avCapture.IsRunning()) {
+                    m_context.EnqueueEvent(events::emu::StopAVCapture());
+                } else {
+                    const auto now = std::chrono::system_clock::now();
+                    const auto localNow = util::to_local_time(now);
+                    // ISO 8601
+                    auto basePath = m_context.profile.GetPath(ProfilePath::Captures) /
+                                    fmt::format("{}-{:%Y%m%d}T{:%H%M%S}", m_context.GetGameFileName(), localNow,
+                                                localNow);
+                    m_context.EnqueueEvent(events::emu::StartAVCapture(basePath));
+                }
+                break;
+            }
+
             case EvtType::CheckForUpdates: CheckForUpdates(true); break;
 
             case EvtType::StateLoaded:
@@ -2170,7 +2251,16 @@ void App::RunEmulator() {
         // Update display
         if (screen.updated || screen.videoSync) {
             if (screen.videoSync && screen.expectFrame && !m_context.paused) {
-                screen.frameReadyEvent.Wait();
+                if (m_context.settings.input.latePolling) {
+                    // Keep feeding fresh inputs to the emulator until it finishes the frame
+                    using namespace std::chrono_literals;
+                    while (!screen.frameReadyEvent.IsSet()) {
+                        pollInputsLate();
+                        std::this_thread::sleep_for(250us);
+                    }
+                } else {
+                    screen.frameReadyEvent.Wait();
+                }
                 screen.frameReadyEvent.Reset();
                 screen.expectFrame = false;
             }
@@ -2326,7 +2416,12 @@ void App::RunEmulator() {
                                 std::string fullPathStr = fmt::format("{}", path);
                                 std::string pathStr = fullPathStr;
                                 bool shorten = pathStr.length() > 60;
-                                if (shorten) {
+                                if (auto indexEntry = m_context.discIndex.Find(path);
+                                    indexEntry && !indexEntry->gameTitle.empty()) {
+                                    // Show game title from the disc index, with the file name for disambiguation
+                                    pathStr = fmt::format("{} ({})##{}", indexEntry->gameTitle, path.filename(), i);
+                                    shorten = true;
+                                } else if (shorten) {
                                     pathStr =
                                         fmt::format("[...]{}{}##{}", (char)std::filesystem::path::preferred_separator,
                                                     path.filename(), i);
@@ -2445,6 +2540,11 @@ void App::RunEmulator() {
                                         input::ToShortcut(inputContext, actions::general::TakeScreenshot).c_str())) {
                         m_context.EnqueueEvent(events::gui::TakeScreenshot());
                     }
+                    if (ImGui::MenuItem(m_context.avCapture.IsRunning() ? "Stop video and audio capture"
+                                                                        : "Start video and audio capture",
+                                        input::ToShortcut(inputContext, actions::general::ToggleAVCapture).c_str())) {
+                        m_context.EnqueueEvent(events::gui::ToggleAVCapture());
+                    }
 
                     ImGui::Separator();
 
@@ -2710,6 +2810,24 @@ void App::RunEmulator() {
                                         &debugTrace)) {
                         m_context.EnqueueEvent(events::emu::SetDebugTrace(debugTrace));
                     }
+                    if (ImGui::MenuItem(m_context.traceSink.IsRunning() ? "Stop SH-2 trace recording"
+                                                                        : "Start SH-2 trace recording")) {
+                        if (m_context.traceSink.IsRunning()) {
+                            m_context.EnqueueEvent(events::emu::StopTraceRecording());
+                        } else {
+                            // Tracers are only attached while debug tracing is enabled
+                            if (!debugTrace) {
+                                m_context.EnqueueEvent(events::emu::SetDebugTrace(true));
+                            }
+                            const auto now = std::chrono::system_clock::now();
+                            const auto localNow = util::to_local_time(now);
+                            // ISO 8601
+                            auto path = m_context.profile.GetPath(ProfilePath::Dumps) /
+                                        fmt::format("{}-{:%Y%m%d}T{:%H%M%S}.ymtrace", m_context.GetGameFileName(),
+                                                    localNow, localNow);
+                            m_context.EnqueueEvent(events::emu::StartTraceRecording(path));
+                        }
+                    }
                     ImGui::Separator();
                     if (ImGui::MenuItem("Open memory viewer", nullptr)) {
                         OpenMemoryViewer();
@@ -3368,14 +3486,83 @@ void App::EmulatorThread() {
     enum class StepAction { Noop, RunFrame, FrameStep, StepMSH2, StepSSH2 };
 
     std::array<EmuEvent, 64> evts{};
+    std::array<EmuFastEvent, 64> fastEvts{};
+
+    StepAction stepAction;
+
+    auto processFastEvent = [&](const EmuFastEvent &evt) {
+        using enum EmuFastEvent::Type;
+        switch (evt.type) {
+        case SetResetButton: m_context.saturn.instance->SMPC.SetResetButtonState(evt.value); break;
+
+        case SetPaused: //
+        {
+            const bool newPaused = evt.value;
+            stepAction = newPaused ? StepAction::Noop : StepAction::RunFrame;
+            m_context.paused = newPaused;
+            m_context.audioSystem.SetSilent(newPaused);
+            if (m_context.screen.videoSync) {
+                // Avoid locking the GUI thread
+                m_context.screen.frameReadyEvent.Set();
+            }
+            break;
+        }
+        case ForwardFrameStep:
+            stepAction = StepAction::FrameStep;
+            m_context.paused = true;
+            m_context.audioSystem.SetSilent(false);
+            break;
+        case ReverseFrameStep:
+            stepAction = StepAction::FrameStep;
+            m_context.paused = true;
+            m_context.rewinding = true;
+            m_context.audioSystem.SetSilent(false);
+            break;
+        case StepMSH2:
+            stepAction = StepAction::StepMSH2;
+            if (!m_context.paused) {
+                m_context.paused = true;
+                m_context.DisplayMessage("Paused due to single-stepping master SH-2");
+            }
+            m_context.audioSystem.SetSilent(true);
+            break;
+        case StepSSH2:
+            stepAction = StepAction::StepSSH2;
+            if (!m_context.paused) {
+                m_context.paused = true;
+                m_context.DisplayMessage("Paused due to single-stepping slave SH-2");
+            }
+            m_context.audioSystem.SetSilent(true);
+            break;
+
+        case ReceiveMidiInput: //
+        {
+            ymir::scsp::MidiMessage msg{
+                evt.midiDeltaTime, std::vector<uint8>(evt.midiBytes.begin(), evt.midiBytes.begin() + evt.midiLength)};
+            m_context.saturn.instance->SCSP.ReceiveMidiInput(msg);
+            break;
+        }
+        }
+    };
 
     while (true) {
         const bool paused = m_context.paused;
-        StepAction stepAction = paused ? StepAction::Noop : StepAction::RunFrame;
+        stepAction = paused ? StepAction::Noop : StepAction::RunFrame;
+
+        // Process fast events first.
+        // Pairs with the fence in SharedContext::EnqueueEvent(const EmuFastEvent &) so that events pushed right before
+        // the emulator thread blocks below are always followed by a wake up event.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto &fastQueue = m_context.eventQueues.emulatorFast;
+        const size_t fastEvtCount = fastQueue.TryDequeueBulk(fastEvts.begin(), fastEvts.size());
+        for (size_t i = 0; i < fastEvtCount; i++) {
+            processFastEvent(fastEvts[i]);
+        }
 
-        // Process all pending events
-        const size_t evtCount = paused ? m_context.eventQueues.emulator.wait_dequeue_bulk(evts.begin(), evts.size())
-                                       : m_context.eventQueues.emulator.try_dequeue_bulk(evts.begin(), evts.size());
+        // Process all pending events, waiting for one while paused unless fast events were just processed
+        const bool wait = paused && fastEvtCount == 0;
+        const size_t evtCount = wait ? m_context.eventQueues.emulator.wait_dequeue_bulk(evts.begin(), evts.size())
+                                     : m_context.eventQueues.emulator.try_dequeue_bulk(evts.begin(), evts.size());
         for (size_t i = 0; i < evtCount; i++) {
             EmuEvent &evt = evts[i];
             using enum EmuEvent::Type;
@@ -3386,47 +3573,6 @@ void App::EmulatorThread() {
                 m_context.rewindBuffer.Reset();
                 break;
             case SoftReset: m_context.saturn.instance->Reset(false); break;
-            case SetResetButton: m_context.saturn.instance->SMPC.SetResetButtonState(std::get<bool>(evt.value)); break;
-
-            case SetPaused: //
-            {
-                const bool newPaused = std::get<bool>(evt.value);
-                stepAction = newPaused ? StepAction::Noop : StepAction::RunFrame;
-                m_context.paused = newPaused;
-                m_context.audioSystem.SetSilent(newPaused);
-                if (m_context.screen.videoSync) {
-                    // Avoid locking the GUI thread
-                    m_context.screen.frameReadyEvent.Set();
-                }
-                break;
-            }
-            case ForwardFrameStep:
-                stepAction = StepAction::FrameStep;
-                m_context.paused = true;
-                m_context.audioSystem.SetSilent(false);
-                break;
-            case ReverseFrameStep:
-                stepAction = StepAction::FrameStep;
-                m_context.paused = true;
-                m_context.rewinding = true;
-                m_context.audioSystem.SetSilent(false);
-                break;
-            case StepMSH2:
-                stepAction = StepAction::StepMSH2;
-                if (!m_context.paused) {
-                    m_context.paused = true;
-                    m_context.DisplayMessage("Paused due to single-stepping master SH-2");
-                }
-                m_context.audioSystem.SetSilent(true);
-                break;
-            case StepSSH2:
-                stepAction = StepAction::StepSSH2;
-                if (!m_context.paused) {
-                    m_context.paused = true;
-                    m_context.DisplayMessage("Paused due to single-stepping slave SH-2");
-                }
-                m_context.audioSystem.SetSilent(true);
-                break;
 
             case OpenCloseTray:
                 if (m_context.saturn.instance->IsTrayOpen()) {
@@ -3489,6 +3635,9 @@ void App::EmulatorThread() {
                 m_context.saturn.instance->SCSP.ReceiveMidiInput(std::get<ymir::scsp::MidiMessage>(evt.value));
                 break;
 
+            case FastEvent: processFastEvent(std::get<EmuFastEvent>(evt.value)); break;
+            case Wake: break;
+
             case SetThreadPriority: util::BoostCurrentThreadPriority(std::get<bool>(evt.value)); break;
 
             case Shutdown: return;
@@ -4129,47 +4278,56 @@ void App::CheckDebuggerStateDirty() {
     }
 }
 
+void App::PublishPeripheralReports() {
+    auto &reports = m_context.peripheralReports.WriteBuffer();
+    for (size_t i = 0; i < reports.ports.size(); ++i) {
+        auto &portReports = reports.ports[i];
+
+        portReports.controlPad.buttons = m_context.controlPadInputs[i].buttons;
+
+        {
+            auto &specificReport = portReports.analogPad;
+            const auto &inputs = m_context.analogPadInputs[i];
+            specificReport.buttons = inputs.buttons;
+            specificReport.analog = inputs.analogMode;
+            specificReport.x = std::clamp(inputs.x * 128.0f + 128.0f, 0.0f, 255.0f);
+            specificReport.y = std::clamp(inputs.y * 128.0f + 128.0f, 0.0f, 255.0f);
+            specificReport.l = inputs.l * 255.0f;
+            specificReport.r = inputs.r * 255.0f;
+        }
+
+        {
+            auto &specificReport = portReports.arcadeRacer;
+            const auto &inputs = m_context.arcadeRacerInputs[i];
+            specificReport.buttons = inputs.buttons;
+            specificReport.wheel = std::clamp(inputs.wheel * 128.0f + 128.0f, 0.0f, 255.0f);
+        }
+
+        {
+            auto &specificReport = portReports.missionStick;
+            const auto &inputs = m_context.missionStickInputs[i];
+            specificReport.buttons = inputs.buttons;
+            specificReport.sixAxis = inputs.sixAxisMode;
+            specificReport.x1 = std::clamp(inputs.sticks[0].x * 128.0f + 128.0f, 0.0f, 255.0f);
+            specificReport.y1 = std::clamp(inputs.sticks[0].y * 128.0f + 128.0f, 0.0f, 255.0f);
+            specificReport.z1 = inputs.sticks[0].z * 255.0f;
+            specificReport.x2 = std::clamp(inputs.sticks[1].x * 128.0f + 128.0f, 0.0f, 255.0f);
+            specificReport.y2 = std::clamp(inputs.sticks[1].y * 128.0f + 128.0f, 0.0f, 255.0f);
+            specificReport.z2 = inputs.sticks[1].z * 255.0f;
+        }
+    }
+    m_context.peripheralReports.Publish();
+}
+
 template <int port>
 void App::ReadPeripheral(ymir::peripheral::PeripheralReport &report) {
     // TODO: this is the appropriate location to capture inputs for a movie recording
+    const auto &portReports = m_context.peripheralReports.Read().ports[port - 1];
     switch (report.type) {
-    case ymir::peripheral::PeripheralType::ControlPad:
-        report.report.controlPad.buttons = m_context.controlPadInputs[port - 1].buttons;
-        break;
-    case ymir::peripheral::PeripheralType::AnalogPad: //
-    {
-        auto &specificReport = report.report.analogPad;
-        const auto &inputs = m_context.analogPadInputs[port - 1];
-        specificReport.buttons = inputs.buttons;
-        specificReport.analog = inputs.analogMode;
-        specificReport.x = std::clamp(inputs.x * 128.0f + 128.0f, 0.0f, 255.0f);
-        specificReport.y = std::clamp(inputs.y * 128.0f + 128.0f, 0.0f, 255.0f);
-        specificReport.l = inputs.l * 255.0f;
-        specificReport.r = inputs.r * 255.0f;
-        break;
-    }
-    case ymir::peripheral::PeripheralType::ArcadeRacer: //
-    {
-        auto &specificReport = report.report.arcadeRacer;
-        const auto &inputs = m_context.arcadeRacerInputs[port - 1];
-        specificReport.buttons = inputs.buttons;
-        specificReport.wheel = std::clamp(inputs.wheel * 128.0f + 128.0f, 0.0f, 255.0f);
-        break;
-    }
-    case ymir::peripheral::PeripheralType::MissionStick: //
-    {
-        auto &specificReport = report.report.missionStick;
-        const auto &inputs = m_context.missionStickInputs[port - 1];
-        specificReport.buttons = inputs.buttons;
-        specificReport.sixAxis = inputs.sixAxisMode;
-        specificReport.x1 = std::clamp(inputs.sticks[0].x * 128.0f + 128.0f, 0.0f, 255.0f);
-        specificReport.y1 = std::clamp(inputs.sticks[0].y * 128.0f + 128.0f, 0.0f, 255.0f);
-        specificReport.z1 = inputs.sticks[0].z * 255.0f;
-        specificReport.x2 = std::clamp(inputs.sticks[1].x * 128.0f + 128.0f, 0.0f, 255.0f);
-        specificReport.y2 = std::clamp(inputs.sticks[1].y * 128.0f + 128.0f, 0.0f, 255.0f);
-        specificReport.z2 = inputs.sticks[1].z * 255.0f;
-        break;
-    }
+    case ymir::peripheral::PeripheralType::ControlPad: report.report.controlPad = portReports.controlPad; break;
+    case ymir::peripheral::PeripheralType::AnalogPad: report.report.analogPad = portReports.analogPad; break;
+    case ymir::peripheral::PeripheralType::ArcadeRacer: report.report.arcadeRacer = portReports.arcadeRacer; break;
+    case ymir::peripheral::PeripheralType::MissionStick: report.report.missionStick = portReports.missionStick; break;
     default: break;
     }
 }
@@ -4218,6 +4376,7 @@ void App::ScanIPLROMs() {
     {
         std::unique_lock lock{m_context.locks.romManager};
         m_context.romManager.ScanIPLROMs(romsPath);
+        m_context.romManager.SaveIndex();
     }
 
     if constexpr (devlog::info_enabled<grp::base>) {
@@ -4331,6 +4490,7 @@ void App::ScanCDBlockROMs() {
     {
         std::unique_lock lock{m_context.locks.romManager};
         m_context.romManager.ScanCDBlockROMs(romsPath);
+        m_context.romManager.SaveIndex();
     }
 
     if constexpr (devlog::info_enabled<grp::base>) {
@@ -4398,6 +4558,7 @@ void App::ScanROMCarts() {
         if (error) {
             devlog::warn<grp::base>("Failed to read ROM carts folder: {}", error.message());
         }
+        m_context.romManager.SaveIndex();
     }
 
     if constexpr (devlog::info_enabled<grp::base>) {
@@ -4707,7 +4868,12 @@ bool App::LoadDiscImage(std::filesystem::path path, bool showErrorModal) {
     devlog::info<grp::base>("Loading disc image from {}", path);
     ymir::media::Disc disc{};
     bool hasErrors = false;
-    if (!ymir::media::LoadDisc(path, disc, m_context.settings.general.preloadDiscImagesToRAM,
+    ymir::media::PreloadMode preload = ymir::media::PreloadMode::None;
+    if (m_context.settings.general.preloadDiscImagesToRAM) {
+        preload = m_context.settings.general.compressPreloadedDiscImages ? ymir::media::PreloadMode::Compressed
+                                                                          : ymir::media::PreloadMode::Uncompressed;
+    }
+    if (!ymir::media::LoadDisc(path, disc, preload,
                                [&](ymir::media::MessageType type, std::string message) {
                                    switch (type) {
                                    case ymir::media::MessageType::InvalidFormat:
@@ -4739,10 +4905,14 @@ bool App::LoadDiscImage(std::filesystem::path path, bool showErrorModal) {
     }
     devlog::info<grp::base>("Disc image loaded succesfully");
 
+    // Recent discs and the disc index use canonical paths
+    const std::filesystem::path canonicalPath = DiscIndex::CanonicalPath(path);
+
     // Insert disc into the Saturn drive
     {
         std::unique_lock lock{m_context.locks.disc};
         m_context.saturn.instance->LoadDisc(std::move(disc));
+        m_context.discIndex.Store(canonicalPath, m_context.saturn.GetDisc().header, m_context.saturn.GetDiscHash());
         if (m_context.saturn.GetConfiguration().system.autodetectRegion) {
             m_context.settings.system.videoStandard = m_context.saturn.GetConfiguration().system.videoStandard.Get();
             m_context.settings.MakeDirty();
@@ -4758,11 +4928,11 @@ bool App::LoadDiscImage(std::filesystem::path path, bool showErrorModal) {
     m_context.state.loadedDiscImagePath = path;
 
     // Add to recent games list
-    if (auto it = std::find(m_context.state.recentDiscs.begin(), m_context.state.recentDiscs.end(), path);
+    if (auto it = std::find(m_context.state.recentDiscs.begin(), m_context.state.recentDiscs.end(), canonicalPath);
         it != m_context.state.recentDiscs.end()) {
         m_context.state.recentDiscs.erase(it);
     }
-    m_context.state.recentDiscs.push_front(path);
+    m_context.state.recentDiscs.push_front(canonicalPath);
 
     // Limit to 10 entries
     if (m_context.state.recentDiscs.size() > 10) {
@@ -4798,7 +4968,9 @@ void App::LoadRecentDiscs() {
         std::u8string u8line{line.begin(), line.end()};
         std::filesystem::path path = u8line;
         if (!path.empty()) {
+            path = DiscIndex::CanonicalPath(path);
             m_context.state.recentDiscs.push_back(path);
+            m_context.discIndex.Enqueue(path);
         }
     }
 }
@@ -5007,7 +5179,11 @@ void App::OpenGenericModal(std::string title, std::function<void()> fnContents,
 
 void App::OnMidiInputReceived(double delta, std::vector<unsigned char> *msg, void *userData) {
     App *app = static_cast<App *>(userData);
-    app->m_context.EnqueueEvent(events::emu::ReceiveMidiInput(delta, std::move(*msg)));
+    if (msg->size() <= EmuFastEvent::kMaxMidiBytes) {
+        app->m_context.EnqueueEvent(events::emu::ReceiveShortMidiInput(delta, *msg));
+    } else {
+        app->m_context.EnqueueEvent(events::emu::ReceiveMidiInput(delta, std::move(*msg)));
+    }
 }
 
 } // namespace app
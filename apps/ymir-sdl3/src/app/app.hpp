@@ -99,6 +99,8 @@ private:
     void SaveDebuggerState();
     void CheckDebuggerStateDirty();
 
+    void PublishPeripheralReports();
+
     template <int port>
     void ReadPeripheral(ymir::peripheral::PeripheralReport &report);
 
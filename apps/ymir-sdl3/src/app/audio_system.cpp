@@ -3,6 +3,8 @@
 #include <SDL3/SDL_hints.h>
 #include <SDL3/SDL_log.h>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 
 namespace app {
@@ -71,18 +73,25 @@ bool AudioSystem::GetAudioStreamFormat(int *sampleRate, SDL_AudioFormat *format,
     }
 }
 
-void AudioSystem::ReceiveSample(sint16 left, sint16 right) {
-    // If we're doing audio sync, wait until the buffer is no longer full.
-    // Otherwise, simply overrun the buffer.
-    if (m_sync && !m_silent) {
-        m_bufferNotFullEvent.Wait();
+void AudioSystem::SetDynamicRateControl(bool enable) {
+    m_dynamicRateControl = enable;
+    if (enable) {
+        // Release the emulator if it is waiting for room in the buffer
+        m_bufferNotFullEvent.Set();
     }
+}
 
-    m_buffer[m_writePos] = {left, right};
-
-    m_writePos = (m_writePos + 1) % m_buffer.size();
-    if (m_writePos == m_readPos) {
-        m_bufferNotFullEvent.Reset();
+void AudioSystem::ReceiveSampleBlock(uint32 count) {
+    // If we're doing audio sync without dynamic rate control, wait until there is room for another block.
+    // Otherwise, let the SCSP drop samples when the buffer is full.
+    if (m_sync && !m_silent) {
+        while (!m_dynamicRateControl && m_ring.Free() < kSampleBlockSize) {
+            m_bufferNotFullEvent.Reset();
+            if (m_dynamicRateControl || m_ring.Free() >= kSampleBlockSize) {
+                break;
+            }
+            m_bufferNotFullEvent.Wait();
+        }
     }
 }
 
@@ -90,7 +99,29 @@ void AudioSystem::UpdateGain() {
     SDL_SetAudioStreamGain(m_audioStream, m_mute ? 0.0f : m_gain);
 }
 
+void AudioSystem::UpdateRateRatio(SDL_AudioStream *stream) {
+    float targetRatio = 1.0f;
+    if (m_dynamicRateControl && m_sync && !m_silent) {
+        // Play slightly faster when the buffer is more than half full and slightly slower when it is less than half
+        // full, so that the buffer settles around the midpoint without ever stalling the emulator
+        const float fillLevel = static_cast<float>(m_ring.Available()) / m_ring.Capacity();
+        targetRatio += std::clamp(fillLevel * 2.0f - 1.0f, -1.0f, 1.0f) * kMaxRateDeviation;
+    }
+
+    // Ease into the target ratio to avoid audible pitch changes
+    static constexpr float kSmoothing = 0.05f;
+    float ratio = m_rateRatio + (targetRatio - m_rateRatio) * kSmoothing;
+    if (std::abs(targetRatio - ratio) < 1e-6f) {
+        ratio = targetRatio;
+    }
+    if (ratio != m_rateRatio && SDL_SetAudioStreamFrequencyRatio(stream, ratio)) {
+        m_rateRatio = ratio;
+    }
+}
+
 void AudioSystem::ProcessAudioCallback(SDL_AudioStream *stream, int additional_amount, int total_amount) {
+    UpdateRateRatio(stream);
+
     int sampleCount = additional_amount / sizeof(Sample);
     if (m_silent) {
         const sint16 zero = 0;
@@ -98,13 +129,11 @@ void AudioSystem::ProcessAudioCallback(SDL_AudioStream *stream, int additional_a
             SDL_PutAudioStreamData(stream, &zero, sizeof(zero));
         }
     } else {
-        const uint32 readPos = m_readPos.load(std::memory_order_acquire);
-        int len1 = std::min<int>(sampleCount, m_buffer.size() - readPos);
-        int len2 = std::min<int>(sampleCount - len1, readPos);
-        SDL_PutAudioStreamData(stream, &m_buffer[readPos], len1 * sizeof(Sample));
-        SDL_PutAudioStreamData(stream, &m_buffer[0], len2 * sizeof(Sample));
+        const auto regions = m_ring.Peek(sampleCount);
+        SDL_PutAudioStreamData(stream, regions.first.data(), regions.first.size_bytes());
+        SDL_PutAudioStreamData(stream, regions.second.data(), regions.second.size_bytes());
 
-        m_readPos.store((readPos + len1 + len2) % m_buffer.size(), std::memory_order_release);
+        m_ring.Consume((regions.first.size() + regions.second.size()) / 2);
         m_bufferNotFullEvent.Set();
     }
 }
@@ -2,6 +2,8 @@
 
 #include <ymir/core/types.hpp>
 
+#include <ymir/hw/scsp/scsp_sample_ring.hpp>
+
 #include <ymir/util/event.hpp>
 
 #include <SDL3/SDL_audio.h>
@@ -18,6 +20,15 @@ struct Sample {
 
 class AudioSystem {
 public:
+    // Number of samples the SCSP publishes to the ring buffer at a time
+    static constexpr uint32 kSampleBlockSize = 256;
+
+    // Capacity of the sample ring buffer
+    static constexpr uint32 kBufferSize = 2048;
+
+    // Maximum deviation from the nominal playback rate applied by dynamic rate control
+    static constexpr float kMaxRateDeviation = 0.005f;
+
     bool Init(int sampleRate, SDL_AudioFormat format, int channels, uint32 bufferSize);
     void Deinit();
 
@@ -27,12 +38,20 @@ public:
 
     bool GetAudioStreamFormat(int *sampleRate, SDL_AudioFormat *format, int *channels);
 
-    void ReceiveSample(sint16 left, sint16 right);
+    // Returns the ring buffer the SCSP writes samples into
+    ymir::scsp::SampleRingBuffer &GetSampleRing() {
+        return m_ring;
+    }
+
+    // Invoked by the SCSP after it publishes a block of samples to the ring buffer
+    void ReceiveSampleBlock(uint32 count);
 
-    void Snapshot(std::span<Sample, 2048> out) const {
-        const uint32 readPos = m_readPos;
-        std::copy(m_buffer.begin() + readPos, m_buffer.end(), out.begin());
-        std::copy(m_buffer.begin(), m_buffer.begin() + readPos, out.begin() + out.size() - readPos);
+    void Snapshot(std::span<Sample, kBufferSize> out) const {
+        const uint32 readPos = m_ring.ReadPosition();
+        for (uint32 i = 0; i < kBufferSize; i++) {
+            const uint32 pos = ((readPos + i) % kBufferSize) * 2;
+            out[i] = {m_buffer[pos + 0], m_buffer[pos + 1]};
+        }
     }
 
     void SetGain(float gain) {
@@ -61,6 +80,16 @@ public:
         return m_sync;
     }
 
+    // Enables or disables dynamic rate control.
+    // When enabled, the emulator never waits for room in the buffer while syncing to audio. Instead, the playback rate
+    // is continuously adjusted by a small amount to keep the buffer half full, and emulation speed is expected to be
+    // limited by the frame rate.
+    void SetDynamicRateControl(bool enable);
+
+    bool IsDynamicRateControl() const {
+        return m_dynamicRateControl;
+    }
+
     void SetSilent(bool silent) {
         m_silent = silent;
     }
@@ -70,33 +99,34 @@ public:
     }
 
     uint32 GetBufferCount() const {
-        uint32 total = m_writePos - m_readPos + m_buffer.size();
-        if (total > m_buffer.size()) {
-            total -= m_buffer.size();
-        }
-        return total;
+        return m_ring.Available();
     }
 
     uint32 GetBufferCapacity() const {
-        return m_buffer.size();
+        return m_ring.Capacity();
     }
 
 private:
     SDL_AudioStream *m_audioStream = nullptr;
     bool m_running = false;
 
-    std::array<Sample, 2048> m_buffer{};
-    std::atomic_uint32_t m_readPos = 0;
-    uint32 m_writePos = 0;
+    // Interleaved left/right samples
+    std::array<sint16, kBufferSize * 2> m_buffer{};
+    ymir::scsp::SampleRingBuffer m_ring{m_buffer};
     util::Event m_bufferNotFullEvent{true};
 
     bool m_sync = true;
     bool m_silent = false;
+    bool m_dynamicRateControl = false;
+
+    // Current playback rate ratio; only accessed by the audio callback
+    float m_rateRatio = 1.0f;
 
     float m_gain = 0.8f;
     bool m_mute = false;
 
     void UpdateGain();
+    void UpdateRateRatio(SDL_AudioStream *stream);
 
     void ProcessAudioCallback(SDL_AudioStream *stream, int additional_amount, int total_amount);
 };
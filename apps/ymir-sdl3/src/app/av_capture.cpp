@@ -0,0 +1,233 @@
+#include "av_capture.hpp"
+
+#include <ymir/hw/vdp/vdp_defs.hpp>
+
+#include <ymir/util/data_ops.hpp>
+#include <ymir/util/thread_name.hpp>
+
+#include <lz4.h>
+
+#include <algorithm>
+
+namespace app {
+
+AVCapture::AVCapture() {
+    for (auto &slot : m_slots) {
+        m_freeSlots.enqueue(&slot);
+    }
+}
+
+AVCapture::~AVCapture() {
+    Stop();
+}
+
+bool AVCapture::Start(std::filesystem::path basePath, std::error_code &error) {
+    error.clear();
+    if (m_running) {
+        return true;
+    }
+
+    std::filesystem::create_directories(basePath.parent_path(), error);
+    if (error) {
+        return false;
+    }
+
+    auto videoPath = basePath;
+    auto audioPath = basePath;
+    videoPath += ".ymcap";
+    audioPath += ".wav";
+
+    m_videoOut.open(videoPath, std::ios::binary | std::ios::trunc);
+    if (!m_videoOut) {
+        error.assign(errno, std::generic_category());
+        return false;
+    }
+    m_audioOut.open(audioPath, std::ios::binary | std::ios::trunc);
+    if (!m_audioOut) {
+        error.assign(errno, std::generic_category());
+        m_videoOut.close();
+        return false;
+    }
+
+    // Write frame stream header
+    std::array<uint8, 16> header{};
+    std::copy_n("YMIRCAP", 8, header.begin());
+    util::WriteLE<uint32>(&header[8], 1);
+    util::WriteLE<uint32>(&header[12], kSampleRate);
+    m_videoOut.write(reinterpret_cast<const char *>(header.data()), header.size());
+
+    // Write WAV header with placeholder sizes; they are filled in when the capture stops
+    m_audioBytes = 0;
+    WriteWAVHeader();
+
+    for (auto &slot : m_slots) {
+        slot.pixels.resize(ymir::vdp::kMaxResH * ymir::vdp::kMaxResV);
+    }
+
+    m_basePath = basePath;
+    m_startTime = std::chrono::steady_clock::now();
+    m_frameCounter = 0;
+    m_audioPosition = 0;
+    m_baseDroppedSamples = m_audioRing.Dropped();
+    m_capturedFrames = 0;
+    m_droppedFrames = 0;
+    m_droppedSamples = 0;
+    m_writeError = !m_videoOut || !m_audioOut;
+
+    m_writerThread = std::thread([&] { WriterThread(); });
+    m_running = true;
+    return true;
+}
+
+bool AVCapture::Stop() {
+    if (!m_running) {
+        return !m_writeError;
+    }
+
+    // Hand over the remaining audio and tell the writer thread to finish
+    m_audioRing.Publish();
+    m_droppedSamples = m_audioRing.Dropped() - m_baseDroppedSamples;
+    m_pendingSlots.enqueue(nullptr);
+    if (m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+    m_running = false;
+
+    // Fill in WAV sizes
+    m_audioOut.seekp(0);
+    WriteWAVHeader();
+
+    m_videoOut.close();
+    m_audioOut.close();
+    if (m_videoOut.fail() || m_audioOut.fail()) {
+        m_writeError = true;
+    }
+
+    // Release frame memory while not capturing
+    for (auto &slot : m_slots) {
+        slot.pixels.clear();
+        slot.pixels.shrink_to_fit();
+    }
+    m_compressBuffer.clear();
+    m_compressBuffer.shrink_to_fit();
+
+    return !m_writeError;
+}
+
+void AVCapture::ReceiveFrame(const uint32 *fb, uint32 width, uint32 height) {
+    if (!m_running) {
+        return;
+    }
+
+    // Publish the audio output for this frame
+    m_audioPosition += m_audioRing.Publish();
+    m_droppedSamples.store(m_audioRing.Dropped() - m_baseDroppedSamples, std::memory_order_relaxed);
+
+    const uint64 frameNumber = m_frameCounter++;
+
+    FrameSlot *slot = nullptr;
+    if (!m_freeSlots.try_dequeue(slot)) {
+        // The writer is falling behind
+        m_droppedFrames.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    slot->width = width;
+    slot->height = height;
+    slot->frameNumber = frameNumber;
+    slot->timestamp =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_startTime).count();
+    slot->audioPosition = m_audioPosition;
+    // Ignore the unused X component to improve compression
+    std::transform(fb, fb + width * height, slot->pixels.begin(), [](uint32 px) { return px & 0xFFFFFF; });
+
+    m_pendingSlots.enqueue(slot);
+    m_capturedFrames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AVCapture::WriterThread() {
+    util::SetCurrentThreadName("A/V capture writer thread");
+
+    while (true) {
+        FrameSlot *slot = nullptr;
+        m_pendingSlots.wait_dequeue(slot);
+        WriteAudio();
+        if (slot == nullptr) {
+            break;
+        }
+        WriteFrame(*slot);
+        m_freeSlots.enqueue(slot);
+    }
+}
+
+void AVCapture::WriteFrame(const FrameSlot &slot) {
+    const int srcSize = slot.width * slot.height * sizeof(uint32);
+    const int dstSize = LZ4_compressBound(srcSize);
+    if (m_compressBuffer.size() < static_cast<size_t>(dstSize)) {
+        m_compressBuffer.resize(dstSize);
+    }
+    const char *const src = reinterpret_cast<const char *>(slot.pixels.data());
+    const int compSize = LZ4_compress_fast(src, m_compressBuffer.data(), srcSize, dstSize, LZ4Accel);
+
+    std::array<uint8, 32> header{};
+    util::WriteLE<uint64>(&header[0], slot.frameNumber);
+    util::WriteLE<uint64>(&header[8], slot.timestamp);
+    util::WriteLE<uint64>(&header[16], slot.audioPosition);
+    util::WriteLE<uint16>(&header[24], slot.width);
+    util::WriteLE<uint16>(&header[26], slot.height);
+    util::WriteLE<uint32>(&header[28], compSize);
+
+    m_videoOut.write(reinterpret_cast<const char *>(header.data()), header.size());
+    m_videoOut.write(m_compressBuffer.data(), compSize);
+    if (!m_videoOut) {
+        m_writeError = true;
+    }
+}
+
+void AVCapture::WriteAudio() {
+    const auto regions = m_audioRing.Peek(m_audioRing.Capacity());
+    const size_t count = regions.first.size() + regions.second.size();
+    if (count == 0) {
+        return;
+    }
+
+    m_audioStaging.resize(count * sizeof(sint16));
+    uint8 *out = m_audioStaging.data();
+    for (const auto region : {regions.first, regions.second}) {
+        for (sint16 sample : region) {
+            util::WriteLE<uint16>(out, static_cast<uint16>(sample));
+            out += sizeof(sint16);
+        }
+    }
+    m_audioRing.Consume(count / 2);
+
+    m_audioOut.write(reinterpret_cast<const char *>(m_audioStaging.data()), m_audioStaging.size());
+    m_audioBytes += m_audioStaging.size();
+    if (!m_audioOut) {
+        m_writeError = true;
+    }
+}
+
+void AVCapture::WriteWAVHeader() {
+    static constexpr uint16 kChannels = 2;
+
+    // Sizes saturate at the format's 4 GiB limit
+    const uint32 dataSize = std::min<uint64>(m_audioBytes, 0xFFFFFFFF - 36);
+
+    std::array<uint8, 44> header{};
+    std::copy_n("RIFF", 4, &header[0]);
+    util::WriteLE<uint32>(&header[4], 36 + dataSize);
+    std::copy_n("WAVEfmt ", 8, &header[8]);
+    util::WriteLE<uint32>(&header[16], 16);                                       // fmt chunk size
+    util::WriteLE<uint16>(&header[20], 1);                                        // PCM
+    util::WriteLE<uint16>(&header[22], kChannels);                                // channels
+    util::WriteLE<uint32>(&header[24], kSampleRate);                              // sample rate
+    util::WriteLE<uint32>(&header[28], kSampleRate * kChannels * sizeof(sint16)); // byte rate
+    util::WriteLE<uint16>(&header[32], kChannels * sizeof(sint16));               // block align
+    util::WriteLE<uint16>(&header[34], 16);                                       // bits per sample
+    std::copy_n("data", 4, &header[36]);
+    util::WriteLE<uint32>(&header[40], dataSize);
+    m_audioOut.write(reinterpret_cast<const char *>(header.data()), header.size());
+}
+
+} // namespace app
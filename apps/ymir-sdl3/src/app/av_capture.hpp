@@ -0,0 +1,140 @@
+#pragma once
+
+#include <ymir/hw/scsp/scsp_sample_ring.hpp>
+
+#include <ymir/core/types.hpp>
+
+#include <blockingconcurrentqueue.h>
+#include <concurrentqueue.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace app {
+
+// Streams every frame presented by the VDP and all SCSP output to disk without blocking the emulator.
+//
+// Frames are copied into a fixed pool of slots and handed over to a writer thread, which compresses them with LZ4 into a
+// raw frame stream (<base path>.ymcap). Audio is pushed by the SCSP into a lock-free ring buffer that the writer thread
+// drains into a WAV file (<base path>.wav). Memory usage is bounded by the pool and ring sizes: when the writer falls
+// behind, frames and samples are dropped and counted instead of stalling the emulator.
+//
+// Frame stream format (all values little-endian):
+//   File header:
+//     char[8]  magic = "YMIRCAP\0"
+//     uint32   version = 1
+//     uint32   audio sample rate
+//   One record per captured frame:
+//     uint64   frame number since the start of the capture; gaps indicate dropped frames
+//     uint64   host time since the start of the capture, in nanoseconds
+//     uint64   number of stereo samples written to the WAV file up to the end of this frame
+//     uint16   width
+//     uint16   height
+//     uint32   compressed size
+//     uint8[]  LZ4-compressed XRGB8888 pixels (width * height * 4 bytes uncompressed)
+//
+// Start(), Stop() and ReceiveFrame() must be invoked from the emulator thread.
+class AVCapture {
+public:
+    static constexpr uint32 kSampleRate = 44100;
+    static constexpr size_t kFramePoolSize = 16;
+    static constexpr uint32 kAudioRingSize = 65536; // in stereo frames; ~1.5 seconds
+
+    AVCapture();
+    ~AVCapture();
+
+    // Starts capturing to <basePath>.ymcap and <basePath>.wav.
+    // Returns false and sets error if the output files could not be created.
+    bool Start(std::filesystem::path basePath, std::error_code &error);
+
+    // Stops capturing, waits for pending frames to be written and finalizes the output files.
+    // Returns false if any write failed during the capture.
+    bool Stop();
+
+    bool IsRunning() const {
+        return m_running.load(std::memory_order_relaxed);
+    }
+
+    // Ring buffer to be attached to the SCSP with SetSampleCaptureRingBuffer while capturing.
+    ymir::scsp::SampleRingBuffer &GetAudioRing() {
+        return m_audioRing;
+    }
+
+    // Hands over a frame to the writer thread, or drops it if all slots are in use.
+    void ReceiveFrame(const uint32 *fb, uint32 width, uint32 height);
+
+    // Gets the base path of the current or last capture.
+    const std::filesystem::path &GetBasePath() const {
+        return m_basePath;
+    }
+
+    // Gets the number of frames handed over to the writer thread in the current or last capture.
+    uint64 GetCapturedFrames() const {
+        return m_capturedFrames.load(std::memory_order_relaxed);
+    }
+
+    // Gets the number of frames dropped in the current or last capture.
+    uint64 GetDroppedFrames() const {
+        return m_droppedFrames.load(std::memory_order_relaxed);
+    }
+
+    // Gets the number of stereo samples dropped in the current or last capture.
+    uint64 GetDroppedSamples() const {
+        return m_droppedSamples.load(std::memory_order_relaxed);
+    }
+
+    int LZ4Accel = 1; // LZ4 acceleration factor (1 to 65537)
+
+private:
+    struct FrameSlot {
+        std::vector<uint32> pixels;
+        uint32 width = 0;
+        uint32 height = 0;
+        uint64 frameNumber = 0;
+        uint64 timestamp = 0;
+        uint64 audioPosition = 0;
+    };
+
+    std::atomic_bool m_running = false;
+    std::filesystem::path m_basePath;
+
+    std::array<FrameSlot, kFramePoolSize> m_slots;
+    moodycamel::ConcurrentQueue<FrameSlot *> m_freeSlots;            // Slots available to the emulator thread
+    moodycamel::BlockingConcurrentQueue<FrameSlot *> m_pendingSlots; // Slots waiting to be written; nullptr stops
+
+    std::array<sint16, kAudioRingSize * 2> m_audioBuffer{};
+    ymir::scsp::SampleRingBuffer m_audioRing{m_audioBuffer};
+
+    // Emulator thread state
+    std::chrono::steady_clock::time_point m_startTime;
+    uint64 m_frameCounter = 0;
+    uint64 m_audioPosition = 0;
+    uint64 m_baseDroppedSamples = 0;
+
+    std::atomic<uint64> m_capturedFrames = 0;
+    std::atomic<uint64> m_droppedFrames = 0;
+    std::atomic<uint64> m_droppedSamples = 0;
+
+    // Writer thread state
+    std::thread m_writerThread;
+    std::ofstream m_videoOut;
+    std::ofstream m_audioOut;
+    uint64 m_audioBytes = 0;
+    std::vector<char> m_compressBuffer;
+    std::vector<uint8> m_audioStaging;
+    std::atomic_bool m_writeError = false;
+
+    void WriterThread();
+    void WriteFrame(const FrameSlot &slot);
+    void WriteAudio();
+
+    void WriteWAVHeader();
+};
+
+} // namespace app
@@ -17,6 +17,10 @@ void SH2Tracer::ResetDMACounter(uint32 channel) {
 }
 
 void SH2Tracer::ExecuteInstruction(uint32 pc, uint16 opcode, bool delaySlot) {
+    if (traceChannel != nullptr) {
+        traceChannel->Push(debug::TraceEventType::SH2Instruction, pc, opcode, delaySlot);
+    }
+
     if (!traceInstructions) {
         return;
     }
@@ -25,6 +29,10 @@ void SH2Tracer::ExecuteInstruction(uint32 pc, uint16 opcode, bool delaySlot) {
 }
 
 void SH2Tracer::Interrupt(uint8 vecNum, uint8 level, sh2::InterruptSource source, uint32 pc) {
+    if (traceChannel != nullptr) {
+        traceChannel->Push(debug::TraceEventType::SH2Interrupt, pc, level | (static_cast<uint16>(source) << 8), vecNum);
+    }
+
     if (!traceInterrupts) {
         return;
     }
@@ -33,6 +41,10 @@ void SH2Tracer::Interrupt(uint8 vecNum, uint8 level, sh2::InterruptSource source
 }
 
 void SH2Tracer::Exception(uint8 vecNum, uint32 pc, uint32 sr) {
+    if (traceChannel != nullptr) {
+        traceChannel->Push(debug::TraceEventType::SH2Exception, pc, sr, vecNum);
+    }
+
     if (!traceExceptions) {
         return;
     }
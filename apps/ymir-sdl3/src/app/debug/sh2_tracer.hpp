@@ -1,5 +1,7 @@
 #pragma once
 
+#include <app/debug/trace_sink.hpp>
+
 #include <ymir/debug/sh2_tracer_base.hpp>
 
 #include <util/ring_buffer.hpp>
@@ -17,6 +19,10 @@ struct SH2Tracer final : ymir::debug::ISH2Tracer {
     bool traceDivisions = false;
     bool traceDMA = false;
 
+    // When set, instructions, interrupts and exceptions are also streamed into this trace channel regardless of the
+    // flags above
+    TraceSink::Channel *traceChannel = nullptr;
+
     struct InstructionInfo {
         uint32 pc;
         uint16 opcode;
@@ -112,6 +118,11 @@ private:
     // -------------------------------------------------------------------------
     // ISH2Tracer implementation
 
+    // DMA statistics count transferred bytes from DMAXferData
+    bool NeedsHotPathEvents() const final {
+        return traceInstructions || traceDMA || traceChannel != nullptr;
+    }
+
     void ExecuteInstruction(uint32 pc, uint16 opcode, bool delaySlot) final;
     void Interrupt(uint8 vecNum, uint8 level, ymir::sh2::InterruptSource source, uint32 pc) final;
     void Exception(uint8 vecNum, uint32 pc, uint32 sr) final;
@@ -0,0 +1,160 @@
+#include "trace_sink.hpp"
+
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/util/thread_name.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <span>
+#include <string>
+
+using namespace ymir;
+
+namespace app {
+
+void TraceSink::Channel::Push(debug::TraceEventType type, uint32 data, uint16 ext, uint8 param) {
+    if (m_pendingWrite - m_cachedRead >= kCapacity) [[unlikely]] {
+        WaitForSpace();
+    }
+    // The CPU cycle count only covers the current time slice while the CPU is executing, so events pushed between slices
+    // (such as frame markers) may get ahead of the next instruction; keep the stream in order for the trace index
+    m_lastCycle = std::max(m_lastCycle, m_sh2->GetProbe().GetCycleCount());
+    m_events[m_pendingWrite & kMask] = {
+        .cycle = m_lastCycle,
+        .data = data,
+        .ext = ext,
+        .type = type,
+        .param = param,
+    };
+    ++m_pendingWrite;
+    if (m_pendingWrite % kPublishInterval == 0) {
+        Publish();
+    }
+}
+
+void TraceSink::Channel::WaitForSpace() {
+    // Make sure the writer thread can see everything so that it frees up space
+    Publish();
+    m_cachedRead = m_readIndex.load(std::memory_order_acquire);
+    if (m_pendingWrite - m_cachedRead < kCapacity) {
+        return;
+    }
+    m_stalls->fetch_add(1, std::memory_order_relaxed);
+    do {
+        std::this_thread::yield();
+        m_cachedRead = m_readIndex.load(std::memory_order_acquire);
+    } while (m_pendingWrite - m_cachedRead >= kCapacity);
+}
+
+TraceSink::~TraceSink() {
+    Stop();
+}
+
+bool TraceSink::Start(std::filesystem::path path, const Saturn &saturn, std::error_code &error) {
+    error.clear();
+    if (IsRunning()) {
+        error = std::make_error_code(std::errc::device_or_resource_busy);
+        return false;
+    }
+
+    std::filesystem::create_directories(path.parent_path(), error);
+    if (error) {
+        return false;
+    }
+
+    static const std::array<std::string, kNumStreams> kStreamNames = {"Master SH-2", "Slave SH-2"};
+    if (!m_writer.Open(path, kStreamNames, error)) {
+        return false;
+    }
+
+    m_channels[kMasterSH2Stream].m_sh2 = &saturn.masterSH2;
+    m_channels[kSlaveSH2Stream].m_sh2 = &saturn.slaveSH2;
+    for (Channel &channel : m_channels) {
+        if (!channel.m_events) {
+            channel.m_events = std::make_unique<debug::TraceEvent[]>(Channel::kCapacity);
+        }
+        channel.m_stalls = &m_stalls;
+        channel.m_pendingWrite = 0;
+        channel.m_cachedRead = 0;
+        channel.m_lastCycle = 0;
+        channel.m_writeIndex.store(0, std::memory_order_relaxed);
+        channel.m_readIndex.store(0, std::memory_order_relaxed);
+    }
+
+    m_path = std::move(path);
+    m_frame = 0;
+    m_eventCount = 0;
+    m_stalls = 0;
+    m_stopRequested = false;
+    m_running = true;
+    m_writerThread = std::thread([&] { WriterThread(); });
+    return true;
+}
+
+bool TraceSink::Stop() {
+    if (!IsRunning()) {
+        return true;
+    }
+
+    for (Channel &channel : m_channels) {
+        channel.Publish();
+    }
+    m_stopRequested = true;
+    if (m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+    m_running = false;
+    return m_writer.Close();
+}
+
+void TraceSink::MarkFrame() {
+    if (!IsRunning()) {
+        return;
+    }
+
+    ++m_frame;
+    for (Channel &channel : m_channels) {
+        channel.Push(debug::TraceEventType::Frame, m_frame, 0, 0);
+        channel.Publish();
+    }
+}
+
+void TraceSink::WriterThread() {
+    util::SetCurrentThreadName("Trace writer thread");
+
+    while (!m_stopRequested.load(std::memory_order_acquire)) {
+        if (!Drain()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    // Pick up everything published before the stop request
+    Drain();
+}
+
+bool TraceSink::Drain() {
+    bool any = false;
+    for (size_t i = 0; i < kNumStreams; ++i) {
+        Channel &channel = m_channels[i];
+        const size_t readIndex = channel.m_readIndex.load(std::memory_order_relaxed);
+        const size_t writeIndex = channel.m_writeIndex.load(std::memory_order_acquire);
+        const size_t count = writeIndex - readIndex;
+        if (count == 0) {
+            continue;
+        }
+
+        const size_t pos = readIndex & Channel::kMask;
+        const size_t len1 = std::min(count, Channel::kCapacity - pos);
+        const size_t len2 = count - len1;
+        const std::span<const debug::TraceEvent> events{channel.m_events.get(), Channel::kCapacity};
+        m_writer.Write(i, events.subspan(pos, len1));
+        m_writer.Write(i, events.subspan(0, len2));
+
+        channel.m_readIndex.store(writeIndex, std::memory_order_release);
+        m_eventCount.fetch_add(count, std::memory_order_relaxed);
+        any = true;
+    }
+    return any;
+}
+
+} // namespace app
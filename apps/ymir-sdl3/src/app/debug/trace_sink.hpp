@@ -0,0 +1,135 @@
+#pragma once
+
+#include <ymir/debug/trace_file.hpp>
+
+#include <ymir/core/types.hpp>
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <system_error>
+#include <thread>
+
+// -----------------------------------------------------------------------------
+// Forward declarations
+
+namespace ymir {
+
+struct Saturn;
+
+namespace sh2 {
+    class SH2;
+} // namespace sh2
+
+} // namespace ymir
+
+// -----------------------------------------------------------------------------
+
+namespace app {
+
+// Streams debug tracer events into a compressed binary trace file (see ymir/debug/trace_file.hpp).
+//
+// Every stream is fed by a single producer thread through its own lock-free single-producer single-consumer channel.
+// A writer thread drains the channels into a ymir::debug::TraceFileWriter. Unlike the in-memory ring buffers used by
+// the debugger views, no events are ever dropped: producers wait for the writer thread whenever their channel is full.
+//
+// Start(), Stop() and MarkFrame() must be invoked from the emulator thread, which is also the producer of all streams.
+class TraceSink {
+public:
+    static constexpr uint8 kMasterSH2Stream = 0;
+    static constexpr uint8 kSlaveSH2Stream = 1;
+    static constexpr size_t kNumStreams = 2;
+
+    class Channel {
+    public:
+        static constexpr size_t kCapacity = 1u << 20; // in events; 16 MiB
+
+        // Pushes an event timestamped with the current cycle count of the SH-2 feeding the channel.
+        // Waits for the writer thread if the channel is full.
+        void Push(ymir::debug::TraceEventType type, uint32 data, uint16 ext, uint8 param);
+
+        // Makes all pushed events visible to the writer thread.
+        void Publish() {
+            m_writeIndex.store(m_pendingWrite, std::memory_order_release);
+        }
+
+    private:
+        static constexpr size_t kMask = kCapacity - 1;
+        static constexpr size_t kPublishInterval = 1024; // events pushed between automatic publishes
+
+        friend class TraceSink;
+
+        const ymir::sh2::SH2 *m_sh2 = nullptr;
+        std::unique_ptr<ymir::debug::TraceEvent[]> m_events;
+        std::atomic_uint64_t *m_stalls = nullptr;
+
+        // Producer-owned
+        alignas(64) size_t m_pendingWrite = 0;  // Events pushed but not yet published
+        size_t m_cachedRead = 0;                // Last observed read index
+        uint64 m_lastCycle = 0;                 // Cycle count of the last pushed event
+        std::atomic<size_t> m_writeIndex = 0;   // Published write index
+
+        // Consumer-owned
+        alignas(64) std::atomic<size_t> m_readIndex = 0;
+
+        void WaitForSpace();
+    };
+
+    ~TraceSink();
+
+    // Starts recording a trace to the given path, timestamping events with the cycle counts of the SH-2s of the given
+    // system.
+    // Returns false and sets error if the trace file could not be created.
+    bool Start(std::filesystem::path path, const ymir::Saturn &saturn, std::error_code &error);
+
+    // Stops recording, waits for all pending events to be written and finalizes the trace file.
+    // Returns false if any write failed during the recording.
+    bool Stop();
+
+    bool IsRunning() const {
+        return m_running.load(std::memory_order_relaxed);
+    }
+
+    // Retrieves the channel feeding the given stream.
+    Channel &GetChannel(uint8 stream) {
+        return m_channels[stream];
+    }
+
+    // Writes a frame marker to all streams and publishes pending events.
+    void MarkFrame();
+
+    // Gets the path of the current or last trace.
+    const std::filesystem::path &GetPath() const {
+        return m_path;
+    }
+
+    // Gets the number of events written in the current or last trace.
+    uint64 GetEventCount() const {
+        return m_eventCount.load(std::memory_order_relaxed);
+    }
+
+    // Gets the number of times a producer had to wait for the writer thread in the current or last trace.
+    uint64 GetStalls() const {
+        return m_stalls.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::array<Channel, kNumStreams> m_channels;
+    ymir::debug::TraceFileWriter m_writer;
+    std::filesystem::path m_path;
+    uint32 m_frame = 0;
+
+    std::thread m_writerThread;
+    std::atomic_bool m_running = false;
+    std::atomic_bool m_stopRequested = false;
+    std::atomic_uint64_t m_eventCount = 0;
+    std::atomic_uint64_t m_stalls = 0;
+
+    void WriterThread();
+
+    // Writes all published events to the trace file. Returns true if any events were written.
+    bool Drain();
+};
+
+} // namespace app
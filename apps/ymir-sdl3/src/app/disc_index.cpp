@@ -0,0 +1,114 @@
+#include "disc_index.hpp"
+
+#include <ymir/media/filesystem.hpp>
+#include <ymir/media/loader/loader.hpp>
+
+#include <ymir/util/thread_name.hpp>
+
+namespace app {
+
+DiscIndex::DiscIndex() {
+    for (auto &worker : m_workers) {
+        worker = std::thread([&] { WorkerThread(); });
+    }
+}
+
+DiscIndex::~DiscIndex() {
+    for (size_t i = 0; i < kNumWorkers; ++i) {
+        m_queue.enqueue({});
+    }
+    for (auto &worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    Save();
+}
+
+std::filesystem::path DiscIndex::CanonicalPath(const std::filesystem::path &discPath) {
+    std::error_code error{};
+    std::filesystem::path canonicalPath = std::filesystem::canonical(discPath, error);
+    return error ? discPath : canonicalPath;
+}
+
+void DiscIndex::Load(std::filesystem::path path) {
+    std::unique_lock lock{m_mutex};
+    m_index.Load(path);
+    m_indexPath = std::move(path);
+}
+
+void DiscIndex::Save() {
+    std::unique_lock lock{m_mutex};
+    if (m_index.IsDirty() && !m_indexPath.empty()) {
+        m_index.Save(m_indexPath);
+    }
+}
+
+void DiscIndex::Enqueue(std::filesystem::path discPath) {
+    FileSignature signature{};
+    std::error_code error{};
+    if (!GetFileSignature(discPath, signature, error)) {
+        return;
+    }
+    {
+        std::unique_lock lock{m_mutex};
+        if (m_index.Find(discPath, signature) != nullptr) {
+            return;
+        }
+    }
+    ++m_pending;
+    m_queue.enqueue(std::move(discPath));
+}
+
+void DiscIndex::Store(const std::filesystem::path &discPath, const ymir::media::SaturnHeader &header,
+                      ymir::XXH128Hash hash) {
+    FileSignature signature{};
+    std::error_code error{};
+    if (!GetFileSignature(discPath, signature, error)) {
+        return;
+    }
+    std::unique_lock lock{m_mutex};
+    m_index.Store(discPath, {signature, hash, {header.productNumber, header.gameTitle}});
+}
+
+std::optional<DiscIndexEntry> DiscIndex::Find(const std::filesystem::path &discPath) const {
+    std::unique_lock lock{m_mutex};
+    const FileIndexEntry *entry = m_index.Find(discPath);
+    if (entry == nullptr || entry->fields.size() < 2) {
+        return std::nullopt;
+    }
+    return DiscIndexEntry{entry->fields[0], entry->fields[1], entry->hash};
+}
+
+void DiscIndex::WorkerThread() {
+    util::SetCurrentThreadName("Disc index worker thread");
+
+    while (true) {
+        std::filesystem::path discPath{};
+        m_queue.wait_dequeue(discPath);
+        if (discPath.empty()) {
+            break;
+        }
+
+        // Capture the signature before loading so that concurrent modifications cause a rescan next time
+        FileSignature signature{};
+        std::error_code error{};
+        if (GetFileSignature(discPath, signature, error)) {
+            ymir::media::Disc disc{};
+            ymir::media::fs::Filesystem filesystem{};
+            if (ymir::media::LoadDisc(discPath, disc, ymir::media::PreloadMode::None,
+                                      [](ymir::media::MessageType, std::string) {}) &&
+                filesystem.Read(disc)) {
+                std::unique_lock lock{m_mutex};
+                m_index.Store(discPath,
+                              {signature, filesystem.GetHash(), {disc.header.productNumber, disc.header.gameTitle}});
+            }
+        }
+
+        if (--m_pending == 0) {
+            Save();
+        }
+    }
+}
+
+} // namespace app
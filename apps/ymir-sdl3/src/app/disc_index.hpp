@@ -0,0 +1,76 @@
+#pragma once
+
+#include <app/file_index.hpp>
+
+#include <ymir/media/saturn_header.hpp>
+
+#include <ymir/core/hash.hpp>
+
+#include <blockingconcurrentqueue.h>
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace app {
+
+struct DiscIndexEntry {
+    std::string productNumber;
+    std::string gameTitle;
+    ymir::XXH128Hash hash; // Filesystem hash, as used by the game database and save states
+};
+
+// Persistent index of disc image headers and hashes, keyed by canonical path, size and modification time.
+//
+// All methods take paths that have already been resolved with CanonicalPath(), so that callers can canonicalize once
+// when a path enters their lists and lookups never touch the filesystem.
+//
+// Disc images are loaded and hashed by background worker threads. Results become available through Find() as soon as
+// each image is processed, and the index is saved once the queue is drained.
+//
+// Only the file passed to Enqueue() is checked for modifications; changes to auxiliary files such as the tracks
+// referenced by a CUE sheet are not detected.
+class DiscIndex {
+public:
+    DiscIndex();
+    ~DiscIndex();
+
+    // Loads the persistent index from the given path. The index will be saved to the same path.
+    void Load(std::filesystem::path path);
+
+    // Saves the persistent index if it has been modified.
+    void Save();
+
+    // Resolves the path under which a disc image is indexed, so that an image opened through different paths maps to a
+    // single entry. Returns the given path if it cannot be resolved.
+    static std::filesystem::path CanonicalPath(const std::filesystem::path &discPath);
+
+    // Queues the disc image at the given path for indexing unless its index entry is up to date.
+    void Enqueue(std::filesystem::path discPath);
+
+    // Records the header and hash of a disc image that has already been loaded.
+    void Store(const std::filesystem::path &discPath, const ymir::media::SaturnHeader &header, ymir::XXH128Hash hash);
+
+    // Retrieves the index entry for the given disc image, if available.
+    // This is a plain lookup, cheap enough to be done every frame.
+    std::optional<DiscIndexEntry> Find(const std::filesystem::path &discPath) const;
+
+private:
+    static constexpr size_t kNumWorkers = 2;
+
+    mutable std::mutex m_mutex;
+    FileIndex m_index;
+    std::filesystem::path m_indexPath;
+
+    moodycamel::BlockingConcurrentQueue<std::filesystem::path> m_queue; // Empty path stops a worker
+    std::atomic_size_t m_pending = 0;
+    std::array<std::thread, kNumWorkers> m_workers;
+
+    void WorkerThread();
+};
+
+} // namespace app
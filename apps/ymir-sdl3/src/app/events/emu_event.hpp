@@ -1,5 +1,7 @@
 #pragma once
 
+#include "emu_fast_event.hpp"
+
 #include <ymir/hw/scsp/scsp_midi_defs.hpp>
 #include <ymir/sys/backup_ram.hpp>
 
@@ -17,13 +19,6 @@ struct EmuEvent {
         FactoryReset,
         HardReset,
         SoftReset,
-        SetResetButton,
-
-        SetPaused,
-        ForwardFrameStep,
-        ReverseFrameStep,
-        StepMSH2,
-        StepSSH2,
 
         OpenCloseTray,
         LoadDisc,
@@ -36,7 +31,10 @@ struct EmuEvent {
 
         RunFunction,
 
-        ReceiveMidiInput,
+        ReceiveMidiInput, // Only for messages too long for EmuFastEvent
+
+        FastEvent, // An EmuFastEvent that did not fit in the fast event queue
+        Wake,      // Wakes up the emulator thread while paused to process fast events
 
         SetThreadPriority,
 
@@ -46,7 +44,7 @@ struct EmuEvent {
     Type type;
 
     std::variant<std::monostate, ymir::scsp::MidiMessage, bool, std::string, std::filesystem::path,
-                 ymir::bup::BackupMemory, std::function<void(SharedContext &)>>
+                 ymir::bup::BackupMemory, std::function<void(SharedContext &)>, EmuFastEvent>
         value;
 };
 
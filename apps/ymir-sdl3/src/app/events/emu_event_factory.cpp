@@ -559,6 +559,10 @@ EmuEvent SetCDBlockLLE(bool enable) {
     });
 }
 
+EmuEvent EnableThreadedCDBlockLLE(bool enable) {
+    return RunFunction([=](SharedContext &ctx) { ctx.settings.cdblock.threadedLLE = enable; });
+}
+
 EmuEvent EnableThreadedVDP1(bool enable) {
     return RunFunction([=](SharedContext &ctx) { ctx.settings.video.threadedVDP1 = enable; });
 }
@@ -745,4 +749,72 @@ EmuEvent SaveState(uint32 slot) {
     });
 }
 
+EmuEvent StartAVCapture(std::filesystem::path basePath) {
+    return RunFunction([=](SharedContext &ctx) {
+        std::error_code error{};
+        if (!ctx.avCapture.Start(basePath, error)) {
+            devlog::warn<grp::base>("Could not start video and audio capture to {}: {}", basePath, error.message());
+            ctx.DisplayMessage(fmt::format("Could not start capture: {}", error.message()));
+            return;
+        }
+        ctx.saturn.instance->SCSP.SetSampleCaptureRingBuffer(&ctx.avCapture.GetAudioRing());
+        ctx.DisplayMessage(fmt::format("Capturing video and audio to {}", basePath));
+    });
+}
+
+EmuEvent StopAVCapture() {
+    return RunFunction([](SharedContext &ctx) {
+        if (!ctx.avCapture.IsRunning()) {
+            return;
+        }
+        ctx.saturn.instance->SCSP.SetSampleCaptureRingBuffer(nullptr);
+        const bool success = ctx.avCapture.Stop();
+        const uint64 captured = ctx.avCapture.GetCapturedFrames();
+        const uint64 dropped = ctx.avCapture.GetDroppedFrames();
+        const uint64 droppedSamples = ctx.avCapture.GetDroppedSamples();
+        devlog::info<grp::base>("Capture stopped: {} frames captured, {} frames and {} samples dropped", captured,
+                                dropped, droppedSamples);
+        const auto &basePath = ctx.avCapture.GetBasePath();
+        if (success) {
+            ctx.DisplayMessage(fmt::format("Capture saved to {} ({} frames, {} dropped)", basePath, captured, dropped));
+        } else {
+            ctx.DisplayMessage(fmt::format("Capture to {} failed: could not write to disk", basePath));
+        }
+    });
+}
+
+EmuEvent StartTraceRecording(std::filesystem::path path) {
+    return RunFunction([=](SharedContext &ctx) {
+        std::error_code error{};
+        if (!ctx.traceSink.Start(path, *ctx.saturn.instance, error)) {
+            devlog::warn<grp::base>("Could not start trace recording to {}: {}", path, error.message());
+            ctx.DisplayMessage(fmt::format("Could not start trace recording: {}", error.message()));
+            return;
+        }
+        ctx.tracers.masterSH2.traceChannel = &ctx.traceSink.GetChannel(TraceSink::kMasterSH2Stream);
+        ctx.tracers.slaveSH2.traceChannel = &ctx.traceSink.GetChannel(TraceSink::kSlaveSH2Stream);
+        ctx.DisplayMessage(fmt::format("Recording SH-2 trace to {}", path));
+    });
+}
+
+EmuEvent StopTraceRecording() {
+    return RunFunction([](SharedContext &ctx) {
+        if (!ctx.traceSink.IsRunning()) {
+            return;
+        }
+        ctx.tracers.masterSH2.traceChannel = nullptr;
+        ctx.tracers.slaveSH2.traceChannel = nullptr;
+        const bool success = ctx.traceSink.Stop();
+        const uint64 events = ctx.traceSink.GetEventCount();
+        const uint64 stalls = ctx.traceSink.GetStalls();
+        devlog::info<grp::base>("Trace recording stopped: {} events written, {} stalls", events, stalls);
+        const auto &path = ctx.traceSink.GetPath();
+        if (success) {
+            ctx.DisplayMessage(fmt::format("Trace saved to {} ({} events)", path, events));
+        } else {
+            ctx.DisplayMessage(fmt::format("Trace recording to {} failed: could not write to disk", path));
+        }
+    });
+}
+
 } // namespace app::events::emu
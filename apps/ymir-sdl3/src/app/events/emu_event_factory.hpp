@@ -8,7 +8,10 @@
 
 #include "emu_event.hpp"
 
+#include <algorithm>
+#include <cassert>
 #include <filesystem>
+#include <span>
 
 namespace app::events::emu {
 
@@ -24,28 +27,28 @@ inline EmuEvent SoftReset() {
     return {.type = EmuEvent::Type::SoftReset};
 }
 
-inline EmuEvent SetResetButton(bool resetLevel) {
-    return {.type = EmuEvent::Type::SetResetButton, .value = resetLevel};
+inline EmuFastEvent SetResetButton(bool resetLevel) {
+    return {.type = EmuFastEvent::Type::SetResetButton, .value = resetLevel};
 }
 
-inline EmuEvent SetPaused(bool paused) {
-    return {.type = EmuEvent::Type::SetPaused, .value = paused};
+inline EmuFastEvent SetPaused(bool paused) {
+    return {.type = EmuFastEvent::Type::SetPaused, .value = paused};
 }
 
-inline EmuEvent ForwardFrameStep() {
-    return {.type = EmuEvent::Type::ForwardFrameStep};
+inline EmuFastEvent ForwardFrameStep() {
+    return {.type = EmuFastEvent::Type::ForwardFrameStep};
 }
 
-inline EmuEvent ReverseFrameStep() {
-    return {.type = EmuEvent::Type::ReverseFrameStep};
+inline EmuFastEvent ReverseFrameStep() {
+    return {.type = EmuFastEvent::Type::ReverseFrameStep};
 }
 
-inline EmuEvent StepMSH2() {
-    return {.type = EmuEvent::Type::StepMSH2};
+inline EmuFastEvent StepMSH2() {
+    return {.type = EmuFastEvent::Type::StepMSH2};
 }
 
-inline EmuEvent StepSSH2() {
-    return {.type = EmuEvent::Type::StepSSH2};
+inline EmuFastEvent StepSSH2() {
+    return {.type = EmuFastEvent::Type::StepSSH2};
 }
 
 inline EmuEvent OpenCloseTray() {
@@ -80,6 +83,16 @@ inline EmuEvent ReceiveMidiInput(double deltaTime, std::vector<uint8> &&payload)
     return {.type = EmuEvent::Type::ReceiveMidiInput, .value = ymir::scsp::MidiMessage(deltaTime, std::move(payload))};
 }
 
+// The payload must be no longer than EmuFastEvent::kMaxMidiBytes; use ReceiveMidiInput for longer messages.
+inline EmuFastEvent ReceiveShortMidiInput(double deltaTime, std::span<const uint8> payload) {
+    assert(payload.size() <= EmuFastEvent::kMaxMidiBytes);
+    EmuFastEvent event{.type = EmuFastEvent::Type::ReceiveMidiInput};
+    event.midiLength = payload.size();
+    event.midiDeltaTime = deltaTime;
+    std::copy(payload.begin(), payload.end(), event.midiBytes.begin());
+    return event;
+}
+
 inline EmuEvent SetThreadPriority(bool boost) {
     return {.type = EmuEvent::Type::SetThreadPriority, .value = boost};
 }
@@ -119,6 +132,7 @@ EmuEvent LoadInternalBackupMemory();
 
 EmuEvent SetEmulateSH2Cache(bool enable);
 EmuEvent SetCDBlockLLE(bool enable);
+EmuEvent EnableThreadedCDBlockLLE(bool enable);
 
 EmuEvent EnableThreadedVDP1(bool enable);
 EmuEvent EnableThreadedVDP2(bool enable);
@@ -130,4 +144,10 @@ EmuEvent SetSCSPStepGranularity(uint32 granularity);
 EmuEvent LoadState(uint32 slot);
 EmuEvent SaveState(uint32 slot);
 
+EmuEvent StartAVCapture(std::filesystem::path basePath);
+EmuEvent StopAVCapture();
+
+EmuEvent StartTraceRecording(std::filesystem::path path);
+EmuEvent StopTraceRecording();
+
 } // namespace app::events::emu
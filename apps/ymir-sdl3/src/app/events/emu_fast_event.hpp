@@ -0,0 +1,37 @@
+#pragma once
+
+#include <ymir/core/types.hpp>
+
+#include <array>
+#include <type_traits>
+
+namespace app {
+
+// Small, frequent emulator events that are delivered through a lock-free fixed-size queue instead of the general
+// EmuEvent queue. These never allocate memory.
+struct EmuFastEvent {
+    enum class Type : uint8 {
+        SetResetButton,
+
+        SetPaused,
+        ForwardFrameStep,
+        ReverseFrameStep,
+        StepMSH2,
+        StepSSH2,
+
+        ReceiveMidiInput,
+    };
+
+    // Maximum MIDI message length that fits in a fast event. Longer messages (e.g. SysEx) go through EmuEvent.
+    static constexpr size_t kMaxMidiBytes = 13;
+
+    Type type;
+    bool value = false; // SetResetButton, SetPaused
+    uint8 midiLength = 0;
+    std::array<uint8, kMaxMidiBytes> midiBytes{};
+    double midiDeltaTime = 0.0;
+};
+static_assert(std::is_trivially_copyable_v<EmuFastEvent>);
+static_assert(sizeof(EmuFastEvent) == 24);
+
+} // namespace app
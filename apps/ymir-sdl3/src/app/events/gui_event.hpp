@@ -82,6 +82,7 @@ struct GUIEvent {
         CheckForUpdates,
 
         TakeScreenshot,
+        ToggleAVCapture,
 
         // Emulator notifications
 
@@ -111,6 +111,10 @@ inline GUIEvent TakeScreenshot() {
     return {.type = GUIEvent::Type::TakeScreenshot};
 }
 
+inline GUIEvent ToggleAVCapture() {
+    return {.type = GUIEvent::Type::ToggleAVCapture};
+}
+
 inline GUIEvent StateLoaded(uint32 slot) {
     return {.type = GUIEvent::Type::StateLoaded, .value = slot};
 }
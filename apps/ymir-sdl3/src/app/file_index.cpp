@@ -0,0 +1,170 @@
+#include "file_index.hpp"
+
+#include <ymir/util/data_ops.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+
+namespace app {
+
+// Index file format (all values little-endian):
+//   char[8]  magic = "YMIRFIDX"
+//   uint32   version = 1
+//   One record per entry until the end of the file:
+//     uint16   path length, followed by the UTF-8 path
+//     uint64   file size
+//     sint64   file modification time
+//     uint8[16] hash
+//     uint8    number of fields, each one a uint16 length followed by the field contents
+static constexpr std::array<char, 8> kMagic = {'Y', 'M', 'I', 'R', 'F', 'I', 'D', 'X'};
+static constexpr uint32 kVersion = 1;
+
+namespace {
+
+template <typename T>
+void WriteValue(std::ostream &out, T value) {
+    std::array<uint8, sizeof(T)> buf{};
+    util::WriteLE<T>(buf.data(), value);
+    out.write(reinterpret_cast<const char *>(buf.data()), buf.size());
+}
+
+template <typename T>
+bool ReadValue(std::istream &in, T &value) {
+    std::array<uint8, sizeof(T)> buf{};
+    if (!in.read(reinterpret_cast<char *>(buf.data()), buf.size())) {
+        return false;
+    }
+    value = util::ReadLE<T>(buf.data());
+    return true;
+}
+
+void WriteString(std::ostream &out, std::string_view str) {
+    const auto len = static_cast<uint16>(std::min<size_t>(str.size(), 0xFFFF));
+    WriteValue<uint16>(out, len);
+    out.write(str.data(), len);
+}
+
+bool ReadString(std::istream &in, std::string &str) {
+    uint16 len{};
+    if (!ReadValue(in, len)) {
+        return false;
+    }
+    str.resize(len);
+    return static_cast<bool>(in.read(str.data(), len));
+}
+
+} // namespace
+
+bool GetFileSignature(const std::filesystem::path &path, FileSignature &signature, std::error_code &error) {
+    signature.size = std::filesystem::file_size(path, error);
+    if (error) {
+        return false;
+    }
+    const auto modTime = std::filesystem::last_write_time(path, error);
+    if (error) {
+        return false;
+    }
+    signature.modTime = modTime.time_since_epoch().count();
+    return true;
+}
+
+bool FileIndex::Load(const std::filesystem::path &path) {
+    m_entries.clear();
+    m_dirty = false;
+
+    std::ifstream in{path, std::ios::binary};
+    if (!in) {
+        return false;
+    }
+
+    std::array<char, 8> magic{};
+    uint32 version{};
+    if (!in.read(magic.data(), magic.size()) || magic != kMagic || !ReadValue(in, version) || version != kVersion) {
+        return false;
+    }
+
+    while (in.peek() != std::char_traits<char>::eof()) {
+        std::string pathStr;
+        FileIndexEntry entry{};
+        uint64 size{};
+        uint8 numFields{};
+        if (!ReadString(in, pathStr) || !ReadValue(in, size) || !ReadValue(in, entry.signature.modTime) ||
+            !in.read(reinterpret_cast<char *>(entry.hash.data()), entry.hash.size()) || !ReadValue(in, numFields)) {
+            // Truncated file; discard everything to be safe
+            m_entries.clear();
+            return false;
+        }
+        entry.signature.size = size;
+        entry.fields.resize(numFields);
+        for (auto &field : entry.fields) {
+            if (!ReadString(in, field)) {
+                m_entries.clear();
+                return false;
+            }
+        }
+
+        const std::u8string u8path{pathStr.begin(), pathStr.end()};
+        m_entries.insert_or_assign(std::filesystem::path{u8path}.native(), std::move(entry));
+    }
+    return true;
+}
+
+bool FileIndex::Save(const std::filesystem::path &path) {
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    if (!out) {
+        return false;
+    }
+
+    out.write(kMagic.data(), kMagic.size());
+    WriteValue<uint32>(out, kVersion);
+    for (const auto &[filePath, entry] : m_entries) {
+        const std::u8string u8path = std::filesystem::path{filePath}.u8string();
+        WriteString(out, {reinterpret_cast<const char *>(u8path.data()), u8path.size()});
+        WriteValue<uint64>(out, entry.signature.size);
+        WriteValue<sint64>(out, entry.signature.modTime);
+        out.write(reinterpret_cast<const char *>(entry.hash.data()), entry.hash.size());
+        const auto numFields = static_cast<uint8>(std::min<size_t>(entry.fields.size(), 0xFF));
+        WriteValue<uint8>(out, numFields);
+        for (size_t i = 0; i < numFields; ++i) {
+            WriteString(out, entry.fields[i]);
+        }
+    }
+
+    out.close();
+    if (out.fail()) {
+        return false;
+    }
+    m_dirty = false;
+    return true;
+}
+
+const FileIndexEntry *FileIndex::Find(const std::filesystem::path &path, const FileSignature &signature) const {
+    const FileIndexEntry *entry = Find(path);
+    if (entry == nullptr || entry->signature != signature) {
+        return nullptr;
+    }
+    return entry;
+}
+
+const FileIndexEntry *FileIndex::Find(const std::filesystem::path &path) const {
+    if (auto it = m_entries.find(path.native()); it != m_entries.end()) {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+void FileIndex::Store(const std::filesystem::path &path, FileIndexEntry entry) {
+    m_entries.insert_or_assign(path.native(), std::move(entry));
+    m_dirty = true;
+}
+
+void FileIndex::EraseIf(std::function<bool(const std::filesystem::path &, const FileIndexEntry &)> pred) {
+    const size_t erased =
+        std::erase_if(m_entries, [&](const auto &pair) { return pred(std::filesystem::path{pair.first}, pair.second); });
+    if (erased > 0) {
+        m_dirty = true;
+    }
+}
+
+} // namespace app
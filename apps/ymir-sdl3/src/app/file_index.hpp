@@ -0,0 +1,70 @@
+#pragma once
+
+#include <ymir/core/hash.hpp>
+#include <ymir/core/types.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace app {
+
+// Identifies a specific version of a file on disk without reading its contents.
+struct FileSignature {
+    uintmax_t size = 0;
+    sint64 modTime = 0;
+
+    bool operator==(const FileSignature &) const = default;
+};
+
+// Retrieves the signature of the given file.
+// Returns false and sets error if the file could not be inspected.
+bool GetFileSignature(const std::filesystem::path &path, FileSignature &signature, std::error_code &error);
+
+struct FileIndexEntry {
+    FileSignature signature;
+    ymir::XXH128Hash hash;
+    std::vector<std::string> fields; // Additional information extracted from the file, depending on its type
+};
+
+// Persistent cache of hashes and other information extracted from files, keyed by path.
+// Entries are considered valid as long as the file's size and modification time match the recorded signature, which
+// allows rescans to skip reading and hashing files that haven't changed.
+//
+// This class is not thread-safe.
+class FileIndex {
+public:
+    // Loads the index from the given file, replacing all entries.
+    // Returns false if the file does not exist or is not a valid index, in which case the index is left empty.
+    bool Load(const std::filesystem::path &path);
+
+    // Saves the index to the given file.
+    // Returns false if the file could not be written.
+    bool Save(const std::filesystem::path &path);
+
+    // Finds the entry for the given path if it matches the signature.
+    const FileIndexEntry *Find(const std::filesystem::path &path, const FileSignature &signature) const;
+
+    // Finds the entry for the given path regardless of its signature.
+    const FileIndexEntry *Find(const std::filesystem::path &path) const;
+
+    // Adds or replaces the entry for the given path.
+    void Store(const std::filesystem::path &path, FileIndexEntry entry);
+
+    // Removes all entries that match the predicate.
+    void EraseIf(std::function<bool(const std::filesystem::path &, const FileIndexEntry &)> pred);
+
+    // Determines if the index has been modified since it was last loaded or saved.
+    bool IsDirty() const {
+        return m_dirty;
+    }
+
+private:
+    // Keyed by the native path string; std::hash<std::filesystem::path> is missing from some standard libraries
+    std::unordered_map<std::filesystem::path::string_type, FileIndexEntry> m_entries;
+    bool m_dirty = false;
+};
+
+} // namespace app
@@ -18,6 +18,7 @@ const std::filesystem::path kPathSuffixes[] = {
     "savestates",                                 // SaveStates
     "dumps",                                      // Dumps
     "screenshots",                                // Screenshots
+    "captures",                                   // Captures
 };
 
 Profile::Profile() {
@@ -16,6 +16,7 @@ enum class ProfilePath {
     SaveStates,       // Save states            <profile>/savestates/
     Dumps,            // Memory dumps           <profile>/dumps/
     Screenshots,      // Screenshots            <profile>/screenshots/
+    Captures,         // Video/audio captures   <profile>/captures/
 
     _Count,
 };
@@ -4,129 +4,185 @@
 #include <ymir/hw/sh1/sh1_defs.hpp>
 #include <ymir/sys/memory_defs.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
-#include <iostream>
+#include <thread>
+#include <unordered_set>
 
 using namespace ymir;
 
 namespace app {
 
-void ROMManager::ScanIPLROMs(std::filesystem::path path) {
-    std::vector<char> buf{};
-    buf.resize(sys::kIPLSize);
+void ROMManager::LoadIndex(std::filesystem::path path) {
+    m_index.Load(path);
+    m_indexPath = std::move(path);
+}
 
-    m_iplEntries.clear();
+void ROMManager::SaveIndex() {
+    if (m_index.IsDirty() && !m_indexPath.empty()) {
+        m_index.Save(m_indexPath);
+    }
+}
 
-    for (const std::filesystem::directory_entry &dirEntry : std::filesystem::recursive_directory_iterator(path)) {
-        if (!dirEntry.is_regular_file()) {
-            continue;
-        }
-        if (dirEntry.file_size() != sys::kIPLSize) {
-            continue;
-        }
+void ROMManager::ScanIPLROMs(std::filesystem::path path) {
+    m_iplEntries.clear();
 
-        // Read file into buffer
-        std::filesystem::path canonicalPath = std::filesystem::canonical(dirEntry.path());
-        {
-            std::ifstream in{canonicalPath, std::ios::binary};
-            in.read(buf.data(), buf.size());
-            if (!in) {
-                continue;
-            }
-        }
+    std::error_code err{};
+    auto files = ScanFiles(
+        path, sys::kIPLSize, sys::kIPLHashSeed,
+        [](std::span<const char> data) {
+            // Get version string
+            return std::vector<std::string>{std::string(data.begin() + 0x800, data.begin() + 0x810)};
+        },
+        err);
 
+    for (auto &file : files) {
         // Build entry
         IPLROMEntry entry{};
-        entry.path = canonicalPath;
+        entry.path = file.path;
 
         // Get database entry
-        XXH128Hash hash = CalcHash128(buf.data(), buf.size(), sys::kIPLHashSeed);
-        entry.info = db::GetIPLROMInfo(hash);
-        entry.hash = hash;
+        entry.info = db::GetIPLROMInfo(file.hash);
+        entry.hash = file.hash;
 
-        // Get version string
-        entry.versionString.assign(buf.begin() + 0x800, buf.begin() + 0x810);
+        if (!file.fields.empty()) {
+            entry.versionString = file.fields[0];
+        }
 
         // Add it to the list (including unknown entries, in case the image is modified)
-        m_iplEntries.insert({canonicalPath, entry});
+        m_iplEntries.insert({file.path, entry});
     }
 }
 
 void ROMManager::ScanCDBlockROMs(std::filesystem::path path) {
-    std::vector<char> buf{};
-    buf.resize(sh1::kROMSize);
-
     m_cdbEntries.clear();
 
-    for (const std::filesystem::directory_entry &dirEntry : std::filesystem::recursive_directory_iterator(path)) {
-        if (!dirEntry.is_regular_file()) {
-            continue;
-        }
-        if (dirEntry.file_size() != sh1::kROMSize) {
-            continue;
-        }
-
-        // Read file into buffer
-        std::filesystem::path canonicalPath = std::filesystem::canonical(dirEntry.path());
-        {
-            std::ifstream in{canonicalPath, std::ios::binary};
-            in.read(buf.data(), buf.size());
-            if (!in) {
-                continue;
-            }
-        }
+    std::error_code err{};
+    auto files = ScanFiles(path, sh1::kROMSize, sh1::kROMHashSeed, nullptr, err);
 
+    for (auto &file : files) {
         // Build entry
         CDBlockROMEntry entry{};
-        entry.path = canonicalPath;
+        entry.path = file.path;
 
         // Get database entry
-        XXH128Hash hash = CalcHash128(buf.data(), buf.size(), sh1::kROMHashSeed);
-        entry.info = db::GetCDBlockROMInfo(hash);
-        entry.hash = hash;
+        entry.info = db::GetCDBlockROMInfo(file.hash);
+        entry.hash = file.hash;
 
         // Add it to the list (including unknown entries, in case the image is modified)
-        m_cdbEntries.insert({canonicalPath, entry});
+        m_cdbEntries.insert({file.path, entry});
     }
 }
 
 void ROMManager::ScanROMCarts(std::filesystem::path path, std::error_code &err) {
-    std::vector<char> buf{};
-    buf.resize(cart::kROMCartSize);
-
     m_cartEntries.clear();
+
+    auto files = ScanFiles(path, cart::kROMCartSize, cart::kROMCartHashSeed, nullptr, err);
+
+    for (auto &file : files) {
+        // Build entry
+        ROMCartEntry entry{};
+        entry.path = file.path;
+
+        // Get database entry
+        entry.info = db::GetROMCartInfo(file.hash);
+        entry.hash = file.hash;
+
+        // Add it to the list (including unknown entries, in case the image is modified)
+        m_cartEntries.insert({file.path, entry});
+    }
+}
+
+std::vector<ROMManager::ScannedFile> ROMManager::ScanFiles(const std::filesystem::path &path, uintmax_t size,
+                                                           uint64 hashSeed, FieldExtractor extractFields,
+                                                           std::error_code &err) {
     err.clear();
 
+    // Collect candidates by size, reusing index entries for files that haven't changed since the last scan
+    std::vector<ScannedFile> files{};
+    std::vector<std::pair<size_t, FileSignature>> pending{};
     for (const std::filesystem::directory_entry &dirEntry : std::filesystem::recursive_directory_iterator(path, err)) {
         if (!dirEntry.is_regular_file()) {
             continue;
         }
-        if (dirEntry.file_size() != cart::kROMCartSize) {
+        if (dirEntry.file_size() != size) {
             continue;
         }
 
-        // Read file into buffer
-        std::filesystem::path canonicalPath = std::filesystem::canonical(dirEntry.path());
+        std::error_code fileErr{};
+        std::filesystem::path canonicalPath = std::filesystem::canonical(dirEntry.path(), fileErr);
+        FileSignature signature{};
+        if (fileErr || !GetFileSignature(canonicalPath, signature, fileErr)) {
+            continue;
+        }
+
+        if (const FileIndexEntry *indexEntry = m_index.Find(canonicalPath, signature)) {
+            files.push_back({canonicalPath, indexEntry->hash, indexEntry->fields});
+        } else {
+            pending.push_back({files.size(), signature});
+            files.push_back({canonicalPath, {}, {}});
+        }
+    }
+
+    // Read and hash new or modified files in parallel
+    if (!pending.empty()) {
+        std::vector<uint8> valid(pending.size(), false);
+        std::atomic_size_t nextIndex = 0;
+        auto worker = [&] {
+            std::vector<char> buf{};
+            buf.resize(size);
+            for (size_t i = nextIndex++; i < pending.size(); i = nextIndex++) {
+                ScannedFile &file = files[pending[i].first];
+                {
+                    std::ifstream in{file.path, std::ios::binary};
+                    in.read(buf.data(), buf.size());
+                    if (!in) {
+                        continue;
+                    }
+                }
+                file.hash = CalcHash128(buf.data(), buf.size(), hashSeed);
+                if (extractFields != nullptr) {
+                    file.fields = extractFields(buf);
+                }
+                valid[i] = true;
+            }
+        };
+
         {
-            std::ifstream in{canonicalPath, std::ios::binary};
-            in.read(buf.data(), buf.size());
-            if (!in) {
-                continue;
+            const size_t numThreads =
+                std::min<size_t>(pending.size(), std::max(std::thread::hardware_concurrency(), 1u));
+            std::vector<std::jthread> threads{};
+            for (size_t i = 1; i < numThreads; ++i) {
+                threads.emplace_back(worker);
             }
+            worker();
         }
 
-        // Build entry
-        ROMCartEntry entry{};
-        entry.path = canonicalPath;
-
-        // Get database entry
-        XXH128Hash hash = CalcHash128(buf.data(), buf.size(), cart::kROMCartHashSeed);
-        entry.info = db::GetROMCartInfo(hash);
-        entry.hash = hash;
+        // Update index and drop files that could not be read
+        for (size_t i = 0; i < pending.size(); ++i) {
+            const ScannedFile &file = files[pending[i].first];
+            if (valid[i]) {
+                m_index.Store(file.path, {pending[i].second, file.hash, file.fields});
+            }
+        }
+        for (size_t i = pending.size(); i > 0; --i) {
+            if (!valid[i - 1]) {
+                files.erase(files.begin() + pending[i - 1].first);
+            }
+        }
+    }
 
-        // Add it to the list (including unknown entries, in case the image is modified)
-        m_cartEntries.insert({canonicalPath, entry});
+    // Forget files of this size that are no longer present
+    std::unordered_set<std::filesystem::path::string_type> seen{};
+    for (const auto &file : files) {
+        seen.insert(file.path.native());
     }
+    m_index.EraseIf([&](const std::filesystem::path &filePath, const FileIndexEntry &entry) {
+        return entry.signature.size == size && !seen.contains(filePath.native());
+    });
+
+    return files;
 }
 
 } // namespace app
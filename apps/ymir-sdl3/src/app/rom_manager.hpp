@@ -1,5 +1,7 @@
 #pragma once
 
+#include <app/file_index.hpp>
+
 #include <ymir/db/cdb_rom_db.hpp>
 #include <ymir/db/ipl_db.hpp>
 #include <ymir/db/rom_cart_db.hpp>
@@ -7,7 +9,10 @@
 #include <ymir/core/types.hpp>
 
 #include <filesystem>
+#include <span>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace app {
 
@@ -30,8 +35,18 @@ struct ROMCartEntry {
     ymir::XXH128Hash hash;
 };
 
+// Keeps track of the ROM images found in the profile folders.
+//
+// Scan results are cached in a persistent index keyed by path, size and modification time, so that rescans only read and
+// hash new or modified files. Those are hashed in parallel on a group of worker threads.
 class ROMManager {
 public:
+    // Loads the persistent index from the given path. The index will be saved to the same path by SaveIndex().
+    void LoadIndex(std::filesystem::path path);
+
+    // Saves the persistent index if it has been modified by a scan.
+    void SaveIndex();
+
     // Scans the given path recursively for IPL ROM files.
     void ScanIPLROMs(std::filesystem::path path);
 
@@ -57,6 +72,21 @@ public:
     }
 
 private:
+    struct ScannedFile {
+        std::filesystem::path path;
+        ymir::XXH128Hash hash;
+        std::vector<std::string> fields;
+    };
+
+    using FieldExtractor = std::vector<std::string> (*)(std::span<const char> data);
+
+    // Scans the given path recursively for files of the given size, hashing those that are not up to date in the index.
+    std::vector<ScannedFile> ScanFiles(const std::filesystem::path &path, uintmax_t size, uint64 hashSeed,
+                                       FieldExtractor extractFields, std::error_code &err);
+
+    FileIndex m_index;
+    std::filesystem::path m_indexPath;
+
     std::unordered_map<std::filesystem::path, IPLROMEntry> m_iplEntries;
     std::unordered_map<std::filesystem::path, CDBlockROMEntry> m_cdbEntries;
     std::unordered_map<std::filesystem::path, ROMCartEntry> m_cartEntries;
@@ -474,6 +474,7 @@ Settings::Settings(SharedContext &sharedCtx) noexcept
     mapInput(m_actionInputs, hotkeys.toggleWindowedVideoOutput);
     mapInput(m_actionInputs, hotkeys.toggleFullScreen);
     mapInput(m_actionInputs, hotkeys.takeScreenshot);
+    mapInput(m_actionInputs, hotkeys.toggleAVCapture);
     mapInput(m_actionInputs, hotkeys.exitApp);
 
     mapInput(m_actionInputs, hotkeys.toggleFrameRateOSD);
@@ -656,6 +657,7 @@ void Settings::ResetToDefaults() {
     using namespace ymir::core;
 
     general.preloadDiscImagesToRAM = false;
+    general.compressPreloadedDiscImages = false;
     general.rememberLastLoadedDisc = false;
     general.boostEmuThreadPriority = true;
     general.boostProcessPriority = true;
@@ -727,6 +729,7 @@ void Settings::ResetToDefaults() {
     input.gamepad.lsDeadzone = 0.15f;
     input.gamepad.rsDeadzone = 0.15f;
     input.gamepad.analogToDigitalSensitivity = 0.20f;
+    input.latePolling = false;
 
     video.forceIntegerScaling = false;
     video.forceAspectRatio = true;
@@ -747,6 +750,7 @@ void Settings::ResetToDefaults() {
 
     audio.volume = 0.8;
     audio.mute = false;
+    audio.dynamicRateControl = false;
 
     audio.interpolation = config::audio::SampleInterpolationMode::Linear;
 
@@ -766,6 +770,8 @@ void Settings::ResetToDefaults() {
 
     cdblock.readSpeedFactor = 2;
     cdblock.useLLE = false;
+    cdblock.readAhead = true;
+    cdblock.threadedLLE = false;
     cdblock.overrideROM = false;
     cdblock.romPath = "";
 }
@@ -788,6 +794,8 @@ void Settings::BindConfiguration(ymir::core::Configuration &config) {
 
     cdblock.readSpeedFactor.Observe([&](auto value) { config.cdblock.readSpeedFactor = value; });
     cdblock.useLLE.Observe([&](auto value) { m_context.EnqueueEvent(events::emu::SetCDBlockLLE(value)); });
+    cdblock.readAhead.Observe([&](auto value) { config.cdblock.readAhead = value; });
+    cdblock.threadedLLE.Observe([&](auto value) { config.cdblock.threadedLLE = value; });
 }
 
 SettingsLoadResult Settings::Load(const std::filesystem::path &path) {
@@ -829,6 +837,7 @@ SettingsLoadResult Settings::Load(const std::filesystem::path &path) {
 
     if (auto tblGeneral = data["General"]) {
         Parse(tblGeneral, "PreloadDiscImagesToRAM", general.preloadDiscImagesToRAM);
+        Parse(tblGeneral, "CompressPreloadedDiscImages", general.compressPreloadedDiscImages);
         Parse(tblGeneral, "RememberLastLoadedDisc", general.rememberLastLoadedDisc);
         Parse(tblGeneral, "BoostEmuThreadPriority", general.boostEmuThreadPriority);
         Parse(tblGeneral, "BoostProcessPriority", general.boostProcessPriority);
@@ -865,6 +874,7 @@ SettingsLoadResult Settings::Load(const std::filesystem::path &path) {
             parse("SaveStates", ProfilePath::SaveStates);
             parse("Dumps", ProfilePath::Dumps);
             parse("Screenshots", ProfilePath::Screenshots);
+            parse("Captures", ProfilePath::Captures);
         }
     }
 
@@ -911,6 +921,7 @@ SettingsLoadResult Settings::Load(const std::filesystem::path &path) {
         Parse(tblHotkeys, "ToggleWindowedVideoOutput", hotkeys.toggleWindowedVideoOutput);
         Parse(tblHotkeys, "ToggleFullScreen", hotkeys.toggleFullScreen);
         Parse(tblHotkeys, "TakeScreenshot", hotkeys.takeScreenshot);
+        Parse(tblHotkeys, "ToggleAVCapture", hotkeys.toggleAVCapture);
         Parse(tblHotkeys, "ExitApp", hotkeys.exitApp);
         Parse(tblHotkeys, "ToggleFrameRateOSD", hotkeys.toggleFrameRateOSD);
         Parse(tblHotkeys, "NextFrameRateOSDPosition", hotkeys.nextFrameRateOSDPos);
@@ -1116,6 +1127,7 @@ SettingsLoadResult Settings::Load(const std::filesystem::path &path) {
         Parse(tblInput, "GamepadLSDeadzone", input.gamepad.lsDeadzone);
         Parse(tblInput, "GamepadRSDeadzone", input.gamepad.rsDeadzone);
         Parse(tblInput, "GamepadAnalogToDigitalSensitivity", input.gamepad.analogToDigitalSensitivity);
+        Parse(tblInput, "LatePolling", input.latePolling);
     }
 
     if (auto tblVideo = data["Video"]) {
@@ -1154,6 +1166,7 @@ SettingsLoadResult Settings::Load(const std::filesystem::path &path) {
 
         Parse(tblAudio, "Volume", audio.volume);
         Parse(tblAudio, "Mute", audio.mute);
+        Parse(tblAudio, "DynamicRateControl", audio.dynamicRateControl);
 
         Parse(tblAudio, "StepGranularity", stepGranularity);
 
@@ -1190,6 +1203,8 @@ SettingsLoadResult Settings::Load(const std::filesystem::path &path) {
     if (auto tblCDBlock = data["CDBlock"]) {
         Parse(tblCDBlock, "ReadSpeed", cdblock.readSpeedFactor);
         Parse(tblCDBlock, "UseLLE", cdblock.useLLE);
+        Parse(tblCDBlock, "ReadAhead", cdblock.readAhead);
+        Parse(tblCDBlock, "ThreadedLLE", cdblock.threadedLLE);
         Parse(tblCDBlock, "OverrideROM", cdblock.overrideROM);
         Parse(tblCDBlock, "ROMPath", cdblock.romPath);
         cdblock.romPath = Absolute(ProfilePath::CDBlockROMImages, cdblock.romPath);
@@ -1210,6 +1225,7 @@ SettingsSaveResult Settings::Save() {
 
         {"General", toml::table{{
             {"PreloadDiscImagesToRAM", general.preloadDiscImagesToRAM},
+            {"CompressPreloadedDiscImages", general.compressPreloadedDiscImages},
             {"RememberLastLoadedDisc", general.rememberLastLoadedDisc},
             {"BoostEmuThreadPriority", general.boostEmuThreadPriority},
             {"BoostProcessPriority", general.boostProcessPriority},
@@ -1233,6 +1249,7 @@ SettingsSaveResult Settings::Save() {
                 {"SaveStates", m_context.profile.GetPathOverride(ProfilePath::SaveStates).native()},
                 {"Dumps", m_context.profile.GetPathOverride(ProfilePath::Dumps).native()},
                 {"Screenshots", m_context.profile.GetPathOverride(ProfilePath::Screenshots).native()},
+                {"Captures", m_context.profile.GetPathOverride(ProfilePath::Captures).native()},
             }}},
         }}},
 
@@ -1274,6 +1291,7 @@ SettingsSaveResult Settings::Save() {
             {"ToggleWindowedVideoOutput", ToTOML(hotkeys.toggleWindowedVideoOutput)},
             {"ToggleFullScreen", ToTOML(hotkeys.toggleFullScreen)},
             {"TakeScreenshot", ToTOML(hotkeys.takeScreenshot)},
+            {"ToggleAVCapture", ToTOML(hotkeys.toggleAVCapture)},
             {"ExitApp", ToTOML(hotkeys.exitApp)},
             {"ToggleFrameRateOSD", ToTOML(hotkeys.toggleFrameRateOSD)},
             {"NextFrameRateOSDPosition", ToTOML(hotkeys.nextFrameRateOSDPos)},
@@ -1541,6 +1559,7 @@ SettingsSaveResult Settings::Save() {
             {"GamepadLSDeadzone", input.gamepad.lsDeadzone.Get()},
             {"GamepadRSDeadzone", input.gamepad.rsDeadzone.Get()},
             {"GamepadAnalogToDigitalSensitivity", input.gamepad.analogToDigitalSensitivity.Get()},
+            {"LatePolling", input.latePolling},
         }}},
 
         {"Video", toml::table{{
@@ -1565,6 +1584,7 @@ SettingsSaveResult Settings::Save() {
         {"Audio", toml::table{{
             {"Volume", audio.volume.Get()},
             {"Mute", audio.mute.Get()},
+            {"DynamicRateControl", audio.dynamicRateControl.Get()},
             {"StepGranularity", audio.stepGranularity.Get()},
             {"MidiInputPortId", audio.midiInputPort.Get().id},
             {"MidiOutputPortId", audio.midiOutputPort.Get().id},
@@ -1592,6 +1612,8 @@ SettingsSaveResult Settings::Save() {
         {"CDBlock", toml::table{{
             {"ReadSpeed", cdblock.readSpeedFactor.Get()},
             {"UseLLE", cdblock.useLLE.Get()},
+            {"ReadAhead", cdblock.readAhead.Get()},
+            {"ThreadedLLE", cdblock.threadedLLE.Get()},
             {"OverrideROM", cdblock.overrideROM},
             {"ROMPath", Proximate(ProfilePath::CDBlockROMImages, cdblock.romPath).native()},
         }}},
@@ -1815,6 +1837,7 @@ std::unordered_set<input::MappedAction> Settings::ResetHotkeys() {
     rebindCtx.Rebind(hotkeys.toggleWindowedVideoOutput, {KeyCombo{Mod::None, Key::F9}});
     rebindCtx.Rebind(hotkeys.toggleFullScreen, {KeyCombo{Mod::Alt, Key::Return}});
     rebindCtx.Rebind(hotkeys.takeScreenshot, {KeyCombo{Key::F12}});
+    rebindCtx.Rebind(hotkeys.toggleAVCapture, {KeyCombo{Mod::Shift, Key::F12}});
     rebindCtx.Rebind(hotkeys.exitApp, {}); // Alt+F4 is always recognized, no need to bind it here
 
     rebindCtx.Rebind(hotkeys.toggleFrameRateOSD, {KeyCombo{Mod::Shift, Key::F1}});
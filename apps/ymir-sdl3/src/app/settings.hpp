@@ -135,6 +135,7 @@ struct Settings {
 
     struct General {
         bool preloadDiscImagesToRAM;
+        bool compressPreloadedDiscImages;
         bool rememberLastLoadedDisc;
 
         bool boostEmuThreadPriority;
@@ -199,6 +200,7 @@ struct Settings {
         input::InputBind toggleWindowedVideoOutput{actions::general::ToggleWindowedVideoOutput};
         input::InputBind toggleFullScreen{actions::general::ToggleFullScreen};
         input::InputBind takeScreenshot{actions::general::TakeScreenshot};
+        input::InputBind toggleAVCapture{actions::general::ToggleAVCapture};
         input::InputBind exitApp{actions::general::ExitApp};
 
         input::InputBind toggleFrameRateOSD{actions::view::ToggleFrameRateOSD};
@@ -384,6 +386,9 @@ struct Settings {
             util::Observable<float> analogToDigitalSensitivity;
         } gamepad;
 
+        // Keep polling input devices while the emulator runs a frame so that games read the freshest inputs.
+        // Only effective with video sync.
+        bool latePolling;
     } input;
 
     struct Video {
@@ -421,6 +426,7 @@ struct Settings {
 
         util::Observable<float> volume;
         util::Observable<bool> mute;
+        util::Observable<bool> dynamicRateControl;
 
         util::Observable<ymir::core::config::audio::SampleInterpolationMode> interpolation;
         util::Observable<bool> threadedSCSP;
@@ -457,6 +463,8 @@ struct Settings {
     struct CDBlock {
         util::Observable<uint8> readSpeedFactor;
         util::Observable<bool> useLLE;
+        util::Observable<bool> readAhead;
+        util::Observable<bool> threadedLLE;
 
         bool overrideROM;
         std::filesystem::path romPath;
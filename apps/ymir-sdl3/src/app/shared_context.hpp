@@ -1,6 +1,8 @@
 #pragma once
 
 #include <app/audio_system.hpp>
+#include <app/av_capture.hpp>
+#include <app/disc_index.hpp>
 #include <app/message.hpp>
 #include <app/profile.hpp>
 #include <app/rewind_buffer.hpp>
@@ -16,15 +18,20 @@
 #include <app/debug/scsp_tracer.hpp>
 #include <app/debug/scu_tracer.hpp>
 #include <app/debug/sh2_tracer.hpp>
+#include <app/debug/trace_sink.hpp>
 #include <app/debug/ygr_tracer.hpp>
 
 #include <app/events/emu_event.hpp>
+#include <app/events/emu_fast_event.hpp>
 #include <app/events/gui_event.hpp>
 
 #include <app/services/savestates/ISaveStateService.hpp>
 
+#include <util/bounded_mpsc_queue.hpp>
 #include <util/deprecation_helpers.hpp>
+#include <util/triple_buffer.hpp>
 
+#include <ymir/hw/smpc/peripheral/peripheral_report.hpp>
 #include <ymir/hw/smpc/peripheral/peripheral_state_common.hpp>
 
 #include <ymir/util/dev_log.hpp>
@@ -39,6 +46,7 @@
 #include <rtmidi/RtMidi.h>
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <deque>
 #include <filesystem>
@@ -291,7 +299,7 @@ struct SharedContext {
         }
     } emuSpeed;
 
-    bool paused = false;
+    std::atomic_bool paused = false;
 
     input::InputContext inputContext;
 
@@ -467,6 +475,19 @@ struct SharedContext {
     std::array<ArcadeRacerInput, 2> arcadeRacerInputs;
     std::array<MissionStickInput, 2> missionStickInputs;
 
+    // Peripheral reports built from the inputs above by the GUI thread and read by the emulator thread whenever the
+    // SMPC reads the peripheral ports
+    struct PeripheralReports {
+        struct Port {
+            ymir::peripheral::ControlPadReport controlPad;
+            ymir::peripheral::AnalogPadReport analogPad;
+            ymir::peripheral::ArcadeRacerReport arcadeRacer;
+            ymir::peripheral::MissionStickReport missionStick;
+        };
+        std::array<Port, 2> ports;
+    };
+    util::TripleBuffer<PeripheralReports> peripheralReports;
+
     int gameControllerDBCount = 0;
 
     Profile profile;
@@ -486,6 +507,7 @@ struct SharedContext {
     std::optional<TargetUpdate> targetUpdate = std::nullopt;
 
     ROMManager romManager;
+    DiscIndex discIndex;
     std::filesystem::path iplRomPath;
     std::filesystem::path cdbRomPath;
 
@@ -494,6 +516,8 @@ struct SharedContext {
     RewindBuffer rewindBuffer;
     bool rewinding = false;
 
+    AVCapture avCapture;
+
     struct Midi {
         std::unique_ptr<RtMidiIn> midiInput;
         std::unique_ptr<RtMidiOut> midiOutput;
@@ -537,6 +561,8 @@ struct SharedContext {
         YGRTracer YGR;
     } tracers;
 
+    TraceSink traceSink;
+
     struct Fonts {
         struct {
             ImFont *regular = nullptr;
@@ -578,6 +604,7 @@ struct SharedContext {
 
     struct EventQueues {
         moodycamel::BlockingConcurrentQueue<EmuEvent> emulator;
+        util::BoundedMPSCQueue<EmuFastEvent, 256> emulatorFast;
         moodycamel::BlockingConcurrentQueue<GUIEvent> gui;
     } eventQueues;
 
@@ -636,6 +663,20 @@ struct SharedContext {
         eventQueues.emulator.enqueue(std::move(event));
     }
 
+    void EnqueueEvent(const EmuFastEvent &event) {
+        if (!eventQueues.emulatorFast.TryEnqueue(event)) [[unlikely]] {
+            eventQueues.emulator.enqueue({.type = EmuEvent::Type::FastEvent, .value = event});
+            return;
+        }
+        // The emulator thread blocks on the regular queue while paused, so it must be woken up to see the event.
+        // Pairs with the fence in the emulator thread loop: either this sees the paused state or the emulator thread
+        // sees the event before it blocks.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (paused) {
+            eventQueues.emulator.enqueue({.type = EmuEvent::Type::Wake});
+        }
+    }
+
     void EnqueueEvent(GUIEvent &&event) {
         eventQueues.gui.enqueue(std::move(event));
     }
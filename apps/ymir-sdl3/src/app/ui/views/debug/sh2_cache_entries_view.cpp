@@ -2,6 +2,8 @@
 
 #include <ymir/hw/sh2/sh2.hpp>
 
+#include <utility>
+
 using namespace ymir;
 
 namespace app::ui {
@@ -58,10 +60,11 @@ void SH2CacheEntriesView::Display() {
 
             for (uint32 way = 0; way < sh2::kCacheWays; way++) {
                 if (ImGui::TableNextColumn()) {
-                    auto &entry = cache.GetEntryByIndex(i);
+                    // Only request mutable access when editing, since that invalidates the instruction fetch line
+                    const auto &entry = std::as_const(cache).GetEntryByIndex(i);
                     bool valid = entry.tag[way].valid;
                     if (ImGui::Checkbox(fmt::format("##entry_{}_way_{}_valid", i, way).c_str(), &valid)) {
-                        entry.tag[way].valid = valid;
+                        cache.GetEntryByIndex(i).tag[way].valid = valid;
                     }
 
                     ImGui::SameLine();
@@ -72,7 +75,7 @@ void SH2CacheEntriesView::Display() {
                     if (ImGui::InputScalar(fmt::format("##entry_{}_way_{}_tag_addr", i, way).c_str(), ImGuiDataType_U32,
                                            &tagAddress, nullptr, nullptr, "%08X",
                                            ImGuiInputTextFlags_CharsHexadecimal)) {
-                        entry.tag[way].tagAddress = tagAddress >> 10u;
+                        cache.GetEntryByIndex(i).tag[way].tagAddress = tagAddress >> 10u;
                     }
                     ImGui::PopFont();
                 }
@@ -36,6 +36,16 @@ void AudioSettingsView::Display() {
     if (MakeDirty(ImGui::Checkbox("Mute", &mute))) {
         settings.mute = mute;
     }
+    bool dynamicRateControl = settings.dynamicRateControl;
+    if (MakeDirty(ImGui::Checkbox("Dynamic rate control", &dynamicRateControl))) {
+        settings.dynamicRateControl = dynamicRateControl;
+    }
+    widgets::ExplanationTooltip("Paces emulation by the frame rate instead of the audio buffer and slightly adjusts "
+                                "the audio playback rate to keep the buffer half full.\n"
+                                "Avoids stalling emulation in the middle of a frame while waiting for the audio "
+                                "device, which results in smoother frame pacing, especially on variable refresh rate "
+                                "displays.",
+                                m_context.displayScale);
 
     // -----------------------------------------------------------------------------------------------------------------
 
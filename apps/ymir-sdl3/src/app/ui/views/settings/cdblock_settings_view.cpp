@@ -50,6 +50,7 @@ void CDBlockSettingsView::Display() {
         {
             std::unique_lock lock{m_context.locks.romManager};
             m_context.romManager.ScanCDBlockROMs(cdbRomsPaths);
+            m_context.romManager.SaveIndex();
         }
         if (m_context.cdbRomPath.empty() && !m_context.romManager.GetCDBlockROMs().empty()) {
             m_context.EnqueueEvent(events::gui::ReloadCDBlockROM());
@@ -209,6 +210,8 @@ void CDBlockSettingsView::Display() {
     ImGui::PopFont();
 
     widgets::settings::cdblock::CDReadSpeed(m_context);
+    widgets::settings::cdblock::CDReadAhead(m_context);
+    widgets::settings::cdblock::CDBlockThreadedLLE(m_context);
 }
 
 void CDBlockSettingsView::ProcessLoadCDBlockROM(void *userdata, std::filesystem::path file, int filter) {
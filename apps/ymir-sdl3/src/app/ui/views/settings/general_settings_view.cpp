@@ -53,6 +53,20 @@ void GeneralSettingsView::Display() {
         "May help reduce stuttering if you're loading images from a slow disk or from the network.",
         m_context.displayScale);
 
+    if (!settings.preloadDiscImagesToRAM) {
+        ImGui::BeginDisabled();
+    }
+    ImGui::Indent();
+    MakeDirty(ImGui::Checkbox("Compress preloaded disc images", &settings.compressPreloadedDiscImages));
+    widgets::ExplanationTooltip("Keeps preloaded disc images compressed in memory, reducing memory usage at a small "
+                                "CPU cost.\n"
+                                "CHD images are always kept compressed.",
+                                m_context.displayScale);
+    ImGui::Unindent();
+    if (!settings.preloadDiscImagesToRAM) {
+        ImGui::EndDisabled();
+    }
+
     MakeDirty(ImGui::Checkbox("Remember last loaded disc image", &settings.rememberLastLoadedDisc));
     widgets::ExplanationTooltip(
         "When enabled, Ymir will automatically load the most recently loaded game disc on startup.",
@@ -298,6 +312,7 @@ void GeneralSettingsView::Display() {
         drawRow("Save states", ProfilePath::SaveStates);
         drawRow("Dumps", ProfilePath::Dumps);
         drawRow("Screenshots", ProfilePath::Screenshots);
+        drawRow("Video/audio captures", ProfilePath::Captures);
 
         ImGui::EndTable();
     }
@@ -128,6 +128,15 @@ void InputSettingsView::Display() {
         ImGui::EndTable();
     }
 
+    MakeDirty(ImGui::Checkbox("Late input polling", &settings.latePolling));
+    widgets::ExplanationTooltip(
+        "Keeps reading keyboard and gamepad inputs while the emulator is running a frame instead of only once before "
+        "it starts, so that games see inputs made up to the moment they read the controllers. Can remove up to a frame "
+        "of input latency at the cost of slightly higher CPU usage on the GUI thread.\n"
+        "\n"
+        "Only takes effect while video sync is in use.",
+        m_context.displayScale);
+
     auto *drawList = ImGui::GetWindowDrawList();
 
     auto &inputContext = m_context.inputContext;
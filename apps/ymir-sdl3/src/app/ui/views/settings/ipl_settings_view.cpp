@@ -66,6 +66,7 @@ void IPLSettingsView::Display() {
         {
             std::unique_lock lock{m_context.locks.romManager};
             m_context.romManager.ScanIPLROMs(iplRomsPath);
+            m_context.romManager.SaveIndex();
         }
         if (m_context.iplRomPath.empty() && !m_context.romManager.GetIPLROMs().empty()) {
             m_context.EnqueueEvent(events::gui::ReloadIPLROM());
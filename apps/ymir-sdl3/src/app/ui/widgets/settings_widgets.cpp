@@ -333,6 +333,36 @@ namespace settings::cdblock {
         }
     }
 
+    void CDReadAhead(SharedContext &ctx) {
+        auto &config = ctx.settings.cdblock;
+
+        bool readAhead = config.readAhead;
+        if (ctx.settings.MakeDirty(ImGui::Checkbox("Read disc sectors ahead of time", &readAhead))) {
+            config.readAhead = readAhead;
+        }
+        widgets::ExplanationTooltip("Reads upcoming disc sectors in a background thread.\n"
+                                    "Reduces stuttering when loading games from slow storage or compressed disc "
+                                    "images such as CHD.",
+                                    ctx.displayScale);
+    }
+
+    void CDBlockThreadedLLE(SharedContext &ctx) {
+        auto &config = ctx.settings.cdblock;
+
+        bool threadedLLE = config.threadedLLE;
+        if (ctx.settings.MakeDirty(ImGui::Checkbox("Run low level CD block emulation in a dedicated thread",
+                                                   &threadedLLE))) {
+            ctx.EnqueueEvent(events::emu::EnableThreadedCDBlockLLE(threadedLLE));
+        }
+        widgets::ExplanationTooltip("Runs the SH-1, YGR and CD drive in a separate thread, in parallel with the SH-2s.
+"
+                                    "Improves performance on multi-core processors when low level emulation is "
+                                    "enabled, at a small cost in timing accuracy.
+"
+                                    "Has no effect with high level emulation.",
+                                    ctx.displayScale);
+    }
+
 } // namespace settings::cdblock
 
 } // namespace app::ui::widgets
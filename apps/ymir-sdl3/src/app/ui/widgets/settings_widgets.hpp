@@ -32,6 +32,8 @@ namespace settings::cdblock {
 
     void CDReadSpeed(SharedContext &ctx);
     void CDBlockLLE(SharedContext &ctx);
+    void CDReadAhead(SharedContext &ctx);
+    void CDBlockThreadedLLE(SharedContext &ctx);
 
 } // namespace settings::cdblock
 
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <ymir/sys/input_movie.hpp>
+
+#include <serdes/state_cereal.hpp>
+
+#include <cereal/types/array.hpp>
+#include <cereal/types/vector.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <memory>
+
+namespace ymir::sys {
+
+// Current input movie format version.
+// Increment whenever the serializers change, independently of the save state version.
+// Checkpoints embed save states, which carry their own version.
+// Remember to document every change!
+// Versions:
+//   1 = 0.2.2
+inline constexpr uint32 kMovieVersion = 1;
+
+// Upper bounds for array sizes read from movie files, to prevent potential memory allocation attacks.
+inline constexpr cereal::size_type kMaxMovieEvents = 256;
+inline constexpr cereal::size_type kMaxMovieReports = 1024;
+inline constexpr cereal::size_type kMaxMovieCheckpoints = 1024;
+
+} // namespace ymir::sys
+
+// -----------------------------------------------------------------------------
+
+CEREAL_CLASS_VERSION(ymir::sys::InputMovie, ymir::sys::kMovieVersion);
+
+namespace ymir::peripheral {
+
+template <class Archive>
+void serialize(Archive &ar, PeripheralReport &s) {
+    ar(s.type);
+    switch (s.type) {
+    case PeripheralType::None: break;
+    case PeripheralType::ControlPad: ar(s.report.controlPad.buttons); break;
+    case PeripheralType::AnalogPad: {
+        auto &r = s.report.analogPad;
+        ar(r.buttons, r.analog, r.x, r.y, r.l, r.r);
+        break;
+    }
+    case PeripheralType::ArcadeRacer: ar(s.report.arcadeRacer.buttons, s.report.arcadeRacer.wheel); break;
+    case PeripheralType::MissionStick: {
+        auto &r = s.report.missionStick;
+        ar(r.buttons, r.sixAxis, r.x1, r.y1, r.z1, r.x2, r.y2, r.z2);
+        break;
+    }
+    default: throw cereal::Exception("Invalid peripheral type in movie report");
+    }
+}
+
+} // namespace ymir::peripheral
+
+namespace ymir::sys {
+
+// Serializes a vector whose size is checked against an upper bound when loading.
+template <class Archive, class T>
+void SerializeBoundedVector(Archive &ar, std::vector<T> &v, cereal::size_type maxSize, const char *name) {
+    cereal::size_type size = v.size();
+    ar(size);
+    if (size > maxSize) {
+        throw cereal::Exception(fmt::format("Too many {} in movie: {}", name, size));
+    }
+    v.resize(size);
+    for (T &item : v) {
+        ar(item);
+    }
+}
+
+template <class Archive>
+void serialize(Archive &ar, InputMovie::Frame &s) {
+    SerializeBoundedVector(ar, s.events, kMaxMovieEvents, "events");
+    for (auto &reports : s.reports) {
+        SerializeBoundedVector(ar, reports, kMaxMovieReports, "reports");
+    }
+}
+
+template <class Archive>
+void serialize(Archive &ar, InputMovie::Checkpoint &s) {
+    if (!s.state) {
+        s.state = std::make_unique<state::State>();
+    }
+    ar(s.frame, *s.state);
+}
+
+template <class Archive>
+void serialize(Archive &ar, InputMovie &s, const uint32 version) {
+    // Reject version 0 and future versions
+    if (version == 0 || version > kMovieVersion) {
+        throw cereal::Exception(fmt::format("Unsupported movie version {}", version));
+    }
+
+    std::array<char, 4> magic = {'Y', 'M', 'O', 'V'};
+    ar(magic);
+    if (magic != std::array<char, 4>{'Y', 'M', 'O', 'V'}) {
+        throw cereal::Exception("Not an input movie");
+    }
+
+    ar(s.iplHash, s.discHash);
+    ar(s.rtcTimestamp);
+    ar(s.peripheralTypes);
+    ar(s.checkpointInterval);
+    ar(s.frames);
+    SerializeBoundedVector(ar, s.checkpoints, kMaxMovieCheckpoints, "checkpoints");
+}
+
+} // namespace ymir::sys
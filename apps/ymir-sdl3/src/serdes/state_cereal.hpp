@@ -27,7 +27,8 @@ namespace ymir::state {
 //   9 = 0.1.8
 //  10 = 0.2.0
 //  11 = 0.2.1
-inline constexpr uint32 kVersion = 11;
+//  12 = 0.2.2
+inline constexpr uint32 kVersion = 12;
 
 } // namespace ymir::state
 
@@ -1596,6 +1597,11 @@ void serialize(Archive &ar, CDDriveState::CDStatusState &s, const uint32 version
 
 template <class Archive>
 void serialize(Archive &ar, State &s, const uint32 version) {
+    // v12:
+    // - New fields:
+    //   - bool sh2SyncWide = false
+    //   - uint32 sh2SyncQuietQuanta = 0
+    //   - uint64 sh2SyncPendingComms = 0
     // v10:
     // - Every component now has a 4-byte magic field to check for data alignment
     // - New fields:
@@ -1677,6 +1683,13 @@ void serialize(Archive &ar, State &s, const uint32 version) {
     } else {
         s.ssh2SpilloverCycles = 0;
     }
+    if (version >= 12) {
+        ar(s.sh2SyncWide, s.sh2SyncQuietQuanta, s.sh2SyncPendingComms);
+    } else {
+        s.sh2SyncWide = false;
+        s.sh2SyncQuietQuanta = 0;
+        s.sh2SyncPendingComms = 0;
+    }
     magic("END_");
 
     if (version < 5) {
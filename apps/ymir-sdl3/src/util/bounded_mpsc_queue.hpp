@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+namespace util {
+
+// A fixed-capacity lock-free multiple-producer single-consumer queue of trivially copyable values.
+//
+// Every slot carries a sequence number that tells producers and the consumer whether it is free or filled for the
+// current lap around the buffer (D. Vyukov's bounded queue). Producers only contend on the enqueue position; the
+// consumer never writes to it. Nothing is allocated after construction.
+template <typename T, size_t N>
+class BoundedMPSCQueue {
+    static_assert(std::has_single_bit(N), "N must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+public:
+    BoundedMPSCQueue() {
+        for (size_t i = 0; i < N; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMPSCQueue(const BoundedMPSCQueue &) = delete;
+    BoundedMPSCQueue &operator=(const BoundedMPSCQueue &) = delete;
+
+    // Adds a value to the queue. May be called from any thread.
+    // Returns false if the queue is full.
+    bool TryEnqueue(const T &value) {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true) {
+            cell = &m_cells[pos & kMask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Removes the oldest value from the queue. Must only be called from the consumer thread.
+    // Returns false if the queue is empty.
+    bool TryDequeue(T &value) {
+        Cell &cell = m_cells[m_dequeuePos & kMask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+            return false;
+        }
+        value = cell.value;
+        cell.sequence.store(m_dequeuePos + N, std::memory_order_release);
+        ++m_dequeuePos;
+        return true;
+    }
+
+    // Removes up to count values from the queue into the given array. Must only be called from the consumer thread.
+    // Returns the number of values removed.
+    template <typename It>
+    size_t TryDequeueBulk(It out, size_t count) {
+        size_t i = 0;
+        while (i < count && TryDequeue(*out)) {
+            ++out;
+            ++i;
+        }
+        return i;
+    }
+
+    size_t Capacity() const {
+        return N;
+    }
+
+private:
+    static constexpr size_t kMask = N - 1;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::array<Cell, N> m_cells;
+
+    alignas(64) std::atomic<size_t> m_enqueuePos = 0; // Shared by producers
+    alignas(64) size_t m_dequeuePos = 0;              // Consumer-owned
+};
+
+} // namespace util
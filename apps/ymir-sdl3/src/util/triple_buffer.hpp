@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace util {
+
+// A lock-free, wait-free triple buffer for passing the latest version of a value from one producer thread to one
+// consumer thread.
+//
+// The producer fills WriteBuffer() and calls Publish(); the consumer calls Read() to get the most recently published
+// value. Intermediate values may be skipped, but the consumer never observes a partially written value and neither side
+// ever blocks.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    // Retrieves the buffer owned by the producer.
+    T &WriteBuffer() {
+        return m_buffers[m_writeIndex];
+    }
+
+    // Makes the contents of WriteBuffer() available to the consumer.
+    // WriteBuffer() returns a different buffer after this call; its contents are unspecified.
+    void Publish() {
+        const uint8_t prev = m_middle.exchange(m_writeIndex | kDirtyBit, std::memory_order_acq_rel);
+        m_writeIndex = prev & kIndexMask;
+    }
+
+    // Retrieves the most recently published value. Must only be called from the consumer thread.
+    // The reference remains valid until the next call to Read().
+    const T &Read() {
+        if (m_middle.load(std::memory_order_relaxed) & kDirtyBit) {
+            const uint8_t prev = m_middle.exchange(m_readIndex, std::memory_order_acq_rel);
+            m_readIndex = prev & kIndexMask;
+        }
+        return m_buffers[m_readIndex];
+    }
+
+private:
+    static constexpr uint8_t kIndexMask = 0b11;
+    static constexpr uint8_t kDirtyBit = 0b100;
+
+    std::array<T, 3> m_buffers{};
+
+    alignas(64) uint8_t m_writeIndex = 0;          // Producer-owned
+    alignas(64) std::atomic<uint8_t> m_middle = 1; // Index of the buffer in transit, plus the dirty bit
+    alignas(64) uint8_t m_readIndex = 2;           // Consumer-owned
+};
+
+} // namespace util
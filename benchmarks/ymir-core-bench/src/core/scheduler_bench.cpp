@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <ymir/core/scheduler.hpp>
+
+#include <array>
+
+using namespace ymir;
+
+namespace scheduler_bench {
+
+// Intervals of the periodic events, chosen to avoid frequent simultaneous deadlines
+inline constexpr std::array<uint64, core::kNumScheduledEvents> kIntervals = {17, 31, 53, 97, 211, 401, 1009};
+
+inline constexpr std::array<core::UserEventID, core::kNumScheduledEvents> kUserIDs = {
+    core::events::VDPPhase,       core::events::SCSPSample,           core::events::CDBlockDriveState,
+    core::events::CDBlockCommand, core::events::CDBlockLLEDriveState, core::events::SCUTimer1,
+    core::events::SMPCCommand,
+};
+
+struct EventCounter {
+    uint64 interval = 0;
+    uint64 fired = 0;
+};
+
+static void OnPeriodicEvent(core::EventContext &eventContext, void *userContext) {
+    auto &counter = *static_cast<EventCounter *>(userContext);
+    ++counter.fired;
+    eventContext.Reschedule(counter.interval);
+}
+
+static void OnOneShotEvent(core::EventContext &eventContext, void *userContext) {
+    ++static_cast<EventCounter *>(userContext)->fired;
+}
+
+} // namespace scheduler_bench
+
+using namespace scheduler_bench;
+
+// Fires periodic events that reschedule themselves from their callbacks.
+// Arg: number of registered events
+static void BM_SchedulerFireReschedule(benchmark::State &state) {
+    const size_t numEvents = state.range(0);
+
+    core::Scheduler scheduler{};
+    std::array<EventCounter, core::kNumScheduledEvents> counters{};
+    for (size_t i = 0; i < numEvents; ++i) {
+        counters[i].interval = kIntervals[i];
+        const core::EventID id = scheduler.RegisterEvent(kUserIDs[i], &counters[i], OnPeriodicEvent);
+        scheduler.ScheduleFromNow(id, kIntervals[i]);
+    }
+
+    for (auto _ : state) {
+        scheduler.Advance(scheduler.RemainingCount());
+    }
+
+    uint64 fired = 0;
+    for (const EventCounter &counter : counters) {
+        fired += counter.fired;
+    }
+    state.counters["events"] = benchmark::Counter(fired, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_SchedulerFireReschedule)->DenseRange(1, core::kNumScheduledEvents, 2);
+
+// Reschedules and cancels events from outside callbacks, as components do when their registers are written.
+// Arg: number of registered events
+static void BM_SchedulerScheduleCancel(benchmark::State &state) {
+    const size_t numEvents = state.range(0);
+
+    core::Scheduler scheduler{};
+    std::array<EventCounter, core::kNumScheduledEvents> counters{};
+    std::array<core::EventID, core::kNumScheduledEvents> ids{};
+    for (size_t i = 0; i < numEvents; ++i) {
+        ids[i] = scheduler.RegisterEvent(kUserIDs[i], &counters[i], OnOneShotEvent);
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        scheduler.ScheduleFromNow(ids[index], kIntervals[index]);
+        scheduler.Advance(1);
+        if (index & 1) {
+            scheduler.Cancel(ids[index]);
+        }
+        if (++index == numEvents) {
+            index = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerScheduleCancel)->DenseRange(1, core::kNumScheduledEvents, 2);
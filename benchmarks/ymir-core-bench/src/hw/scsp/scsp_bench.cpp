@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <ymir/hw/scsp/scsp.hpp>
+
+#include <ymir/core/configuration.hpp>
+#include <ymir/core/scheduler.hpp>
+
+#include <algorithm>
+#include <memory>
+
+using namespace ymir;
+
+namespace scsp_bench {
+
+inline constexpr uint32 kWRAMBase = 0x5A0'0000;
+inline constexpr uint32 kRegsBase = 0x5B0'0000;
+
+// Length of each slot's looping waveform in samples
+inline constexpr uint32 kWaveLength = 0x800;
+
+struct TestSubject {
+    core::Scheduler scheduler{};
+    core::Configuration config{};
+    sys::SH2Bus bus{};
+    std::unique_ptr<scsp::SCSP> scsp = std::make_unique<scsp::SCSP>(scheduler, config.audio);
+
+    uint64 samples = 0;
+
+    explicit TestSubject(uint32 numSlots) {
+        scsp->MapMemory(bus);
+        scsp->SetSampleCallback({this, [](sint16, sint16, void *ctx) { ++static_cast<TestSubject *>(ctx)->samples; }});
+
+        // Fill sound RAM with a 16-bit sawtooth wave per slot
+        for (uint32 slot = 0; slot < numSlots; ++slot) {
+            const uint32 base = kWRAMBase + slot * kWaveLength * sizeof(uint16);
+            for (uint32 i = 0; i < kWaveLength; ++i) {
+                bus.Write<uint16>(base + i * sizeof(uint16), static_cast<uint16>(i * (64 + slot)));
+            }
+        }
+
+        bus.Write<uint16>(kRegsBase + 0x400, 0x000F); // MVOL = max
+
+        for (uint32 slot = 0; slot < numSlots; ++slot) {
+            const uint32 startAddress = slot * kWaveLength * sizeof(uint16);
+            const uint32 slotRegs = kRegsBase + slot * 0x20;
+            auto writeReg = [&](uint32 offset, uint16 value) { bus.Write<uint16>(slotRegs + offset, value); };
+
+            writeReg(0x00, (1u << 11u) | (1u << 5u) | (startAddress >> 16u)); // KYONB, forward loop, SA
+            writeReg(0x02, startAddress & 0xFFFF);                            // SA
+            writeReg(0x04, 0x0000);                                           // LSA
+            writeReg(0x06, kWaveLength - 1);                                  // LEA
+            writeReg(0x08, 0x001F);                                           // AR = max
+            writeReg(0x0A, 0x001F);                                           // RR = max
+            writeReg(0x0C, slot & 0x3F);                                      // TL
+            writeReg(0x10, ((slot & 3) << 11u) | (slot * 0x1F));              // OCT, FNS
+            writeReg(0x12, (slot & 1) ? 0x2E5B : 0x0000);                     // LFO on odd slots
+            writeReg(0x16, (7u << 13u) | ((slot & 0x1F) << 8u));              // DISDL, DIPAN
+        }
+
+        // Key on all configured slots
+        if (numSlots > 0) {
+            bus.Write<uint16>(kRegsBase + 0x00, (1u << 12u) | (1u << 11u) | (1u << 5u)); // KYONEX, KYONB, forward loop
+        }
+    }
+
+    // Runs the scheduler until the specified number of samples is output
+    void RunSamples(uint64 count) {
+        const uint64 target = samples + count;
+        while (samples < target) {
+            scheduler.Advance(std::max<sint64>(scheduler.RemainingCount(), 1));
+        }
+    }
+};
+
+} // namespace scsp_bench
+
+using namespace scsp_bench;
+
+// Generates audio with a number of active slots.
+// Arg: number of slots keyed on
+static void BM_SCSPStepSample(benchmark::State &state) {
+    TestSubject subject{static_cast<uint32>(state.range(0))};
+
+    static constexpr uint64 kSamplesPerIteration = 512;
+    for (auto _ : state) {
+        subject.RunSamples(kSamplesPerIteration);
+    }
+    state.SetItemsProcessed(state.iterations() * kSamplesPerIteration);
+}
+BENCHMARK(BM_SCSPStepSample)->Arg(1)->Arg(8)->Arg(32);
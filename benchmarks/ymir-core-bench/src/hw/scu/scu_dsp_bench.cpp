@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <ymir/hw/scu/scu_dsp.hpp>
+
+#include <array>
+#include <random>
+#include <span>
+
+using namespace ymir;
+
+namespace scu_dsp_bench {
+
+// Multiply-accumulate over 64 pairs of values from data RAM banks 0 and 1
+inline constexpr auto kMACProgram = std::to_array<uint32>({
+    0x00001C00, // MOV  0,CT0
+    0x00001D00, // MOV  0,CT1
+    0x00001A3F, // MOV  63,LOP
+    0x00020000, // CLR  A
+    0xE8000000, // LPS
+    0x134D4000, // ADD  MOV MC0,X  MOV MUL,P  MOV MC1,Y  MOV ALU,A
+    0x10040000, // ADD  MOV ALU,A
+    0xF0000000, // END
+});
+
+// Logic operations over all 64 values of data RAM bank 0, written back to bank 2
+inline constexpr auto kALUProgram = std::to_array<uint32>({
+    0x00001C00, // MOV  0,CT0
+    0x00001E00, // MOV  0,CT2
+    0x00001A3F, // MOV  63,LOP
+    0xE8000000, // LPS
+    0x0C073209, // XOR  MOV MC0,A  MOV ALU,MC2
+    0xF0000000, // END
+});
+
+struct TestSubject {
+    sys::SH2Bus bus{};
+    scu::SCUDSP dsp{bus};
+
+    explicit TestSubject(std::span<const uint32> program) {
+        for (uint32 i = 0; i < program.size(); ++i) {
+            dsp.programRAM[i].u32 = program[i];
+        }
+
+        std::mt19937 rng{4321};
+        for (auto &bank : dsp.dataRAM) {
+            for (uint32 &value : bank) {
+                value = rng();
+            }
+        }
+    }
+
+    // Runs the program to completion
+    void Run() {
+        dsp.PC = 0;
+        dsp.programExecuting = true;
+        dsp.programEnded = false;
+        dsp.programPaused = false;
+        dsp.programStep = false;
+        while (dsp.programExecuting) {
+            dsp.Run<false>(64);
+        }
+    }
+};
+
+} // namespace scu_dsp_bench
+
+using namespace scu_dsp_bench;
+
+static void BM_SCUDSPMultiplyAccumulate(benchmark::State &state) {
+    TestSubject subject{kMACProgram};
+    for (auto _ : state) {
+        subject.Run();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SCUDSPMultiplyAccumulate);
+
+static void BM_SCUDSPLogic(benchmark::State &state) {
+    TestSubject subject{kALUProgram};
+    for (auto _ : state) {
+        subject.Run();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SCUDSPLogic);
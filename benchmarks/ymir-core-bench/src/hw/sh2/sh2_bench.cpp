@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+
+#include <ymir/hw/sh2/sh2.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace ymir;
+
+namespace sh2_bench {
+
+inline constexpr uint32 kRAMBase = 0x600'0000;
+inline constexpr uint32 kCodeOffset = 0x0'0000;
+inline constexpr uint32 kDataOffset = 0x8'0000;
+
+// Number of generated instructions in the loop body
+inline constexpr uint32 kLoopLength = 256;
+
+enum class Mix { ALU, Memory, Branch, Mixed };
+
+// Registers R0-R7 are used as operands, R14 holds the data pointer.
+static uint16 GenALU(std::mt19937 &rng) {
+    const uint16 n = rng() & 7;
+    const uint16 m = rng() & 7;
+    switch (rng() % 8) {
+    case 0: return 0x300C | (n << 8u) | (m << 4u);      // ADD   Rm, Rn
+    case 1: return 0x7000 | (n << 8u) | (rng() & 0xFF); // ADD   #imm, Rn
+    case 2: return 0x6003 | (n << 8u) | (m << 4u);      // MOV   Rm, Rn
+    case 3: return 0x200A | (n << 8u) | (m << 4u);      // XOR   Rm, Rn
+    case 4: return 0x2009 | (n << 8u) | (m << 4u);      // AND   Rm, Rn
+    case 5: return 0x4000 | (n << 8u);                  // SHLL  Rn
+    case 6: return 0x4001 | (n << 8u);                  // SHLR  Rn
+    default: return 0x0007 | (n << 8u) | (m << 4u);     // MUL.L Rm, Rn
+    }
+}
+
+static uint16 GenMemory(std::mt19937 &rng) {
+    const uint16 n = rng() & 7;
+    const uint16 disp = rng() & 0xF;
+    switch (rng() % 4) {
+    case 0: return 0x5000 | (n << 8u) | (14 << 4u) | disp; // MOV.L @(disp, R14), Rn
+    case 1: return 0x1000 | (14 << 8u) | (n << 4u) | disp; // MOV.L Rm, @(disp, R14)
+    case 2: return 0x6001 | (n << 8u) | (14 << 4u);        // MOV.W @R14, Rn
+    default: return 0x2000 | (14 << 8u) | (n << 4u);       // MOV.B Rm, @R14
+    }
+}
+
+// Generates the loop body followed by a branch back to its start
+static std::vector<uint16> GenerateProgram(Mix mix, uint32 seed) {
+    std::mt19937 rng{seed};
+    std::vector<uint16> program;
+    program.reserve(kLoopLength + 2);
+    while (program.size() < kLoopLength) {
+        uint32 kind;
+        switch (mix) {
+        case Mix::ALU: kind = 0; break;
+        case Mix::Memory: kind = 1; break;
+        case Mix::Branch: kind = 2; break;
+        default: kind = rng() % 10 < 6 ? 0 : rng() % 2 + 1; break;
+        }
+
+        switch (kind) {
+        case 0: program.push_back(GenALU(rng)); break;
+        case 1: program.push_back(GenMemory(rng)); break;
+        default: {
+            // CMP/EQ followed by a conditional branch that may skip the next instruction
+            const uint16 n = rng() & 7;
+            const uint16 m = rng() & 7;
+            program.push_back(0x3000 | (n << 8u) | (m << 4u)); // CMP/EQ Rm, Rn
+            program.push_back((rng() & 1) ? 0x8900 : 0x8B00);  // BT/BF  +0
+            program.push_back(GenALU(rng));
+            break;
+        }
+        }
+    }
+
+    // BRA back to the start of the loop with a NOP in the delay slot
+    const sint32 disp = -static_cast<sint32>(program.size() * 2 + 4) / 2;
+    program.push_back(0xA000 | (disp & 0xFFF)); // BRA  <start>
+    program.push_back(0x0009);                  // NOP
+    return program;
+}
+
+struct TestSubject {
+    sys::SystemFeatures systemFeatures{};
+    core::Scheduler scheduler{};
+    sys::SH2Bus bus{};
+    std::unique_ptr<std::array<uint8, 1024 * 1024>> ram = std::make_unique<std::array<uint8, 1024 * 1024>>();
+    sh2::SH2 sh2{scheduler, bus, true, systemFeatures};
+
+    explicit TestSubject(Mix mix) {
+        bus.MapArray(kRAMBase, kRAMBase + ram->size() - 1, *ram, true);
+
+        const std::vector<uint16> program = GenerateProgram(mix, 1234);
+        for (uint32 i = 0; i < program.size(); ++i) {
+            util::WriteBE<uint16>(&(*ram)[kCodeOffset + i * sizeof(uint16)], program[i]);
+        }
+
+        auto &probe = sh2.GetProbe();
+        probe.PC() = kRAMBase + kCodeOffset;
+        for (uint8 i = 0; i < 8; ++i) {
+            probe.R(i) = i * 0x01010101u;
+        }
+        probe.R(14) = kRAMBase + kDataOffset;
+    }
+};
+
+} // namespace sh2_bench
+
+using namespace sh2_bench;
+
+// Runs a generated instruction mix in a loop.
+// Arg: instruction mix
+template <bool enableCache>
+static void BM_SH2Advance(benchmark::State &state) {
+    const Mix mix = static_cast<Mix>(state.range(0));
+    TestSubject subject{mix};
+    if constexpr (enableCache) {
+        // Enable the cache through CCR.CE
+        subject.sh2.GetProbe().MemWriteByte(0xFFFFFE92, 0x01, true);
+    }
+
+    static constexpr uint64 kCyclesPerIteration = 4096;
+    uint64 cycles = 0;
+    for (auto _ : state) {
+        cycles += subject.sh2.Advance<false, enableCache>(kCyclesPerIteration);
+    }
+    state.counters["cycles"] = benchmark::Counter(cycles, benchmark::Counter::kIsRate);
+
+    static constexpr const char *kMixNames[] = {"alu", "memory", "branch", "mixed"};
+    state.SetLabel(kMixNames[state.range(0)]);
+}
+BENCHMARK(BM_SH2Advance<false>)->DenseRange(0, 3);
+BENCHMARK(BM_SH2Advance<true>)->DenseRange(0, 3);
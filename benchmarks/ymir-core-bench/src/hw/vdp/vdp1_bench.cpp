@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <ymir/hw/vdp/vdp.hpp>
+
+#include <ymir/core/configuration.hpp>
+#include <ymir/core/scheduler.hpp>
+
+#include <memory>
+
+using namespace ymir;
+
+namespace vdp1_bench {
+
+inline constexpr uint32 kVRAMBase = 0x5C0'0000;
+inline constexpr uint32 kRegsBase = 0x5D0'0000;
+
+// Number of primitives in the command list
+inline constexpr uint32 kNumPrimitives = 64;
+
+// Texture and Gouraud shading table locations in VRAM
+inline constexpr uint32 kTextureAddress = 0x10000;
+inline constexpr uint32 kGouraudAddress = 0x7FF00;
+
+inline constexpr uint32 kTextureSize = 64;
+
+enum class Primitive { Polygon, DistortedSprite };
+
+struct TestSubject {
+    core::Scheduler scheduler{};
+    core::Configuration config{};
+    sys::SH2Bus bus{};
+    std::unique_ptr<vdp::VDP> vdp = std::make_unique<vdp::VDP>(scheduler, config);
+
+    bool drawFinished = false;
+
+    TestSubject(Primitive primitive, uint32 size, bool gouraud) {
+        vdp->MapMemory(bus);
+        vdp->SetVDP1DrawCallback({this, [](void *ctx) { static_cast<TestSubject *>(ctx)->drawFinished = true; }});
+
+        // RGB texture and Gouraud shading table
+        for (uint32 i = 0; i < kTextureSize * kTextureSize; ++i) {
+            bus.Write<uint16>(kVRAMBase + kTextureAddress + i * sizeof(uint16), 0x8000 | (i * 0x123));
+        }
+        bus.Write<uint16>(kVRAMBase + kGouraudAddress + 0x0, 0x7C00);
+        bus.Write<uint16>(kVRAMBase + kGouraudAddress + 0x2, 0x03E0);
+        bus.Write<uint16>(kVRAMBase + kGouraudAddress + 0x4, 0x001F);
+        bus.Write<uint16>(kVRAMBase + kGouraudAddress + 0x6, 0x4210);
+
+        uint32 cmdAddress = kVRAMBase;
+        auto writeCmd = [&](uint32 offset, uint16 value) { bus.Write<uint16>(cmdAddress + offset, value); };
+
+        // System clipping
+        writeCmd(0x00, 0x0009);
+        writeCmd(0x14, 319);
+        writeCmd(0x16, 223);
+        cmdAddress += 0x20;
+
+        // Local coordinates
+        writeCmd(0x00, 0x000A);
+        writeCmd(0x0C, 0);
+        writeCmd(0x0E, 0);
+        cmdAddress += 0x20;
+
+        // Primitives spread across the screen with slightly skewed corners
+        const uint16 pmod = (primitive == Primitive::DistortedSprite ? 0x00E8 : 0x00C0) | (gouraud ? 0x0004 : 0x0000);
+        for (uint32 i = 0; i < kNumPrimitives; ++i) {
+            const uint16 x = (i * 37) % (320 - size);
+            const uint16 y = (i * 53) % (224 - size);
+            const uint16 skew = i & 7;
+
+            if (primitive == Primitive::DistortedSprite) {
+                writeCmd(0x00, 0x0002);
+                writeCmd(0x08, kTextureAddress >> 3u);
+                writeCmd(0x0A, ((kTextureSize / 8) << 8u) | kTextureSize);
+            } else {
+                writeCmd(0x00, 0x0004);
+                writeCmd(0x06, 0x8000 | (i * 0x211));
+            }
+            writeCmd(0x04, pmod);
+            writeCmd(0x0C, x + skew);
+            writeCmd(0x0E, y);
+            writeCmd(0x10, x + size - 1);
+            writeCmd(0x12, y + skew);
+            writeCmd(0x14, x + size - 1 - skew);
+            writeCmd(0x16, y + size - 1);
+            writeCmd(0x18, x);
+            writeCmd(0x1A, y + size - 1 - skew);
+            writeCmd(0x1C, kGouraudAddress >> 3u);
+            cmdAddress += 0x20;
+        }
+
+        // End of command list
+        writeCmd(0x00, 0x8000);
+    }
+
+    // Draws the command list to completion
+    bool Draw() {
+        static constexpr uint64 kCyclesPerStep = 500 * 16;
+        static constexpr uint64 kMaxSteps = 1024;
+
+        drawFinished = false;
+        bus.Write<uint16>(kRegsBase + 0x04, 0x0001); // PTMR = draw immediately
+        for (uint64 step = 0; step < kMaxSteps && !drawFinished; ++step) {
+            vdp->Advance(kCyclesPerStep);
+        }
+        return drawFinished;
+    }
+};
+
+} // namespace vdp1_bench
+
+using namespace vdp1_bench;
+
+// Draws a command list with a number of quads.
+// Args: primitive type, primitive size, Gouraud shading
+static void BM_VDP1Draw(benchmark::State &state) {
+    const auto primitive = static_cast<Primitive>(state.range(0));
+    const auto size = static_cast<uint32>(state.range(1));
+    const bool gouraud = state.range(2) != 0;
+    TestSubject subject{primitive, size, gouraud};
+
+    for (auto _ : state) {
+        // A soft reset clears the per-frame cycle budget without touching VRAM
+        state.PauseTiming();
+        subject.vdp->Reset(false);
+        state.ResumeTiming();
+
+        if (!subject.Draw()) {
+            state.SkipWithError("VDP1 did not finish drawing");
+            break;
+        }
+    }
+    state.counters["primitives"] = benchmark::Counter(kNumPrimitives, benchmark::Counter::kIsIterationInvariantRate);
+    state.SetLabel(primitive == Primitive::DistortedSprite ? "distorted sprite" : "polygon");
+}
+BENCHMARK(BM_VDP1Draw)->ArgsProduct({{0, 1}, {8, 32, 64}, {0, 1}});
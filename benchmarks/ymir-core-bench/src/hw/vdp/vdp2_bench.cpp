@@ -0,0 +1,174 @@
+#include <benchmark/benchmark.h>
+
+#include <ymir/hw/vdp/vdp.hpp>
+
+#include <ymir/core/configuration.hpp>
+#include <ymir/core/scheduler.hpp>
+
+#include <ymir/util/cpu_features.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+using namespace ymir;
+
+namespace vdp2_bench {
+
+inline constexpr uint32 kVRAMBase = 0x5E0'0000;
+inline constexpr uint32 kCRAMBase = 0x5F0'0000;
+inline constexpr uint32 kRegsBase = 0x5F8'0000;
+
+// Rotation parameter table location in VRAM
+inline constexpr uint32 kRotParamTableAddress = 0x7FF00;
+
+enum class Layer { NBGCell, NBGBitmap, RBGCell };
+
+struct TestSubject {
+    core::Scheduler scheduler{};
+    core::Configuration config{};
+    sys::SH2Bus bus{};
+    std::unique_ptr<vdp::VDP> vdp = std::make_unique<vdp::VDP>(scheduler, config);
+
+    bool frameComplete = false;
+    uint32 lines = 0;
+
+    TestSubject() {
+        vdp->MapMemory(bus);
+        vdp->SetSIMDLevel(util::GetHostCPUFeatures().GetBestSIMDLevel());
+        vdp->SetRenderCallback({this, [](uint32 *, uint32, uint32 height, void *ctx) {
+                                    auto &subject = *static_cast<TestSubject *>(ctx);
+                                    subject.frameComplete = true;
+                                    subject.lines += height;
+                                }});
+
+        // Fill VRAM and CRAM with noise so that every layer has visible, partially transparent pixels
+        std::mt19937 rng{9876};
+        for (uint32 address = 0; address < 0x80000; address += sizeof(uint32)) {
+            bus.Write<uint32>(kVRAMBase + address, rng());
+        }
+        for (uint32 address = 0; address < 0x1000; address += sizeof(uint32)) {
+            bus.Write<uint32>(kCRAMBase + address, rng());
+        }
+    }
+
+    void WriteReg(uint32 offset, uint16 value) {
+        bus.Write<uint16>(kRegsBase + offset, value);
+    }
+
+    // Sets the same cycle pattern on all four VRAM banks
+    void WriteCyclePatterns(uint16 lower, uint16 upper) {
+        for (uint32 offset = 0x10; offset <= 0x1C; offset += 4) {
+            WriteReg(offset + 0, lower);
+            WriteReg(offset + 2, upper);
+        }
+    }
+
+    // Configures a single background layer with the given color format
+    void SetupLayer(Layer layer, uint16 colorFormat) {
+        switch (layer) {
+        case Layer::NBGCell:
+            WriteReg(0x20, 0x0001);             // BGON: NBG0
+            WriteReg(0x28, colorFormat << 4u);  // CHCTLA: NBG0 color format, 1x1 cells
+            WriteReg(0xF8, 0x0007);             // PRINA: NBG0 priority
+            WriteCyclePatterns(0x0444, 0x4444); // one pattern name read, character pattern reads
+            break;
+        case Layer::NBGBitmap:
+            WriteReg(0x20, 0x0001);                       // BGON: NBG0
+            WriteReg(0x28, (colorFormat << 4u) | 0x0002); // CHCTLA: NBG0 color format, bitmap 512x256
+            WriteReg(0xF8, 0x0007);                       // PRINA: NBG0 priority
+            WriteCyclePatterns(0x4444, 0x4444);           // bitmap data reads only
+            break;
+        case Layer::RBGCell:
+            WriteReg(0x0E, 0x033E);                                 // RAMCTL: A0 = pattern names, A1/B0 = characters
+            WriteReg(0x20, 0x0010);                                 // BGON: RBG0
+            WriteReg(0x2A, colorFormat << 12u);                     // CHCTLB: RBG0 color format, 1x1 cells
+            WriteReg(0xFC, 0x0007);                                 // PRIR: RBG0 priority
+            WriteReg(0xB0, 0x0000);                                 // RPMD: rotation parameter A only
+            WriteReg(0xBC, kRotParamTableAddress >> 17u);           // RPTAU
+            WriteReg(0xBE, (kRotParamTableAddress >> 1u) & 0xFFFE); // RPTAL
+            WriteCyclePatterns(0xFFFF, 0xFFFF);
+
+            // Identity transform for rotation parameter A
+            {
+                auto writeParam = [&](uint32 offset, uint32 value) {
+                    bus.Write<uint32>(kVRAMBase + kRotParamTableAddress + offset, value);
+                };
+                for (uint32 offset = 0; offset < 0x80; offset += sizeof(uint32)) {
+                    writeParam(offset, 0);
+                }
+                writeParam(0x10, 1u << 16u); // delta Yst = 1.0
+                writeParam(0x14, 1u << 16u); // delta X = 1.0
+                writeParam(0x1C, 1u << 16u); // A = 1.0
+                writeParam(0x2C, 1u << 16u); // E = 1.0
+                writeParam(0x4C, 1u << 16u); // kx = 1.0
+                writeParam(0x50, 1u << 16u); // ky = 1.0
+            }
+            break;
+        }
+    }
+
+    // Configures up to four NBGs in 16-color cell mode, optionally blending them with color calculation
+    void SetupLayers(uint32 numLayers, bool colorCalc) {
+        WriteReg(0x20, (1u << numLayers) - 1u);      // BGON
+        WriteReg(0x28, 0x0000);                      // CHCTLA: NBG0/1 16 colors, 1x1 cells
+        WriteReg(0x2A, 0x0000);                      // CHCTLB: NBG2/3 16 colors, 1x1 cells
+        WriteReg(0xF8, 0x0607);                      // PRINA: NBG0 = 7, NBG1 = 6
+        WriteReg(0xFA, 0x0405);                      // PRINB: NBG2 = 5, NBG3 = 4
+        WriteCyclePatterns(0x0123, 0x4567);          // pattern name and character reads for all NBGs
+        WriteReg(0xEC, colorCalc ? 0x000F : 0x0000); // CCCTL: NBG0-3 color calculation
+        WriteReg(0x108, 0x0A0A);                     // CCRNA: NBG0/1 ratios
+        WriteReg(0x10A, 0x0A0A);                     // CCRNB: NBG2/3 ratios
+    }
+
+    void EnableDisplay() {
+        WriteReg(0x00, 0x8000); // TVMD: display on, 320x224 non-interlaced
+    }
+
+    // Runs the scheduler until a frame is complete
+    void RunFrame() {
+        frameComplete = false;
+        while (!frameComplete) {
+            scheduler.Advance(std::max<sint64>(scheduler.RemainingCount(), 1));
+        }
+    }
+};
+
+} // namespace vdp2_bench
+
+using namespace vdp2_bench;
+
+// Renders frames with a single background layer.
+// Args: layer type, color format
+static void BM_VDP2DrawLine(benchmark::State &state) {
+    TestSubject subject{};
+    subject.SetupLayer(static_cast<Layer>(state.range(0)), state.range(1));
+    subject.EnableDisplay();
+    subject.RunFrame();
+    subject.lines = 0;
+
+    for (auto _ : state) {
+        subject.RunFrame();
+    }
+    state.counters["lines"] = benchmark::Counter(subject.lines, benchmark::Counter::kIsRate);
+
+    static constexpr const char *kLayerNames[] = {"NBG cell", "NBG bitmap", "RBG cell"};
+    state.SetLabel(kLayerNames[state.range(0)]);
+}
+BENCHMARK(BM_VDP2DrawLine)->ArgsProduct({{0, 1, 2}, {0, 1, 3, 4}});
+
+// Renders frames with multiple background layers to measure layer composition.
+// Args: number of layers, color calculation enable
+static void BM_VDP2ComposeLine(benchmark::State &state) {
+    TestSubject subject{};
+    subject.SetupLayers(state.range(0), state.range(1) != 0);
+    subject.EnableDisplay();
+    subject.RunFrame();
+    subject.lines = 0;
+
+    for (auto _ : state) {
+        subject.RunFrame();
+    }
+    state.counters["lines"] = benchmark::Counter(subject.lines, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_VDP2ComposeLine)->ArgsProduct({{1, 2, 3, 4}, {0, 1}});
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <ymir/media/loader/loader.hpp>
+
+#include <ymir/util/arith_ops.hpp>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <span>
+#include <string>
+
+using namespace ymir;
+
+namespace disc_bench {
+
+// Number of sectors in the generated images
+inline constexpr uint32 kNumSectors = 2048;
+
+// Pregap of the first track, in frames
+inline constexpr uint32 kPregap = 150;
+
+enum class Format { ISO2048, ISO2352, BinCue, ImgCcd };
+
+inline constexpr const char *kFormatNames[] = {"ISO (2048)", "ISO (2352)", "BIN/CUE", "IMG/CCD"};
+inline constexpr const char *kPreloadNames[] = {"none", "uncompressed", "compressed"};
+
+static std::filesystem::path ImageDir() {
+    return std::filesystem::temp_directory_path() / "ymir-core-bench";
+}
+
+// Writes kNumSectors Mode 1 sectors filled with noise, either raw (2352 bytes) or user data only (2048 bytes)
+static void WriteSectors(const std::filesystem::path &path, bool raw) {
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    std::mt19937 rng{2468};
+    std::array<uint8, 2352> sector{};
+    for (uint32 i = 0; i < kNumSectors; ++i) {
+        const uint32 frameAddress = i + kPregap;
+        sector.fill(0);
+        std::fill_n(&sector[1], 10, 0xFF); // sync bytes
+        sector[12] = util::to_bcd(frameAddress / 75 / 60);
+        sector[13] = util::to_bcd(frameAddress / 75 % 60);
+        sector[14] = util::to_bcd(frameAddress % 75);
+        sector[15] = 0x01; // mode 1
+        for (uint32 j = 16; j < 16 + 2048; ++j) {
+            sector[j] = rng();
+        }
+
+        if (raw) {
+            out.write(reinterpret_cast<const char *>(sector.data()), sector.size());
+        } else {
+            out.write(reinterpret_cast<const char *>(&sector[16]), 2048);
+        }
+    }
+}
+
+// Generates the image files for the given format and returns the path to the file to be loaded
+static std::filesystem::path GenerateImage(Format format) {
+    const std::filesystem::path dir = ImageDir();
+    std::filesystem::create_directories(dir);
+
+    switch (format) {
+    case Format::ISO2048: {
+        auto path = dir / "bench2048.iso";
+        WriteSectors(path, false);
+        return path;
+    }
+    case Format::ISO2352: {
+        auto path = dir / "bench2352.iso";
+        WriteSectors(path, true);
+        return path;
+    }
+    case Format::BinCue: {
+        WriteSectors(dir / "bench.bin", true);
+        auto path = dir / "bench.cue";
+        std::ofstream out{path, std::ios::trunc};
+        out << "FILE \"bench.bin\" BINARY\n";
+        out << "  TRACK 01 MODE1/2352\n";
+        out << "    INDEX 01 00:00:00\n";
+        return path;
+    }
+    case Format::ImgCcd: {
+        WriteSectors(dir / "bench.img", true);
+        auto path = dir / "bench.ccd";
+        std::ofstream out{path, std::ios::trunc};
+
+        // The IMG/CCD loader excludes a 150-frame pregap from the data track and treats the lead-out as inclusive
+        const uint32 leadOut = kNumSectors + kPregap * 2 - 1;
+        auto writeEntry = [&](uint32 index, uint32 point, uint32 min, uint32 sec, uint32 frame, sint32 lba) {
+            out << fmt::format("[Entry {}]\nSession=1\nPoint=0x{:02x}\nADR=0x01\nControl=0x04\n", index, point);
+            out << fmt::format("PMin={}\nPSec={}\nPFrame={}\nPLBA={}\n", min, sec, frame, lba);
+        };
+
+        out << "[CloneCD]\nVersion=3\n";
+        out << "[Disc]\nTocEntries=4\nSessions=1\nDataTracksScrambled=0\n";
+        out << "[Session 1]\nPreGapMode=1\nPreGapSubC=0\n";
+        writeEntry(0, 0xA0, 1, 0, 0, -1);
+        writeEntry(1, 0xA1, 1, 0, 0, -1);
+        writeEntry(2, 0xA2, leadOut / 75 / 60, leadOut / 75 % 60, leadOut % 75, leadOut - kPregap);
+        writeEntry(3, 0x01, 0, 2, 0, 0);
+        return path;
+    }
+    }
+    return {};
+}
+
+} // namespace disc_bench
+
+using namespace disc_bench;
+
+// Reads sectors sequentially from a synthesized disc image.
+// Args: image format, preload mode
+static void BM_TrackReadSector(benchmark::State &state) {
+    const auto format = static_cast<Format>(state.range(0));
+    const auto preload = static_cast<media::PreloadMode>(state.range(1));
+
+    media::Disc disc{};
+    const std::filesystem::path path = GenerateImage(format);
+    if (!media::LoadDisc(path, disc, preload, [](media::MessageType, std::string) {})) {
+        state.SkipWithError(fmt::format("Failed to load {}", path).c_str());
+        return;
+    }
+
+    const media::Track &track = disc.sessions[0].tracks[0];
+    std::array<uint8, 2352> buffer{};
+    uint32 index = 0;
+    for (auto _ : state) {
+        if (!track.ReadSector(track.startFrameAddress + index, buffer)) {
+            state.SkipWithError("Failed to read sector");
+            break;
+        }
+        benchmark::DoNotOptimize(buffer.data());
+        index = (index + 1) % kNumSectors;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+    state.SetLabel(fmt::format("{}, preload {}", kFormatNames[state.range(0)], kPreloadNames[state.range(1)]));
+}
+BENCHMARK(BM_TrackReadSector)->ArgsProduct({{0, 1, 2, 3}, {0, 1, 2}});
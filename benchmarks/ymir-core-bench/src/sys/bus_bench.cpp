@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include <ymir/sys/bus.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace ymir;
+
+namespace bus_bench {
+
+inline constexpr uint32 kArrayBase = 0x600'0000;
+inline constexpr uint32 kMMIOBase = 0x5F8'0000;
+inline constexpr uint32 kRangeSize = 0x4'0000; // spans several pages
+
+// A small register file accessed through handler functions, standing in for MMIO-mapped components
+struct MMIODevice {
+    std::array<uint16, 256> regs{};
+
+    uint16 ReadReg(uint32 address) const {
+        return regs[(address >> 1u) & 0xFF];
+    }
+
+    void WriteReg(uint32 address, uint16 value) {
+        regs[(address >> 1u) & 0xFF] = value;
+    }
+};
+
+struct TestSubject {
+    sys::SH2Bus bus{};
+    std::unique_ptr<std::array<uint8, 1024 * 1024>> ram = std::make_unique<std::array<uint8, 1024 * 1024>>();
+    MMIODevice device{};
+
+    std::vector<uint32> offsets;
+
+    TestSubject() {
+        static constexpr auto cast = [](void *ctx) -> MMIODevice & { return *static_cast<MMIODevice *>(ctx); };
+
+        bus.MapArray(kArrayBase, kArrayBase + ram->size() - 1, *ram, true);
+        bus.MapBoth(
+            kMMIOBase, kMMIOBase + kRangeSize - 1, &device,
+            [](uint32 address, void *ctx) -> uint8 { return cast(ctx).ReadReg(address) >> ((~address & 1) * 8); },
+            [](uint32 address, void *ctx) -> uint16 { return cast(ctx).ReadReg(address); },
+            [](uint32 address, void *ctx) -> uint32 {
+                return (cast(ctx).ReadReg(address + 0) << 16u) | cast(ctx).ReadReg(address + 2);
+            },
+            [](uint32 address, uint8 value, void *ctx) { cast(ctx).WriteReg(address, value); },
+            [](uint32 address, uint16 value, void *ctx) { cast(ctx).WriteReg(address, value); },
+            [](uint32 address, uint32 value, void *ctx) {
+                cast(ctx).WriteReg(address + 0, value >> 16u);
+                cast(ctx).WriteReg(address + 2, value >> 0u);
+            });
+
+        // Random offsets spread over multiple pages
+        std::mt19937 rng{12345};
+        std::uniform_int_distribution<uint32> dist{0, kRangeSize - 1};
+        offsets.resize(4096);
+        for (uint32 &offset : offsets) {
+            offset = dist(rng);
+        }
+    }
+};
+
+template <mem_primitive T>
+static void BusRead(benchmark::State &state, uint32 base) {
+    TestSubject subject{};
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(subject.bus.Read<T>(base + subject.offsets[index]));
+        index = (index + 1) & (subject.offsets.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * sizeof(T));
+}
+
+template <mem_primitive T>
+static void BusWrite(benchmark::State &state, uint32 base) {
+    TestSubject subject{};
+    size_t index = 0;
+    for (auto _ : state) {
+        subject.bus.Write<T>(base + subject.offsets[index], static_cast<T>(index));
+        index = (index + 1) & (subject.offsets.size() - 1);
+    }
+    benchmark::DoNotOptimize(subject.ram->data());
+    benchmark::DoNotOptimize(subject.device.regs.data());
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * sizeof(T));
+}
+
+} // namespace bus_bench
+
+using namespace bus_bench;
+
+template <mem_primitive T>
+static void BM_BusReadArray(benchmark::State &state) {
+    BusRead<T>(state, kArrayBase);
+}
+BENCHMARK(BM_BusReadArray<uint8>);
+BENCHMARK(BM_BusReadArray<uint16>);
+BENCHMARK(BM_BusReadArray<uint32>);
+
+template <mem_primitive T>
+static void BM_BusWriteArray(benchmark::State &state) {
+    BusWrite<T>(state, kArrayBase);
+}
+BENCHMARK(BM_BusWriteArray<uint8>);
+BENCHMARK(BM_BusWriteArray<uint16>);
+BENCHMARK(BM_BusWriteArray<uint32>);
+
+template <mem_primitive T>
+static void BM_BusReadMMIO(benchmark::State &state) {
+    BusRead<T>(state, kMMIOBase);
+}
+BENCHMARK(BM_BusReadMMIO<uint8>);
+BENCHMARK(BM_BusReadMMIO<uint16>);
+BENCHMARK(BM_BusReadMMIO<uint32>);
+
+template <mem_primitive T>
+static void BM_BusWriteMMIO(benchmark::State &state) {
+    BusWrite<T>(state, kMMIOBase);
+}
+BENCHMARK(BM_BusWriteMMIO<uint8>);
+BENCHMARK(BM_BusWriteMMIO<uint16>);
+BENCHMARK(BM_BusWriteMMIO<uint32>);
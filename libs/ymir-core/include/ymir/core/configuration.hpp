@@ -50,6 +50,13 @@ struct Configuration {
         ///
         /// Enabling this option incurs a small performance penalty and purges all SH-2 caches.
         util::Observable<bool> emulateSH2Cache = false;
+
+        /// @brief Lets the SH-2s and SCU run up to the next scheduled event instead of in short interleaved slices while
+        /// the slave SH-2 is idle and there is no cross-CPU communication.
+        ///
+        /// A wide slice ends at the first MINIT/SINIT write or SCU register write, so that the slave SH-2 and the SCU
+        /// observe the communication when it happens. Disable to always use short slices.
+        util::Observable<bool> adaptiveSH2Sync = true;
     } system;
 
     /// @brief RTC configuration
@@ -113,6 +120,22 @@ struct Configuration {
         ///
         /// Causes a hard reset when changed.
         util::Observable<bool> useLLE = false;
+
+        /// @brief Reads disc sectors ahead of time in a dedicated thread.
+        ///
+        /// Reduces stalls on slow storage or compressed disc images.
+        ///
+        /// This value is thread-safe.
+        util::Observable<bool> readAhead = true;
+
+        /// @brief Runs the low-level emulated CD block (SH-1, YGR and CD drive) in a dedicated thread.
+        ///
+        /// The CD block runs one scheduler time slice behind the rest of the system and is synchronized whenever the
+        /// host accesses the CD block registers, which takes most of the cost of low-level emulation off the emulator
+        /// thread on multi-core hosts.
+        ///
+        /// Has no effect unless low-level CD block emulation is enabled.
+        util::Observable<bool> threadedLLE = false;
     } cdblock;
 
     /// @brief Notifies all observers registered with all observables.
@@ -9,6 +9,8 @@
 
 #include <ymir/state/state_scheduler.hpp>
 
+#include <ymir/debug/perf_counters.hpp>
+
 #include <ymir/util/inline.hpp>
 
 #include <array>
@@ -227,6 +229,20 @@ public:
         return scaledCurrCount < event.target;
     }
 
+    /// @brief Retrieves the user ID associated with the given event.
+    /// @param[in] id the event ID
+    /// @return the user ID the event was registered with
+    [[nodiscard]] UserEventID GetUserID(EventID id) const {
+        assert(id < kNumScheduledEvents);
+        return m_userIDs[id];
+    }
+
+    /// @brief Attaches the specified performance counters to the scheduler.
+    /// @param[in] counters the performance counters to update, or `nullptr` to stop counting
+    void UsePerfCounters(debug::PerfCounters *counters) {
+        m_perf = counters;
+    }
+
     /// @brief Advances the scheduler by the specified count and fire scheduled events.
     /// @param count the number of cycles to advance
     FORCE_INLINE void Advance(uint64 count) {
@@ -321,7 +337,8 @@ private:
     /// @brief Executes all scheduled events up to the current count.
     FORCE_INLINE void Execute() {
         while (m_currCount >= m_nextCount) {
-            Event &event = m_events[m_nextEvent];
+            const size_t eventIndex = m_nextEvent;
+            Event &event = m_events[eventIndex];
             assert(event.target != kNoDeadline);
 
             const uint64 currCount = m_currCount;
@@ -333,6 +350,11 @@ private:
                 void *const userContext = event.userContext;
                 EventContext eventContext;
                 callback(eventContext, userContext);
+                if constexpr (debug::kPerfStatsEnabled) {
+                    if (m_perf != nullptr) [[unlikely]] {
+                        m_perf->eventsFired[eventIndex].Add(1);
+                    }
+                }
                 if (eventContext.reschedule) {
                     target += eventContext.interval;
                 } else {
@@ -369,6 +391,8 @@ private:
     std::array<UserEventID, kNumScheduledEvents> m_userIDs; ///< User IDs associated with events
     size_t m_nextEventIndex;                                ///< The next event index on which to register new events
     std::array<EventID, std::numeric_limits<UserEventID>::max() + 1> m_eventPtrs; ///< Translates user IDs to event IDs
+
+    debug::PerfCounters *m_perf = nullptr; ///< Performance counters, if attached
 };
 
 } // namespace ymir::core
@@ -0,0 +1,156 @@
+#pragma once
+
+/**
+@file
+@brief Per-component performance counters.
+
+Performance counters are compiled in only if `Ymir_ENABLE_PERF_STATS` is enabled. When compiled in, they are collected
+only while enabled at runtime with `ymir::Saturn::EnablePerfStats(bool)`.
+*/
+
+#include <ymir/core/scheduler_defs.hpp>
+#include <ymir/core/types.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace ymir::debug {
+
+/// @brief Whether performance counters are compiled into the emulator core.
+inline constexpr bool kPerfStatsEnabled = Ymir_ENABLE_PERF_STATS;
+
+/// @brief Components whose host execution time is measured.
+enum class PerfComponent : uint8 { SH2, SCU, VDP, SH1, Scheduler };
+
+/// @brief The number of timed components.
+inline constexpr size_t kNumPerfComponents = 5;
+
+/// @brief Performance counters collected over a single frame.
+struct PerfFrameStats {
+    /// @brief The number of the frame since performance counters were enabled.
+    uint64 frame = 0;
+
+    std::array<uint64, 2> sh2Instructions{}; ///< SH-2 instructions interpreted (master, slave)
+    std::array<uint64, 2> sh2Cycles{};       ///< SH-2 cycles executed (master, slave)
+    std::array<uint64, 2> sh2MemoryAccesses{}; ///< SH-2 external bus accesses to plain memory (master, slave)
+    std::array<uint64, 2> sh2MMIOAccesses{};   ///< SH-2 external bus accesses dispatched to handlers (master, slave)
+
+    uint64 scuDMABytes = 0; ///< Bytes transferred by SCU DMA
+
+    uint64 vdp1Commands = 0; ///< VDP1 commands processed
+    uint64 vdp1Pixels = 0;   ///< VDP1 pixels plotted
+    uint64 vdp2Lines = 0;    ///< VDP2 lines rendered
+    uint64 vdp2Layers = 0;   ///< VDP2 layers drawn, summed over all lines
+
+    uint64 scspSamples = 0;      ///< SCSP samples output
+    uint64 m68kInstructions = 0; ///< MC68EC000 instructions executed
+
+    /// @brief Scheduler events fired, indexed by event ID.
+    std::array<uint64, core::kNumScheduledEvents> eventsFired{};
+
+    /// @brief User IDs of the scheduler events, indexed by event ID. See `ymir::core::events`.
+    std::array<core::UserEventID, core::kNumScheduledEvents> eventUserIDs{};
+
+    /// @brief Host time spent advancing each component in nanoseconds, indexed by `PerfComponent`.
+    std::array<uint64, kNumPerfComponents> advanceNanos{};
+};
+
+/// @brief A snapshot of the performance counters of the most recent frames.
+struct PerfStats {
+    /// @brief Stats of the most recent frames, from oldest to newest.
+    std::vector<PerfFrameStats> frames;
+};
+
+/// @brief A counter that can be incremented from any thread.
+class PerfCounter {
+public:
+    void Add(uint64 count) {
+        m_value.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    uint64 Take() {
+        return m_value.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64> m_value = 0;
+};
+
+/// @brief Live performance counters updated by the components.
+///
+/// Components accumulate counts locally where possible and add them in batches to keep overhead low.
+struct PerfCounters {
+    struct SH2 {
+        PerfCounter instructions;
+        PerfCounter cycles;
+        PerfCounter memoryAccesses;
+        PerfCounter mmioAccesses;
+    };
+    std::array<SH2, 2> sh2;
+
+    PerfCounter scuDMABytes;
+
+    PerfCounter vdp1Commands;
+    PerfCounter vdp1Pixels;
+    PerfCounter vdp2Lines;
+    PerfCounter vdp2Layers;
+
+    PerfCounter scspSamples;
+    PerfCounter m68kInstructions;
+
+    std::array<PerfCounter, core::kNumScheduledEvents> eventsFired;
+    std::array<PerfCounter, kNumPerfComponents> advanceNanos;
+
+    /// @brief Moves the current counts into the given frame stats object and resets the counters.
+    void Collect(PerfFrameStats &stats);
+};
+
+/// @brief Measures the host time spent in a scope and adds it to a counter.
+///
+/// Does nothing if constructed with a null counter.
+class PerfScopeTimer {
+public:
+    explicit PerfScopeTimer(PerfCounter *counter)
+        : m_counter(counter) {
+        if (m_counter != nullptr) [[unlikely]] {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~PerfScopeTimer() {
+        if (m_counter != nullptr) [[unlikely]] {
+            const auto elapsed = std::chrono::steady_clock::now() - m_start;
+            m_counter->Add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+    PerfScopeTimer(const PerfScopeTimer &) = delete;
+    PerfScopeTimer &operator=(const PerfScopeTimer &) = delete;
+
+private:
+    PerfCounter *m_counter;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/// @brief A thread-safe ring of the stats of the most recent frames.
+class PerfHistory {
+public:
+    /// @brief The number of frames retained.
+    static constexpr size_t kSize = 120;
+
+    void Push(const PerfFrameStats &stats);
+    void Clear();
+
+    [[nodiscard]] PerfStats Snapshot() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::array<PerfFrameStats, kSize> m_frames{};
+    size_t m_next = 0;
+    size_t m_count = 0;
+};
+
+} // namespace ymir::debug
@@ -17,11 +17,26 @@ namespace ymir::debug {
 ///
 /// Attach to an instance of `ymir::sh2::SH2` with its `UseTracer(ISH2Tracer *)` method.
 ///
-/// @note This tracer requires the emulator to execute in debug tracing mode.
+/// @note This tracer requires the emulator to execute in debug tracing mode. Instruction execution and DMA data
+/// transfer events are only delivered while `NeedsHotPathEvents()` returns `true`; all other events are delivered
+/// whenever the tracer is attached.
 struct ISH2Tracer {
     /// @brief Default virtual destructor. Required for inheritance.
     virtual ~ISH2Tracer() = default;
 
+    /// @brief Determines if the tracer wants to receive `ExecuteInstruction` and `DMAXferData` events.
+    ///
+    /// These events are raised on the CPU's hot path and require the emulator to run its instrumented code paths. When
+    /// every attached tracer returns `false` and no other debugging features are in use, the emulator runs the faster
+    /// uninstrumented code paths even in debug tracing mode.
+    ///
+    /// The value is polled once per frame or step, so it may change at any time.
+    ///
+    /// @return `true` if the tracer needs instruction execution and DMA data transfer events
+    virtual bool NeedsHotPathEvents() const {
+        return true;
+    }
+
     /// @brief Invoked immediately before executing an instruction.
     /// @param[in] pc the current program counter
     /// @param[in] opcode the instruction opcode
@@ -0,0 +1,238 @@
+#pragma once
+
+/**
+@file
+@brief Compact, compressed binary trace files for long-running debug traces.
+
+Trace files hold fixed-size `ymir::debug::TraceEvent` records split into one or more streams (e.g. one per CPU). Events
+are grouped per stream into LZ4-compressed chunks, and an index of all chunks is appended when the file is closed. The
+index records the cycle and frame ranges covered by each chunk, allowing readers to seek to any point in the trace
+without decompressing the preceding data.
+
+File format (all values little-endian):
+- File header:
+  - `char[8]` magic = `"YMIRTRCE"`
+  - `uint32` version = 1
+  - `uint8` number of streams, each followed by a `uint8` name length and the name
+- One record per chunk:
+  - `uint32` compressed size
+  - `uint32` number of events
+  - `uint64` cycle of the first event
+  - `uint64` cycle of the last event
+  - `uint32` frame of the first event
+  - `uint32` frame of the last event
+  - `uint8` stream index
+  - `uint8[]` LZ4-compressed events (16 bytes per event), stored as separate arrays of each field in order:
+    - `uint64` cycle, relative to the cycle of the previous event; the first entry is always zero
+    - `uint32` data
+    - `uint16` ext
+    - `uint8` type
+    - `uint8` param
+- Chunk index:
+  - `uint32` number of chunks, each followed by the `uint64` file offset of the chunk record
+- Trailer:
+  - `uint64` file offset of the chunk index
+  - `char[8]` magic = `"YMIRTIDX"`
+
+The index is redundant with the chunk records, so traces that were not closed properly (e.g. due to a crash) can still
+be read: the reader rebuilds the index by walking the chunk records.
+*/
+
+#include <ymir/core/types.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace ymir::debug {
+
+/// @brief Trace event types.
+enum class TraceEventType : uint8 {
+    /// @brief Start of a new frame.
+    /// - `data`: the frame number
+    Frame,
+
+    /// @brief SH-2 instruction about to be executed.
+    /// - `data`: PC
+    /// - `ext`: the instruction opcode
+    /// - `param`: 1 if the instruction is in a delay slot, 0 otherwise
+    SH2Instruction,
+
+    /// @brief SH-2 interrupt handled.
+    /// - `data`: PC
+    /// - `ext`: the interrupt level in the low byte and the `ymir::sh2::InterruptSource` in the high byte
+    /// - `param`: the vector number
+    SH2Interrupt,
+
+    /// @brief SH-2 exception handled.
+    /// - `data`: PC
+    /// - `ext`: the lower 16 bits of SR
+    /// - `param`: the vector number
+    SH2Exception,
+};
+
+/// @brief A single trace event. The meaning of the `data`, `ext` and `param` fields depends on the event type.
+struct TraceEvent {
+    uint64 cycle;        ///< The cycle count of the stream's producer at the moment of the event
+    uint32 data;         ///< Primary event data
+    uint16 ext;          ///< Secondary event data
+    TraceEventType type; ///< The event type
+    uint8 param;         ///< Tertiary event data
+};
+static_assert(sizeof(TraceEvent) == 16);
+
+/// @brief Describes a chunk of events in a trace file.
+struct TraceChunkInfo {
+    uint64 offset;         ///< File offset of the chunk record
+    uint32 compressedSize; ///< Size of the compressed events
+    uint32 eventCount;     ///< Number of events in the chunk
+    uint64 firstCycle;     ///< Cycle of the first event
+    uint64 lastCycle;      ///< Cycle of the last event
+    uint32 firstFrame;     ///< Frame of the first event
+    uint32 lastFrame;      ///< Frame of the last event
+    uint8 stream;          ///< Index of the stream the chunk belongs to
+};
+
+/// @brief Writes trace files.
+///
+/// Events are assigned to the frame of the most recent `TraceEventType::Frame` event in the same stream, or frame 0 if
+/// none were written yet.
+///
+/// This class is not thread-safe.
+class TraceFileWriter {
+public:
+    /// @brief The maximum number of events per chunk.
+    static constexpr uint32 kChunkEvents = 65536;
+
+    /// @brief Closes the file if it is still open.
+    ~TraceFileWriter();
+
+    /// @brief Creates a trace file at the given path, replacing any existing file.
+    /// @param[in] path the path of the trace file
+    /// @param[in] streamNames the names of the streams; up to 255 streams are allowed
+    /// @param[out] error receives the error if the file could not be created
+    /// @return `true` if the file was created successfully
+    bool Open(const std::filesystem::path &path, std::span<const std::string> streamNames, std::error_code &error);
+
+    /// @brief Appends events to a stream.
+    ///
+    /// Events are buffered and written in compressed chunks of up to `kChunkEvents` events.
+    ///
+    /// @param[in] stream the stream index
+    /// @param[in] events the events to append
+    void Write(uint8 stream, std::span<const TraceEvent> events);
+
+    /// @brief Writes all buffered events, the chunk index and the trailer, then closes the file.
+    /// @return `true` if all data was written successfully
+    bool Close();
+
+    /// @brief Determines if a trace file is open.
+    [[nodiscard]] bool IsOpen() const {
+        return m_out.is_open();
+    }
+
+    /// @brief Retrieves the total number of events written to all streams since the file was opened.
+    [[nodiscard]] uint64 EventCount() const {
+        return m_eventCount;
+    }
+
+private:
+    struct Stream {
+        std::vector<TraceEvent> pending;
+        uint32 frame = 0;
+        uint32 firstFrame = 0;
+    };
+
+    std::ofstream m_out;
+    std::vector<Stream> m_streams;
+    std::vector<TraceChunkInfo> m_chunks;
+    uint64 m_eventCount = 0;
+
+    std::vector<uint8> m_raw;
+    std::vector<char> m_compressed;
+
+    void FlushChunk(uint8 stream);
+};
+
+/// @brief Reads trace files produced by `TraceFileWriter`.
+///
+/// The reader iterates over the events of one stream at a time, selected with `SelectStream`.
+///
+/// The cycle counter restarts from zero when the system is hard reset, so cycle seeks are only meaningful in traces
+/// that do not span a hard reset. Frame numbers are assigned by the trace producer and always increase.
+class TraceFileReader {
+public:
+    /// @brief Opens the trace file at the given path and reads its chunk index.
+    ///
+    /// If the file has no index, it is rebuilt by walking the chunk records. Truncated chunks at the end of the file are
+    /// ignored.
+    ///
+    /// @param[in] path the path of the trace file
+    /// @param[out] error receives the error if the file could not be read
+    /// @return `true` if the file was opened successfully
+    bool Open(const std::filesystem::path &path, std::error_code &error);
+
+    /// @brief Retrieves the names of the streams in the trace.
+    [[nodiscard]] std::span<const std::string> GetStreamNames() const {
+        return m_streamNames;
+    }
+
+    /// @brief Retrieves the chunks of all streams in file order.
+    [[nodiscard]] std::span<const TraceChunkInfo> GetChunks() const {
+        return m_chunks;
+    }
+
+    /// @brief Determines if the chunk index was read from the file. If `false`, the index was rebuilt.
+    [[nodiscard]] bool HasIndex() const {
+        return m_hasIndex;
+    }
+
+    /// @brief Selects the stream to read events from and rewinds to its first event.
+    /// @param[in] stream the stream index
+    /// @return `true` if the stream exists
+    bool SelectStream(uint8 stream);
+
+    /// @brief Positions the reader at the first event of the selected stream that belongs to the given frame or a later
+    /// one.
+    /// @param[in] frame the frame number to seek to
+    /// @return `true` if such an event exists
+    bool SeekFrame(uint32 frame);
+
+    /// @brief Positions the reader at the first event of the selected stream whose cycle count is at least `cycle`.
+    /// @param[in] cycle the cycle count to seek to
+    /// @return `true` if such an event exists
+    bool SeekCycle(uint64 cycle);
+
+    /// @brief Reads the next event from the selected stream.
+    /// @param[out] event receives the event
+    /// @return `true` if an event was read, `false` at the end of the stream or if the chunk could not be read
+    bool Next(TraceEvent &event);
+
+    /// @brief Retrieves the frame of the event most recently returned by `Next`.
+    [[nodiscard]] uint32 CurrentFrame() const {
+        return m_frame;
+    }
+
+private:
+    std::ifstream m_in;
+    std::vector<std::string> m_streamNames;
+    std::vector<TraceChunkInfo> m_chunks;
+    bool m_hasIndex = false;
+
+    std::vector<size_t> m_streamChunks; // Indices into m_chunks of the chunks in the selected stream
+    size_t m_chunkPos = 0;              // Position in m_streamChunks of the next chunk to load
+    std::vector<TraceEvent> m_events;   // Events of the current chunk
+    size_t m_eventPos = 0;              // Position in m_events of the next event to read
+    uint32 m_frame = 0;                 // Frame of the last event read
+
+    std::vector<char> m_compressed;
+
+    bool ReadIndex(uint64 fileSize);
+    void RebuildIndex(uint64 dataOffset, uint64 fileSize);
+    bool LoadChunk(size_t streamChunkPos);
+};
+
+} // namespace ymir::debug
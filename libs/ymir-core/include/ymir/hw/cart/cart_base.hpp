@@ -2,6 +2,8 @@
 
 #include <ymir/core/types.hpp>
 
+#include <ymir/sys/bus.hpp>
+
 #include <ymir/util/inline.hpp>
 
 namespace ymir::cart {
@@ -97,6 +99,11 @@ public:
     virtual void PokeByte(uint32 address, uint8 value) = 0;
     virtual void PokeWord(uint32 address, uint16 value) = 0;
 
+    // Maps the regions of this cartridge that can be accessed directly as plain memory into the bus.
+    // The SCU maps the read/write handlers above to the entire cartridge area before invoking this method, so
+    // cartridges only need to override it to map arrays over regions without side effects.
+    virtual void MapMemory(sys::SH2Bus &bus) {}
+
 protected:
     void ChangeID(uint8 id) {
         m_id = id;
@@ -43,6 +43,11 @@ protected:
 // Upper 512 KiB mapped to 0x260'0000..0x26F'FFFF, mirrored twice
 class DRAM8MbitCartridge final : public BaseDRAMCartridge<0x5A, 1_MiB, CartType::DRAM8Mbit> {
 public:
+    void MapMemory(sys::SH2Bus &bus) override {
+        bus.MapArray(0x240'0000, 0x24F'FFFF, std::span{m_ram}.first<512_KiB>(), true);
+        bus.MapArray(0x260'0000, 0x26F'FFFF, std::span{m_ram}.last<512_KiB>(), true);
+    }
+
     uint8 ReadByte(uint32 address) const override {
         switch (address >> 20) {
         case 0x24: return m_ram[address & 0x7FFFF];
@@ -94,6 +99,10 @@ public:
 // Mapped to 0x240'0000..0x27F'FFFF
 class DRAM32MbitCartridge final : public BaseDRAMCartridge<0x5C, 4_MiB, CartType::DRAM32Mbit> {
 public:
+    void MapMemory(sys::SH2Bus &bus) override {
+        bus.MapArray(0x240'0000, 0x27F'FFFF, m_ram, true);
+    }
+
     uint8 ReadByte(uint32 address) const override {
         if (util::AddressInRange<0x240'0000, 0x27F'FFFF>(address)) {
             return m_ram[address & 0x3FFFFF];
@@ -143,6 +152,12 @@ public:
 // Mapped to 0x400'0000..0x45F'FFFF
 class DRAM48MbitCartridge final : public BaseDRAMCartridge<0x5C, 6_MiB, CartType::DRAM48Mbit> {
 public:
+    void MapMemory(sys::SH2Bus &bus) override {
+        // 6 MiB is not a power of two, so map the RAM as a 4 MiB bank followed by a 2 MiB bank
+        bus.MapArray(0x400'0000, 0x43F'FFFF, std::span{m_ram}.first<4_MiB>(), true);
+        bus.MapArray(0x440'0000, 0x45F'FFFF, std::span{m_ram}.subspan<4_MiB, 2_MiB>(), true);
+    }
+
     uint8 ReadByte(uint32 address) const override {
         if (util::AddressInRange<0x400'0000, 0x45F'FFFF>(address)) {
             return m_ram[address & 0x7FFFFF];
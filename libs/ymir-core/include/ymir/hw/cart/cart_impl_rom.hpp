@@ -13,6 +13,10 @@ public:
     ROMCartridge()
         : BaseCartridge(0xFFu, CartType::ROM) {}
 
+    void MapMemory(sys::SH2Bus &bus) override {
+        bus.MapArray(0x200'0000, 0x3FF'FFFF, m_rom, false);
+    }
+
     uint8 ReadByte(uint32 address) const override {
         if (util::AddressInRange<0x200'0000, 0x3FF'FFFF>(address)) {
             return m_rom[address & (kROMCartSize - 1)];
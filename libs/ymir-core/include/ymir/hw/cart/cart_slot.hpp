@@ -47,6 +47,11 @@ public:
         return m_cart->GetType();
     }
 
+    // Maps the inserted cartridge's directly accessible memory regions into the bus.
+    void MapMemory(sys::SH2Bus &bus) {
+        m_cart->MapMemory(bus);
+    }
+
     template <bool peek>
     uint8 ReadByte(uint32 address) const {
         if constexpr (peek) {
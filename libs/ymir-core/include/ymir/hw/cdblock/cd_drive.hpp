@@ -15,6 +15,7 @@
 
 #include <ymir/media/disc.hpp>
 #include <ymir/media/filesystem.hpp>
+#include <ymir/media/sector_read_ahead.hpp>
 
 #include <ymir/core/configuration.hpp>
 #include <ymir/core/hash.hpp>
@@ -102,7 +103,7 @@ public:
     };
 
     CDDrive(core::Scheduler &scheduler, const media::Disc &disc, const media::fs::Filesystem &fs,
-            core::Configuration::CDBlock &config);
+            media::SectorReadAhead &readAhead, core::Configuration::CDBlock &config);
 
     void Reset(bool hard);
 
@@ -183,6 +184,7 @@ private:
 
     const media::Disc &m_disc;
     const media::fs::Filesystem &m_fs;
+    media::SectorReadAhead &m_readAhead;
 
     // The CD block program only responds to disc change events if they follow the Tray Open state.
     // The auto close tray flag causes the TrayOpen operation processor to automatically close the tray and switch to
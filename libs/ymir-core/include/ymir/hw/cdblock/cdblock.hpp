@@ -22,18 +22,18 @@
 
 #include <ymir/media/disc.hpp>
 #include <ymir/media/filesystem.hpp>
+#include <ymir/media/sector_read_ahead.hpp>
 
 #include <ymir/core/hash.hpp>
 
 #include <array>
-#include <deque>
 
 namespace ymir::cdblock {
 
 class CDBlock {
 public:
     CDBlock(core::Scheduler &scheduler, const media::Disc &disc, const media::fs::Filesystem &fs,
-            core::Configuration::CDBlock &config);
+            media::SectorReadAhead &readAhead, core::Configuration::CDBlock &config);
 
     void Reset(bool hard);
 
@@ -75,6 +75,7 @@ private:
 
     const media::Disc &m_disc;
     const media::fs::Filesystem &m_fs;
+    media::SectorReadAhead &m_readAhead;
     media::fs::FilesystemState m_fsState{m_fs};
 
     // -------------------------------------------------------------------------
@@ -269,6 +270,8 @@ private:
     //
     // Disconnected filter output connectors will result in dropping the data.
 
+    // Sectors are stored in a fixed pool of buffers. Partitions are singly-linked lists of buffer indices ordered from
+    // oldest to newest, so filtering, moving and deleting sectors only relinks indices instead of copying sector data.
     class PartitionManager {
     public:
         PartitionManager();
@@ -281,9 +284,21 @@ private:
         bool UseReservedBuffers(uint16 count);
         void ReleaseReservedBuffers();
 
+        // Takes a buffer from the free pool without assigning it to a partition.
+        // Returns nullptr if there are no free buffers.
+        // The buffer must be handed back with either CommitBuffer or ReleaseBuffer.
+        Buffer *AllocateBuffer();
+        // Appends a buffer obtained from AllocateBuffer or DetachTail to the partition.
+        void CommitBuffer(uint8 partitionIndex, Buffer *buffer);
+        // Returns a buffer obtained from AllocateBuffer or DetachTail to the free pool.
+        void ReleaseBuffer(Buffer *buffer);
+
         void InsertHead(uint8 partitionIndex, const Buffer &buffer);
         Buffer *GetTail(uint8 partitionIndex, uint8 offset);
         bool RemoveTail(uint8 partitionIndex, uint8 offset);
+        // Unlinks the buffer at the specified offset from the partition without freeing it.
+        // Returns nullptr if the offset is out of range.
+        Buffer *DetachTail(uint8 partitionIndex, uint8 offset);
 
         uint32 DeleteSectors(uint8 partitionIndex, uint16 sectorPos, uint16 sectorCount);
 
@@ -299,10 +314,29 @@ private:
         void LoadState(const state::CDBlockState &state);
 
     private:
-        std::array<std::deque<Buffer>, kNumPartitions> m_partitions;
+        static constexpr uint8 kNil = 0xFF;
+        static_assert(kNumBuffers < kNil, "buffer indices must fit in uint8");
+
+        struct Partition {
+            uint8 first = kNil; // oldest buffer
+            uint8 last = kNil;  // newest buffer
+            uint8 count = 0;
+        };
+
+        std::array<Buffer, kNumBuffers> m_buffers; // buffer pool
+        std::array<uint8, kNumBuffers> m_next;     // next buffer in the partition or free list
+        std::array<Partition, kNumPartitions> m_partitions;
+        uint8 m_freeHead;
 
         uint32 m_freeBuffers;
         uint32 m_reservedBuffers;
+
+        uint8 IndexOf(const Buffer *buffer) const;
+        uint8 FindIndex(uint8 partitionIndex, uint32 offset) const;
+        uint8 PopFree();
+        void PushFree(uint8 index);
+        void Append(Partition &partition, uint8 index);
+        uint8 Unlink(Partition &partition, uint32 offset);
     };
 
     PartitionManager m_partitionManager;
@@ -320,6 +354,15 @@ private:
     uint32 m_putSectorLength;
     uint32 m_putOffset;
 
+    // Runs a buffer through the filter chain starting at the specified filter, taking ownership of the buffer.
+    // Returns the partition that received the buffer, or Filter::kDisconnected if the buffer was discarded.
+    uint8 RouteSector(uint8 filterNum, Buffer *buffer);
+
+    // Copies or moves sectors from a partition into the specified filter.
+    // Returns false if the parameters are invalid or there is not enough room to copy the sectors.
+    bool RelocateSectors(uint8 dstFilterNumber, uint8 srcPartitionNumber, uint16 sectorOffset, uint16 sectorNumber,
+                         bool copy);
+
     bool ConnectCDDevice(uint8 filterNumber);
     bool DisconnectCDDevice(uint8 filterNumber);
 
@@ -37,6 +37,13 @@ struct YGR {
         m_cbTriggerExternalInterrupt0 = triggerExternalInterrupt0;
     }
 
+    // Sets a callback invoked before every host bus access made by the emulated CPUs.
+    // Used to synchronize with the CD block when it runs in a separate thread. Must only be invoked from the emulator
+    // thread, so debugger peeks and pokes, which can come from any thread, do not call it.
+    void SetHostAccessCallback(CBHostAccess hostAccess) {
+        m_cbHostAccess = hostAccess;
+    }
+
     void MapMemory(sys::SH1Bus &cdbBus);
     void MapMemory(sys::SH2Bus &mainBus);
 
@@ -88,6 +95,7 @@ private:
     sh1::CBSetDREQn m_cbSetDREQ1n;
     sh1::CBStepDMAC m_cbStepDMAC1;
     CBTriggerExternalInterrupt0 m_cbTriggerExternalInterrupt0;
+    CBHostAccess m_cbHostAccess;
 
     // Legend:
     // xx r/w   yy r/w   code        name
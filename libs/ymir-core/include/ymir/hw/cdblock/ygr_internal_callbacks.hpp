@@ -14,4 +14,7 @@ namespace ymir::cdblock {
 /// @brief Invoked when a sector transfer is finished
 using CBSectorTransferDone = util::RequiredCallback<void()>;
 
+/// @brief Invoked before the host accesses the YGR through the main bus
+using CBHostAccess = util::OptionalCallback<void()>;
+
 } // namespace ymir::cdblock
@@ -297,8 +297,7 @@ struct DecodeTable {
     alignas(64) std::array<OpcodeType, 0x10000> opcodeTypes;
 };
 
-DecodeTable BuildDecodeTable();
-
-extern DecodeTable g_decodeTable;
+// The decoding table is generated at compile time and lives in read-only memory.
+extern const DecodeTable g_decodeTable;
 
 } // namespace ymir::m68k
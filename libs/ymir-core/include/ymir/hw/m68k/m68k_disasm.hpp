@@ -157,181 +157,181 @@ struct Operand {
         sint16 simm; // #simm (embedded in opcode)
     };
 
-    static Operand None() {
+    static constexpr Operand None() {
         return {.type = Type::None};
     }
 
-    static Operand Dn_R(uint8 rn) {
+    static constexpr Operand Dn_R(uint8 rn) {
         return {.type = Type::Dn, .read = true, .write = false, .rn = rn};
     }
-    static Operand Dn_W(uint8 rn) {
+    static constexpr Operand Dn_W(uint8 rn) {
         return {.type = Type::Dn, .read = false, .write = true, .rn = rn};
     }
-    static Operand Dn_RW(uint8 rn) {
+    static constexpr Operand Dn_RW(uint8 rn) {
         return {.type = Type::Dn, .read = true, .write = true, .rn = rn};
     }
 
-    static Operand An_R(uint8 rn) {
+    static constexpr Operand An_R(uint8 rn) {
         return {.type = Type::An, .read = true, .write = false, .rn = rn};
     }
-    static Operand An_W(uint8 rn) {
+    static constexpr Operand An_W(uint8 rn) {
         return {.type = Type::An, .read = false, .write = true, .rn = rn};
     }
-    static Operand An_RW(uint8 rn) {
+    static constexpr Operand An_RW(uint8 rn) {
         return {.type = Type::An, .read = true, .write = true, .rn = rn};
     }
 
-    static Operand AtAn_N(uint8 rn) {
+    static constexpr Operand AtAn_N(uint8 rn) {
         return {.type = Type::AtAn, .read = false, .write = false, .rn = rn};
     }
-    static Operand AtAn_R(uint8 rn) {
+    static constexpr Operand AtAn_R(uint8 rn) {
         return {.type = Type::AtAn, .read = true, .write = false, .rn = rn};
     }
-    static Operand AtAn_W(uint8 rn) {
+    static constexpr Operand AtAn_W(uint8 rn) {
         return {.type = Type::AtAn, .read = false, .write = true, .rn = rn};
     }
-    static Operand AtAn_RW(uint8 rn) {
+    static constexpr Operand AtAn_RW(uint8 rn) {
         return {.type = Type::AtAn, .read = true, .write = true, .rn = rn};
     }
 
-    static Operand AtAnPlus_R(uint8 rn) {
+    static constexpr Operand AtAnPlus_R(uint8 rn) {
         return {.type = Type::AtAnPlus, .read = true, .write = false, .rn = rn};
     }
-    static Operand AtAnPlus_W(uint8 rn) {
+    static constexpr Operand AtAnPlus_W(uint8 rn) {
         return {.type = Type::AtAnPlus, .read = false, .write = true, .rn = rn};
     }
-    static Operand AtAnPlus_RW(uint8 rn) {
+    static constexpr Operand AtAnPlus_RW(uint8 rn) {
         return {.type = Type::AtAnPlus, .read = true, .write = true, .rn = rn};
     }
 
-    static Operand MinusAtAn_R(uint8 rn) {
+    static constexpr Operand MinusAtAn_R(uint8 rn) {
         return {.type = Type::MinusAtAn, .read = true, .write = false, .rn = rn};
     }
-    static Operand MinusAtAn_W(uint8 rn) {
+    static constexpr Operand MinusAtAn_W(uint8 rn) {
         return {.type = Type::MinusAtAn, .read = false, .write = true, .rn = rn};
     }
-    static Operand MinusAtAn_RW(uint8 rn) {
+    static constexpr Operand MinusAtAn_RW(uint8 rn) {
         return {.type = Type::MinusAtAn, .read = true, .write = true, .rn = rn};
     }
 
-    static Operand AtDispAn_N(uint8 rn) {
+    static constexpr Operand AtDispAn_N(uint8 rn) {
         return {.type = Type::AtDispAn, .read = false, .write = false, .rn = rn};
     }
-    static Operand AtDispAn_R(uint8 rn) {
+    static constexpr Operand AtDispAn_R(uint8 rn) {
         return {.type = Type::AtDispAn, .read = true, .write = false, .rn = rn};
     }
-    static Operand AtDispAn_W(uint8 rn) {
+    static constexpr Operand AtDispAn_W(uint8 rn) {
         return {.type = Type::AtDispAn, .read = false, .write = true, .rn = rn};
     }
-    static Operand AtDispAn_RW(uint8 rn) {
+    static constexpr Operand AtDispAn_RW(uint8 rn) {
         return {.type = Type::AtDispAn, .read = true, .write = true, .rn = rn};
     }
 
-    static Operand AtDispAnIx_N(uint8 rn) {
+    static constexpr Operand AtDispAnIx_N(uint8 rn) {
         return {.type = Type::AtDispAnIx, .read = false, .write = false, .rn = rn};
     }
-    static Operand AtDispAnIx_R(uint8 rn) {
+    static constexpr Operand AtDispAnIx_R(uint8 rn) {
         return {.type = Type::AtDispAnIx, .read = true, .write = false, .rn = rn};
     }
-    static Operand AtDispAnIx_W(uint8 rn) {
+    static constexpr Operand AtDispAnIx_W(uint8 rn) {
         return {.type = Type::AtDispAnIx, .read = false, .write = true, .rn = rn};
     }
-    static Operand AtDispAnIx_RW(uint8 rn) {
+    static constexpr Operand AtDispAnIx_RW(uint8 rn) {
         return {.type = Type::AtDispAnIx, .read = true, .write = true, .rn = rn};
     }
 
-    static Operand AtDispPC_N() {
+    static constexpr Operand AtDispPC_N() {
         return {.type = Type::AtDispPC, .read = false, .write = false};
     }
-    static Operand AtDispPC_R() {
+    static constexpr Operand AtDispPC_R() {
         return {.type = Type::AtDispPC, .read = true, .write = false};
     }
 
-    static Operand AtDispPCIx_N() {
+    static constexpr Operand AtDispPCIx_N() {
         return {.type = Type::AtDispPCIx, .read = false, .write = false};
     }
-    static Operand AtDispPCIx_R() {
+    static constexpr Operand AtDispPCIx_R() {
         return {.type = Type::AtDispPCIx, .read = true, .write = false};
     }
 
-    static Operand AtImmWord_N() {
+    static constexpr Operand AtImmWord_N() {
         return {.type = Type::AtImmWord, .read = false, .write = false};
     }
-    static Operand AtImmWord_R() {
+    static constexpr Operand AtImmWord_R() {
         return {.type = Type::AtImmWord, .read = true, .write = false};
     }
-    static Operand AtImmWord_W() {
+    static constexpr Operand AtImmWord_W() {
         return {.type = Type::AtImmWord, .read = false, .write = true};
     }
-    static Operand AtImmWord_RW() {
+    static constexpr Operand AtImmWord_RW() {
         return {.type = Type::AtImmWord, .read = true, .write = true};
     }
 
-    static Operand AtImmLong_N() {
+    static constexpr Operand AtImmLong_N() {
         return {.type = Type::AtImmLong, .read = false, .write = false};
     }
-    static Operand AtImmLong_R() {
+    static constexpr Operand AtImmLong_R() {
         return {.type = Type::AtImmLong, .read = true, .write = false};
     }
-    static Operand AtImmLong_W() {
+    static constexpr Operand AtImmLong_W() {
         return {.type = Type::AtImmLong, .read = false, .write = true};
     }
-    static Operand AtImmLong_RW() {
+    static constexpr Operand AtImmLong_RW() {
         return {.type = Type::AtImmLong, .read = true, .write = true};
     }
 
-    static Operand UImmEmbedded(uint16 uimm) {
+    static constexpr Operand UImmEmbedded(uint16 uimm) {
         return {.type = Type::UImmEmbedded, .uimm = uimm};
     }
-    static Operand UImm8Fetched() {
+    static constexpr Operand UImm8Fetched() {
         return {.type = Type::UImm8Fetched};
     }
-    static Operand UImm16Fetched() {
+    static constexpr Operand UImm16Fetched() {
         return {.type = Type::UImm16Fetched};
     }
-    static Operand UImm32Fetched() {
+    static constexpr Operand UImm32Fetched() {
         return {.type = Type::UImm32Fetched};
     }
 
-    static Operand WordDispPCEmbedded(sint16 imm) {
+    static constexpr Operand WordDispPCEmbedded(sint16 imm) {
         return {.type = Type::WordDispPCEmbedded, .simm = imm};
     }
-    static Operand WordDispPCFetched() {
+    static constexpr Operand WordDispPCFetched() {
         return {.type = Type::WordDispPCFetched};
     }
 
-    static Operand CCR_R() {
+    static constexpr Operand CCR_R() {
         return {.type = Type::CCR, .read = true, .write = false};
     }
-    static Operand CCR_W() {
+    static constexpr Operand CCR_W() {
         return {.type = Type::CCR, .read = false, .write = true};
     }
 
-    static Operand SR_R() {
+    static constexpr Operand SR_R() {
         return {.type = Type::SR, .read = true, .write = false};
     }
-    static Operand SR_W() {
+    static constexpr Operand SR_W() {
         return {.type = Type::SR, .read = false, .write = true};
     }
 
-    static Operand USP_R() {
+    static constexpr Operand USP_R() {
         return {.type = Type::USP, .read = true, .write = false};
     }
-    static Operand USP_W() {
+    static constexpr Operand USP_W() {
         return {.type = Type::USP, .read = false, .write = true};
     }
 
-    static Operand RegList_R() {
+    static constexpr Operand RegList_R() {
         return {.type = Type::RegList, .read = true, .write = false};
     }
-    static Operand RegList_W() {
+    static constexpr Operand RegList_W() {
         return {.type = Type::RegList, .read = false, .write = true};
     }
 
-    static Operand RevRegList_R() {
+    static constexpr Operand RevRegList_R() {
         return {.type = Type::RevRegList, .read = true, .write = false};
     }
-    static Operand RevRegList_W() {
+    static constexpr Operand RevRegList_W() {
         return {.type = Type::RevRegList, .read = false, .write = true};
     }
 };
@@ -359,14 +359,15 @@ struct DisassembledInstruction {
     std::vector<uint16> opcodes;
 };
 
+// The disassembly table is generated at compile time and lives in read-only memory.
 struct DisassemblyTable {
 private:
     static constexpr auto alignment = 64;
 
-    DisassemblyTable();
+    constexpr DisassemblyTable();
 
 public:
-    static DisassemblyTable s_instance;
+    static const DisassemblyTable s_instance;
 
     alignas(alignment) std::array<DisassemblyInfo, 0x10000> infos;
 };
@@ -3,6 +3,7 @@
 #include "scsp_defs.hpp"
 #include "scsp_dsp.hpp"
 #include "scsp_midi_defs.hpp"
+#include "scsp_sample_ring.hpp"
 #include "scsp_slot.hpp"
 #include "scsp_timer.hpp"
 
@@ -18,6 +19,7 @@
 
 #include <ymir/hw/hw_defs.hpp>
 
+#include <ymir/debug/perf_counters.hpp>
 #include <ymir/debug/scsp_tracer_base.hpp>
 
 #include <ymir/hw/cdblock/cdblock_internal_callbacks.hpp>
@@ -120,10 +122,28 @@ public:
         m_cbSendMidiOutputMessage = callback;
     }
 
+    // Sets the per-sample output callback. Only used when no sample ring buffer is attached.
     void SetSampleCallback(CBOutputSample callback) {
         m_cbOutputSample = callback;
     }
 
+    // Attaches a ring buffer to receive output samples in blocks of the specified size, replacing the per-sample
+    // callback. The block callback is invoked on the emulator thread after each block is published and may block to
+    // wait for the consumer. Pass nullptr to detach the ring buffer.
+    void SetSampleRingBuffer(SampleRingBuffer *ring, uint32 blockSize, CBOutputSampleBlock callback) {
+        m_sampleRing = ring;
+        m_sampleBlockSize = std::max(blockSize, 1u);
+        m_sampleBlockCount = 0;
+        m_cbOutputSampleBlock = callback;
+    }
+
+    // Attaches a ring buffer that receives a copy of every output sample while a sample ring buffer is attached, used
+    // to capture audio output. Samples are pushed but never published; the owner is responsible for publishing them
+    // from the emulator thread. Pass nullptr to detach the capture ring buffer.
+    void SetSampleCaptureRingBuffer(SampleRingBuffer *ring) {
+        m_captureRing = ring;
+    }
+
     void MapCallbacks(CBTriggerSoundRequestInterrupt callback) {
         m_cbTriggerSoundRequestInterrupt = callback;
     }
@@ -150,7 +170,8 @@ public:
         return 5u - m_stepGranularity;
     }
 
-    // Enables or disables debug tracing
+    // Enables or disables debug tracing.
+    // The instrumented sample processing functions are only used while a tracer is also attached.
     void SetDebugTracing(bool enable);
 
     [[nodiscard]] bool IsDebugTracingEnabled() const noexcept {
@@ -224,28 +245,32 @@ private:
     template <uint32 newStepShift, bool debug>
     static void OnTransitionalTickEvent(core::EventContext &eventContext, void *userContext);
 
-    // Retrieves a pointer to the transitional tick event processing function based on the current debug tracing mode.
+    // Retrieves a pointer to the transitional tick event processing function based on the current instrumentation mode.
     template <uint32 newStepShift>
     auto GetTransitionalTickEvent() {
-        return m_debugTracing ? OnTransitionalTickEvent<newStepShift, true>
-                              : OnTransitionalTickEvent<newStepShift, false>;
+        return m_debugInstrumented ? OnTransitionalTickEvent<newStepShift, true>
+                                   : OnTransitionalTickEvent<newStepShift, false>;
     }
 
-    // Retrieves a pointer to the slot tick event processing function based on the current debug tracing mode.
+    // Retrieves a pointer to the slot tick event processing function based on the current instrumentation mode.
     template <uint32 stepShift>
     auto GetSlotTickEvent() const {
-        return m_debugTracing ? OnSlotTickEvent<stepShift, true> : OnSlotTickEvent<stepShift, false>;
+        return m_debugInstrumented ? OnSlotTickEvent<stepShift, true> : OnSlotTickEvent<stepShift, false>;
     }
 
-    // Retrieves a pointer to the sample tick event processing function based on the current debug tracing mode.
+    // Retrieves a pointer to the sample tick event processing function based on the current instrumentation mode.
     auto GetSampleTickEvent() const {
-        return m_debugTracing ? OnSampleTickEvent<true> : OnSampleTickEvent<false>;
+        return m_debugInstrumented ? OnSampleTickEvent<true> : OnSampleTickEvent<false>;
     }
 
     // Updates the step function for processing samples.
-    // Takes into account the current granularity step size and the debug tracing flag.
+    // Takes into account the current granularity step size and the instrumentation mode.
     void UpdateStepFunction();
 
+    // Switches to the instrumented sample processing functions if debug tracing is enabled and a tracer is attached,
+    // or back to the regular functions otherwise.
+    void UpdateDebugInstrumentation();
+
     // The emulation step granularity expressed as a bit shift.
     // Note that this is inverted relative to the values given by the public interface (5 - value), therefore:
     //   5 = step 32 slots (one sample) at a time (least granular, default)
@@ -255,7 +280,20 @@ private:
     // Whether debug tracing is enabled
     bool m_debugTracing = false;
 
+    // Whether the instrumented sample processing functions are in use
+    bool m_debugInstrumented = false;
+
     CBOutputSample m_cbOutputSample;
+    CBOutputSampleBlock m_cbOutputSampleBlock;
+
+    // Block output ring buffer, if attached
+    SampleRingBuffer *m_sampleRing = nullptr;
+    uint32 m_sampleBlockSize = 256;
+    uint32 m_sampleBlockCount = 0;
+
+    // Capture ring buffer, if attached
+    SampleRingBuffer *m_captureRing = nullptr;
+
     CBTriggerSoundRequestInterrupt m_cbTriggerSoundRequestInterrupt;
     CBSendMidiOutputMessage m_cbSendMidiOutputMessage;
 
@@ -1237,6 +1275,13 @@ public:
     // Pass nullptr to disable tracing.
     void UseTracer(debug::ISCSPTracer *tracer) {
         m_tracer = tracer;
+        UpdateDebugInstrumentation();
+    }
+
+    // Attaches the specified performance counters to this component.
+    // Pass nullptr to stop counting.
+    void UsePerfCounters(debug::PerfCounters *counters) {
+        m_perf = counters;
     }
 
     class Probe {
@@ -1282,6 +1327,7 @@ public:
 private:
     Probe m_probe{*this};
     debug::ISCSPTracer *m_tracer = nullptr;
+    debug::PerfCounters *m_perf = nullptr;
 };
 
 } // namespace ymir::scsp
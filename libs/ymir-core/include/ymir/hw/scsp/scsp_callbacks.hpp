@@ -9,6 +9,9 @@ namespace ymir::scsp {
 // Sample output callback, invoked every sample
 using CBOutputSample = util::OptionalCallback<void(sint16 left, sint16 right)>;
 
+// Sample block output callback, invoked after a block of samples is published to the output ring buffer
+using CBOutputSampleBlock = util::OptionalCallback<void(uint32 count)>;
+
 // MIDI message output callback, invoked when a complete midi message is ready to send
 using CBSendMidiOutputMessage = util::OptionalCallback<void(std::span<uint8> msg)>;
 
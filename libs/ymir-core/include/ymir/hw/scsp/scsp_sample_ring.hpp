@@ -0,0 +1,134 @@
+#pragma once
+
+/**
+@file
+@brief Lock-free single-producer single-consumer ring buffer for SCSP audio output.
+*/
+
+#include <ymir/core/types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <span>
+
+namespace ymir::scsp {
+
+/// @brief A lock-free single-producer single-consumer ring buffer of interleaved stereo samples.
+///
+/// The storage is provided by the caller and must hold a power-of-two number of stereo frames (two `sint16` values
+/// per frame, left then right). The SCSP is the producer: it pushes samples privately and publishes them in blocks.
+/// The consumer, typically an audio device callback, reads published frames without taking any locks.
+class SampleRingBuffer {
+public:
+    /// @brief Creates a ring buffer backed by the given storage.
+    /// @param[in] storage interleaved sample storage; `storage.size() / 2` must be a power of two
+    explicit SampleRingBuffer(std::span<sint16> storage)
+        : m_storage(storage)
+        , m_capacity(storage.size() / 2)
+        , m_mask(m_capacity - 1) {
+        assert(std::has_single_bit(m_capacity));
+    }
+
+    SampleRingBuffer(const SampleRingBuffer &) = delete;
+    SampleRingBuffer &operator=(const SampleRingBuffer &) = delete;
+
+    /// @brief Retrieves the capacity of the buffer in stereo frames.
+    [[nodiscard]] uint32 Capacity() const {
+        return m_capacity;
+    }
+
+    // -------------------------------------------------------------------------
+    // Producer side
+
+    /// @brief Writes a stereo frame without making it visible to the consumer.
+    /// @param[in] left the left channel sample
+    /// @param[in] right the right channel sample
+    /// @return `true` if the frame was written, `false` if the buffer is full and the frame was dropped
+    bool Push(sint16 left, sint16 right) {
+        if (m_pendingWrite - m_cachedRead >= m_capacity) {
+            m_cachedRead = m_readIndex.load(std::memory_order_acquire);
+            if (m_pendingWrite - m_cachedRead >= m_capacity) [[unlikely]] {
+                ++m_dropped;
+                return false;
+            }
+        }
+        const uint32 pos = (m_pendingWrite & m_mask) * 2;
+        m_storage[pos + 0] = left;
+        m_storage[pos + 1] = right;
+        ++m_pendingWrite;
+        return true;
+    }
+
+    /// @brief Makes all pushed frames visible to the consumer.
+    /// @return the number of frames published
+    uint32 Publish() {
+        const uint32 prev = m_writeIndex.load(std::memory_order_relaxed);
+        m_writeIndex.store(m_pendingWrite, std::memory_order_release);
+        return m_pendingWrite - prev;
+    }
+
+    /// @brief Retrieves the number of frames that can be pushed before the buffer becomes full.
+    [[nodiscard]] uint32 Free() const {
+        return m_capacity - (m_pendingWrite - m_readIndex.load(std::memory_order_acquire));
+    }
+
+    /// @brief Retrieves the total number of frames dropped by `Push` because the buffer was full.
+    [[nodiscard]] uint64 Dropped() const {
+        return m_dropped;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer side
+
+    /// @brief Contiguous regions of interleaved samples available for reading.
+    struct Regions {
+        std::span<const sint16> first;
+        std::span<const sint16> second;
+    };
+
+    /// @brief Retrieves the number of published frames available for reading.
+    [[nodiscard]] uint32 Available() const {
+        return m_writeIndex.load(std::memory_order_acquire) - m_readIndex.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Retrieves up to `maxFrames` published frames as at most two contiguous regions without consuming them.
+    /// @param[in] maxFrames the maximum number of frames to return
+    /// @return the readable regions, in order
+    [[nodiscard]] Regions Peek(uint32 maxFrames) const {
+        const uint32 readIndex = m_readIndex.load(std::memory_order_relaxed);
+        const uint32 count = std::min(maxFrames, m_writeIndex.load(std::memory_order_acquire) - readIndex);
+        const uint32 pos = readIndex & m_mask;
+        const uint32 len1 = std::min(count, m_capacity - pos);
+        const uint32 len2 = count - len1;
+        return {m_storage.subspan(pos * 2, len1 * 2), m_storage.subspan(0, len2 * 2)};
+    }
+
+    /// @brief Releases frames returned by `Peek` back to the producer.
+    /// @param[in] frames the number of frames to release
+    void Consume(uint32 frames) {
+        m_readIndex.store(m_readIndex.load(std::memory_order_relaxed) + frames, std::memory_order_release);
+    }
+
+    /// @brief Retrieves the position of the next frame to be read within the storage.
+    [[nodiscard]] uint32 ReadPosition() const {
+        return m_readIndex.load(std::memory_order_relaxed) & m_mask;
+    }
+
+private:
+    std::span<sint16> m_storage;
+    const uint32 m_capacity;
+    const uint32 m_mask;
+
+    // Producer-owned
+    alignas(64) uint32 m_pendingWrite = 0; // Frames written but not yet published
+    uint32 m_cachedRead = 0;               // Last observed read index
+    uint64 m_dropped = 0;                  // Frames dropped due to a full buffer
+    std::atomic<uint32> m_writeIndex = 0;  // Published write index
+
+    // Consumer-owned
+    alignas(64) std::atomic<uint32> m_readIndex = 0;
+};
+
+} // namespace ymir::scsp
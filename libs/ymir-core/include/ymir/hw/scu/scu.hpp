@@ -8,6 +8,7 @@
 
 #include <ymir/state/state_scu.hpp>
 
+#include <ymir/debug/perf_counters.hpp>
 #include <ymir/debug/scu_tracer_base.hpp>
 
 #include <ymir/hw/hw_defs.hpp>
@@ -87,12 +88,27 @@ public:
         m_cbDebugPortWrite = callback;
     }
 
+    void SetRegisterWriteCallback(CBRegisterWrite callback) {
+        m_cbRegisterWrite = callback;
+    }
+
     // Checks if a DMA transfer is active.
     // This is used to stall the SH-2s.
     bool IsDMAActive() const {
         return m_activeDMAChannelLevel < m_dmaChannels.size() || m_dsp.dmaRun;
     }
 
+    // Checks if the DSP is running a program.
+    bool IsDSPRunning() const {
+        return m_dsp.programExecuting && !m_dsp.programPaused;
+    }
+
+    // Retrieves the number of writes made to SCU registers through the bus.
+    // Used to detect when the SH-2s are communicating with the SCU.
+    uint64 GetRegisterWriteCount() const {
+        return m_regWriteCount;
+    }
+
     // -------------------------------------------------------------------------
     // Cartridge slot
 
@@ -100,13 +116,13 @@ public:
         requires std::derived_from<T, cart::BaseCartridge>
     T *InsertCartridge(Args &&...args) {
         T *cart = m_cartSlot.InsertCartridge<T>(std::forward<Args>(args)...);
-        // TODO: m_cartSlot.MapMemory(bus)
+        MapCartridgeMemory(m_bus);
         return cart;
     }
 
     void RemoveCartridge() {
-        // TODO: unmap cartridge memory
         m_cartSlot.RemoveCartridge();
+        MapCartridgeMemory(m_bus);
     }
 
     // Returns a reference to the inserted cartridge.
@@ -164,6 +180,7 @@ private:
     CBExternalInterrupt m_cbExternalSlaveInterrupt;
 
     CBDebugPortWrite m_cbDebugPortWrite;
+    CBRegisterWrite m_cbRegisterWrite;
 
     core::Scheduler &m_scheduler;
     core::EventID m_timer1Event;
@@ -179,6 +196,14 @@ private:
     template <mem_primitive T, bool poke>
     void WriteCartridge(uint32 address, T value);
 
+    // Maps the cartridge area handlers to the specified range.
+    void MapCartridgeHandlers(sys::SH2Bus &bus, uint32 start, uint32 end);
+
+    // Maps the A-Bus CS0 and CS1 areas for the inserted cartridge.
+    // Plain memory regions declared by the cartridge are mapped directly into the bus; everything else, including the
+    // cartridge ID register and the debug port, goes through ReadCartridge/WriteCartridge.
+    void MapCartridgeMemory(sys::SH2Bus &bus);
+
     // -------------------------------------------------------------------------
     // Cartridge slot
 
@@ -208,6 +233,12 @@ private:
     // The cycle counter is used to trigger delayed interrupt signals.
     void RunDMA(uint64 cycles);
 
+    // Copies whole longwords in bulk from the longword following the channel's current source address to the specified
+    // destination address, as long as both ends are backed by plain memory or accept block writes.
+    // Only valid when the source increment is 4 and the transfer buffer is fully consumed.
+    // Updates the channel's source address, transfer count and buffer, and returns the number of bytes transferred.
+    uint32 DMATransferBulk(uint8 level, uint32 dstAddr);
+
     void RecalcDMAChannel();
 
     void TriggerImmediateDMA(uint32 index);
@@ -218,6 +249,11 @@ private:
 
     SCUDSP m_dsp;
 
+    // -------------------------------------------------------------------------
+    // Registers
+
+    uint64 m_regWriteCount = 0;
+
     // -------------------------------------------------------------------------
     // Timers
 
@@ -331,6 +367,12 @@ public:
         m_dsp.UseTracer(m_tracer);
     }
 
+    // Attaches the specified performance counters to this component.
+    // Pass nullptr to stop counting.
+    void UsePerfCounters(debug::PerfCounters *counters) {
+        m_perf = counters;
+    }
+
     class Probe {
     public:
         Probe(SCU &scu);
@@ -432,6 +474,7 @@ public:
 private:
     Probe m_probe{*this};
     debug::ISCUTracer *m_tracer = nullptr;
+    debug::PerfCounters *m_perf = nullptr;
 };
 
 } // namespace ymir::scu
@@ -9,4 +9,7 @@ namespace ymir::scu {
 // Invoked when the SCU raises an interrupt.
 using CBExternalInterrupt = util::RequiredCallback<void(uint8 level, uint8 vector)>;
 
+// Invoked right before a write from the bus to an SCU register is applied.
+using CBRegisterWrite = util::RequiredCallback<void()>;
+
 } // namespace ymir::scu
@@ -260,6 +260,24 @@ private:
     std::array<uint8, 4 * 1024> m_ram;
     XXH128Hash m_romHash;
 
+    // A pre-decoded ROM instruction.
+    struct CachedInstruction {
+        // Decoded opcodes: [0] regular instruction, [1] delay slot instruction
+        std::array<OpcodeType, 2> opcodes;
+        DecodedArgs args;
+
+        // Number of instructions from this one until the end of its basic block, including the delay slot of a
+        // delayed branch
+        uint16 blockLength;
+    };
+
+    // Decoded copy of the on-chip ROM, one entry per 16-bit word.
+    // The ROM only changes when a new image is loaded or when the debugger pokes it, so the cache is built eagerly.
+    std::array<CachedInstruction, kROMSize / sizeof(uint16)> m_romCache;
+
+    // Decodes the ROM bytes in the given range into m_romCache and updates the affected basic blocks.
+    void UpdateROMCache(uint32 offset, uint32 size);
+
     // According to the SH7034 manual, the address space is divided into these areas:
     // (CD Block mappings in [brackets])
     //
@@ -451,6 +469,16 @@ private:
     // Returns the number of cycles executed.
     uint64 InterpretNext();
 
+    // Executes pre-decoded instructions from the ROM block at PC.
+    // Stops at the end of the block, once maxCycles have been executed, when leaving the straight-line path or when an
+    // interrupt becomes pending. The caller must ensure PC points to the on-chip ROM and no interrupt is pending.
+    // Returns the number of cycles executed.
+    uint64 ExecuteROMBlock(uint64 maxCycles);
+
+    // Executes a decoded instruction.
+    // Returns the number of cycles executed.
+    uint64 ExecuteInstruction(OpcodeType opcode, const DecodedArgs &args);
+
 #define TPL_DS template <bool delaySlot>
 
     TPL_DS uint64 NOP(); // nop
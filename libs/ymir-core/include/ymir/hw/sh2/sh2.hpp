@@ -28,6 +28,7 @@
 #include <ymir/state/state_sh2.hpp>
 
 #include <ymir/debug/debug_break.hpp>
+#include <ymir/debug/perf_counters.hpp>
 #include <ymir/debug/sh2_tracer_base.hpp>
 #include <ymir/debug/watchpoint_defs.hpp>
 
@@ -39,6 +40,7 @@
 #include <iosfwd>
 #include <map>
 #include <set>
+#include <utility>
 
 namespace ymir::sh2 {
 
@@ -54,6 +56,10 @@ public:
         m_cbAcknowledgeExternalInterrupt = callback;
     }
 
+    void SetFRTInputCaptureCallback(CBFRTInputCapture callback) {
+        m_cbFRTInputCapture = callback;
+    }
+
     void UseDebugBreakManager(debug::DebugBreakManager *mgr) {
         m_debugBreakMgr = mgr;
     }
@@ -75,6 +81,12 @@ public:
     template <bool debug, bool enableCache>
     uint64 Advance(uint64 cycles, uint64 spilloverCycles = 0);
 
+    // Makes the Advance invocation in progress return as soon as the current instruction finishes.
+    // Does nothing if called outside of Advance.
+    void EndAdvance() {
+        m_cyclesTarget = m_cyclesExecuted;
+    }
+
     // Executes a single instruction.
     // Returns the number of cycles executed.
     template <bool debug, bool enableCache>
@@ -84,6 +96,17 @@ public:
         return !BCR1.MASTER;
     }
 
+    // Determines if the CPU is in sleep or standby mode waiting for an interrupt.
+    bool IsSleeping() const {
+        return m_sleep;
+    }
+
+    // Retrieves the number of FRT input captures triggered through the MINIT/SINIT area, which is how the two SH-2s
+    // signal each other.
+    uint64 GetFRTInputCaptureCount() const {
+        return m_frtInputCaptureCount;
+    }
+
     bool GetNMI() const;
     void SetNMI();
 
@@ -107,18 +130,30 @@ public:
         m_tracer = tracer;
     }
 
+    // Attaches the specified performance counters to this component.
+    // Pass nullptr to stop counting.
+    void UsePerfCounters(debug::PerfCounters *counters) {
+        m_perf = counters != nullptr ? &counters->sh2[IsMaster() ? 0 : 1] : nullptr;
+        m_perfMemoryAccesses = 0;
+        m_perfMMIOAccesses = 0;
+    }
+
     // Adds the specified address to the set of breakpoints.
     // The address is force-aligned to word boundaries.
     // Returns `true` if the breakpoint was added, `false` if it already exists.
     bool AddBreakpoint(uint32 address) {
-        return m_breakpoints.insert(address & ~1u).second;
+        const bool result = m_breakpoints.insert(address & ~1u).second;
+        RebuildBreakpointFilter();
+        return result;
     }
 
     // Removes the specified address from the set of breakpoints.
     // The address is force-aligned to word boundaries.
     // Returns `true` if the breakpoint was removed, `false` if it did not exist.
     bool RemoveBreakpoint(uint32 address) {
-        return m_breakpoints.erase(address & ~1u);
+        const bool result = m_breakpoints.erase(address & ~1u);
+        RebuildBreakpointFilter();
+        return result;
     }
 
     // Toggles the breakpoint at the specified address.
@@ -130,12 +165,14 @@ public:
         if (!result) {
             m_breakpoints.erase(address);
         }
+        RebuildBreakpointFilter();
         return result;
     }
 
     // Clears all breakpoints.
     void ClearBreakpoints() {
         m_breakpoints.clear();
+        RebuildBreakpointFilter();
     }
 
     // Retrieves all breakpoints set in this SH-2.
@@ -151,6 +188,7 @@ public:
         for (auto address : breakpoints) {
             m_breakpoints.insert(address & ~1u);
         }
+        RebuildBreakpointFilter();
     }
 
     // Determines if the specified address has a breakpoint set.
@@ -223,6 +261,15 @@ public:
         return m_debugSuspend;
     }
 
+    // Determines if this CPU needs to run the instrumented (debug) code paths.
+    // This is the case when the CPU is suspended, when breakpoints or watchpoints are set, or when the attached tracer
+    // wants hot path events (instruction execution and DMA data transfers).
+    // All other tracer events are delivered regardless of which code paths are in use.
+    bool IsDebugInstrumentationNeeded() const {
+        return m_debugSuspend || !m_breakpoints.empty() || !m_watchpoints.empty() ||
+               (m_tracer != nullptr && m_tracer->NeedsHotPathEvents());
+    }
+
     class Probe {
     public:
         Probe(SH2 &sh2);
@@ -323,6 +370,10 @@ public:
         bool GetSleepState() const;
         void SetSleepState(bool sleep);
 
+        // Retrieves the number of cycles elapsed since the last hard reset as seen by this CPU.
+        // Unlike Saturn::GetCycleCount(), this includes the cycles executed so far in the current time slice.
+        uint64 GetCycleCount() const;
+
         // ---------------------------------------------------------------------
         // On-chip peripheral registers
 
@@ -550,6 +601,7 @@ private:
     bool m_delaySlot;
 
     CBAcknowledgeExternalInterrupt m_cbAcknowledgeExternalInterrupt;
+    CBFRTInputCapture m_cbFRTInputCapture;
     debug::DebugBreakManager *m_debugBreakMgr = nullptr;
 
     // -------------------------------------------------------------------------
@@ -560,6 +612,9 @@ private:
     // Number of cycles executed in the current Advance invocation
     uint64 m_cyclesExecuted;
 
+    // Cycle count at which the current Advance invocation stops
+    uint64 m_cyclesTarget;
+
     // Retrieves the current absolute cycle count
     uint64 GetCurrentCycleCount() const;
 
@@ -701,6 +756,12 @@ private:
     template <bool debug, bool enableCache>
     bool StepDMAC(uint32 channel);
 
+    // Transfers as many units as possible as block copies between array-backed memory regions.
+    // Only handles auto-request transfers that increment both addresses and don't go through the cache.
+    // Updates the channel's addresses and transfer count and returns true if any data was transferred.
+    template <bool enableCache>
+    bool StepDMACBlock(uint32 channel, uint32 xferSize);
+
     template <bool debug, bool enableCache>
     void AdvanceDMA(uint64 cycles);
 
@@ -739,6 +800,8 @@ private:
 
     void TriggerFRTInputCapture();
 
+    uint64 m_frtInputCaptureCount = 0;
+
     // -------------------------------------------------------------------------
     // Interrupts
 
@@ -791,11 +854,47 @@ private:
     Probe m_probe{*this};
     debug::ISH2Tracer *m_tracer = nullptr;
 
+    debug::PerfCounters::SH2 *m_perf = nullptr;
+    uint64 m_perfMemoryAccesses = 0; // array-backed bus accesses not yet added to the performance counters
+    uint64 m_perfMMIOAccesses = 0;   // handler-backed bus accesses not yet added to the performance counters
+
+    // Counts external bus accesses to the specified address if performance counters are enabled.
+    void CountPerfBusAccesses(uint32 address, uint64 count) {
+        if constexpr (debug::kPerfStatsEnabled) {
+            if (m_perf != nullptr) [[unlikely]] {
+                (m_bus.IsArrayMapped(address) ? m_perfMemoryAccesses : m_perfMMIOAccesses) += count;
+            }
+        }
+    }
+
+    // Adds pending bus access counts to the performance counters.
+    void FlushPerfBusAccesses() {
+        m_perf->memoryAccesses.Add(std::exchange(m_perfMemoryAccesses, 0));
+        m_perf->mmioAccesses.Add(std::exchange(m_perfMMIOAccesses, 0));
+    }
+
     std::array<bool, 2> m_dmacTraced; // whether each DMA channel has had a transfer traced
 
     std::set<uint32> m_breakpoints;
     std::map<uint32, debug::WatchpointFlags> m_watchpoints;
 
+    // Bit filter of breakpoint addresses, indexed by bits 1-12 of the address.
+    // Lets CheckBreakpoint skip the set lookup for the vast majority of instructions.
+    std::array<uint64, 64> m_breakpointFilter{};
+
+    void RebuildBreakpointFilter() {
+        m_breakpointFilter.fill(0);
+        for (uint32 address : m_breakpoints) {
+            const uint32 index = (address >> 1u) & 4095u;
+            m_breakpointFilter[index >> 6u] |= 1ull << (index & 63u);
+        }
+    }
+
+    bool IsBreakpointFiltered(uint32 address) const {
+        const uint32 index = (address >> 1u) & 4095u;
+        return (m_breakpointFilter[index >> 6u] >> (index & 63u)) & 1u;
+    }
+
     bool m_debugSuspend = false; // Disables CPU while in debug mode
 
     bool CheckBreakpoint();
@@ -11,8 +11,15 @@
 #include <ymir/util/inline.hpp>
 
 #include <array>
+#include <bit>
 #include <cassert>
 
+#if defined(_M_X64) || defined(__x86_64__)
+    #include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
 namespace ymir::sh2 {
 
 // -----------------------------------------------------------------------------
@@ -109,6 +116,18 @@ struct CacheEntry {
     FORCE_INLINE uint8 FindWay(uint32 address) const {
         const uint32 tagAddress = (bit::extract<10, 28>(address) << 10) | (1 << 2);
 
+        // Compare all four tags at once; the lowest matching way wins, same as the sequential checks
+#if defined(_M_X64) || defined(__x86_64__)
+        const __m128i tags = _mm_load_si128(reinterpret_cast<const __m128i *>(tag.data()));
+        const __m128i match = _mm_cmpeq_epi32(tags, _mm_set1_epi32(static_cast<int>(tagAddress)));
+        const uint32 mask = _mm_movemask_ps(_mm_castsi128_ps(match));
+        return mask != 0 ? std::countr_zero(mask) : 4;
+#elif defined(_M_ARM64) || defined(__aarch64__)
+        const uint32x4_t tags = vld1q_u32(reinterpret_cast<const uint32 *>(tag.data()));
+        const uint16x4_t match = vmovn_u32(vceqq_u32(tags, vdupq_n_u32(tagAddress)));
+        const uint64 mask = vget_lane_u64(vreinterpret_u64_u16(match), 0);
+        return mask != 0 ? std::countr_zero(mask) / 16 : 4;
+#else
         if (tag[0].u32 == tagAddress) {
             return 0;
         }
@@ -122,6 +141,7 @@ struct CacheEntry {
             return 3;
         }
         return 4;
+#endif
     }
 };
 
@@ -164,6 +184,7 @@ public:
         m_replaceANDMask = 0x3Fu;
         m_replaceORMask[false] = 0u;
         m_replaceORMask[true] = 0u;
+        InvalidateFetchLine();
     }
 
     FORCE_INLINE CacheEntry &GetEntry(uint32 address) {
@@ -184,6 +205,7 @@ public:
 
     template <bool instrFetch>
     FORCE_INLINE uint8 SelectWay(uint32 address) {
+        InvalidateFetchLine();
         const uint32 index = bit::extract<4, 9>(address);
         const uint8 lru = m_lru[index];
         const uint8 way = GetWayFromLRU<instrFetch>(lru);
@@ -202,16 +224,21 @@ public:
 
     FORCE_INLINE void SetLRU(uint8 index, uint8 lru) {
         assert(index < kCacheEntries);
+        InvalidateFetchLine();
         m_lru[index] = lru;
     }
 
     FORCE_INLINE void UpdateLRU(uint32 address, uint8 way) {
         const uint32 index = bit::extract<4, 9>(address);
+        if (index == m_fetchLineIndex && way != m_fetchLineWay) {
+            InvalidateFetchLine();
+        }
         m_lru[index] &= kCacheLRUUpdateBits[way].andMask;
         m_lru[index] |= kCacheLRUUpdateBits[way].orMask;
     }
 
     FORCE_INLINE void AssociativePurge(uint32 address) {
+        InvalidateFetchLine();
         const uint32 index = bit::extract<4, 9>(address);
         const uint32 tagAddress = bit::extract<10, 28>(address);
         for (auto &tag : m_entries[index].tag) {
@@ -229,6 +256,7 @@ public:
 
     template <mem_primitive T, bool poke>
     FORCE_INLINE void WriteAddressArray(uint32 address, T value) {
+        InvalidateFetchLine();
         const uint32 index = bit::extract<4, 9>(address);
         if constexpr (poke) {
             uint32 currValue;
@@ -277,6 +305,7 @@ public:
     }
 
     FORCE_INLINE void Purge() {
+        InvalidateFetchLine();
         for (uint32 index = 0; index < 64; index++) {
             for (auto &tag : m_entries[index].tag) {
                 tag.valid = 0;
@@ -297,6 +326,7 @@ public:
     template <bool poke>
     FORCE_INLINE void WriteCCR(uint8 value) {
         CCR.Write(value);
+        InvalidateFetchLine();
         m_replaceANDMask = CCR.TW ? 0x1u : 0x3Fu;
         m_replaceORMask[false] = CCR.OD ? -1 : 0;
         m_replaceORMask[true] = CCR.ID ? -1 : 0;
@@ -331,6 +361,37 @@ public:
             m_entries[i].line = state.entries[i].lines;
         }
         m_lru = state.lru;
+        InvalidateFetchLine();
+    }
+
+    // -------------------------------------------------------------------------
+    // Instruction fetch line memo
+    //
+    // Remembers the line hit by the most recent instruction fetch. Sequential fetches from that line would find the
+    // same way and apply the same LRU update, which leaves the LRU bits unchanged, so they can read straight from the
+    // line. Anything that could change the tags or LRU bits of the entry invalidates the memo.
+
+    // Retrieves the line memoized for the given instruction address, or nullptr if the address is on a different line.
+    FORCE_INLINE const uint8 *GetFetchLine(uint32 address) const {
+        return (address & kFetchLineAddressMask) == m_fetchLineAddress ? m_fetchLine : nullptr;
+    }
+
+    // Memoizes the line that the instruction at the given address was just fetched from.
+    // Must be called after the LRU bits are updated for the access.
+    FORCE_INLINE void SetFetchLine(uint32 address, uint8 way) {
+        assert(IsValidCacheWay(way));
+        const uint32 index = bit::extract<4, 9>(address);
+        m_fetchLineAddress = address & kFetchLineAddressMask;
+        m_fetchLineIndex = index;
+        m_fetchLineWay = way;
+        m_fetchLine = m_entries[index].line[way].data();
+    }
+
+    FORCE_INLINE void InvalidateFetchLine() {
+        m_fetchLineAddress = kNoFetchLine;
+        m_fetchLineIndex = kCacheEntries;
+        m_fetchLineWay = kCacheWays;
+        m_fetchLine = nullptr;
     }
 
     // -------------------------------------------------------------------------
@@ -338,6 +399,8 @@ public:
 
     FORCE_INLINE CacheEntry &GetEntryByIndex(uint8 index) {
         assert(index < kCacheEntries);
+        // The caller may modify the tags. Use the const overload for read-only access, especially from other threads.
+        InvalidateFetchLine();
         return m_entries[index];
     }
 
@@ -351,6 +414,14 @@ private:
     alignas(16) std::array<uint8, kCacheEntries> m_lru;
     uint8 m_replaceANDMask;
     std::array<sint8, 2> m_replaceORMask; // [0]=data, [1]=code
+
+    static constexpr uint32 kFetchLineAddressMask = 0x1FFFFFF0;
+    static constexpr uint32 kNoFetchLine = ~0u; // never matches a masked address
+
+    uint32 m_fetchLineAddress;
+    uint32 m_fetchLineIndex;
+    uint8 m_fetchLineWay;
+    const uint8 *m_fetchLine;
 };
 
 } // namespace ymir::sh2
@@ -312,19 +312,30 @@ struct DecodedMemAccesses {
     bool anyAccess = false;
 };
 
+// Opcode types are packed into one byte per entry. Delay slot entries are stored relative to OpcodeType::Illegal.
+static_assert(static_cast<uint16>(OpcodeType::Illegal) <= 0xFF);
+static_assert(static_cast<uint16>(OpcodeType::IllegalSlot) - static_cast<uint16>(OpcodeType::Illegal) <= 0xFF);
+
+// The decoding table is generated at compile time and lives in read-only memory.
 struct DecodeTable {
 private:
     static constexpr auto alignment = 64;
+    static constexpr uint16 kDelayBase = static_cast<uint16>(OpcodeType::Illegal);
 
-    DecodeTable();
+    constexpr DecodeTable();
 
 public:
-    static DecodeTable s_instance;
+    static const DecodeTable s_instance;
+
+    // Retrieves the opcode type of the given instruction in regular or delay slot context.
+    OpcodeType GetOpcode(bool delaySlot, uint16 instr) const {
+        return static_cast<OpcodeType>(opcodes[delaySlot][instr] + (delaySlot ? kDelayBase : 0u));
+    }
 
-    // Instruction decoding table
+    // Packed instruction decoding table; use GetOpcode() to read
     // [0] regular instructions
     // [1] delay slot instructions
-    alignas(alignment) std::array<std::array<OpcodeType, 0x10000>, 2> opcodes;
+    alignas(alignment) std::array<std::array<uint8, 0x10000>, 2> opcodes;
     alignas(alignment) std::array<DecodedArgs, 0x10000> args;
     alignas(alignment) std::array<DecodedMemAccesses, 0x10000> mem;
 };
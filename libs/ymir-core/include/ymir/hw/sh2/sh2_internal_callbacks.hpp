@@ -12,4 +12,7 @@ namespace ymir::sh2 {
 /// @brief Invoked when the SH2 acknowledges an external interrupt signal.
 using CBAcknowledgeExternalInterrupt = util::RequiredCallback<void()>;
 
+/// @brief Invoked right before a write to the MINIT/SINIT area triggers an FRT input capture.
+using CBFRTInputCapture = util::RequiredCallback<void()>;
+
 } // namespace ymir::sh2
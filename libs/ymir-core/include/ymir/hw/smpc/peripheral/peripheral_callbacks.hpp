@@ -14,4 +14,7 @@ namespace ymir::peripheral {
 // Invoked when a peripheral requests a report.
 using CBPeripheralReport = util::OptionalCallback<void(PeripheralReport &report)>;
 
+// Invoked after a peripheral report is filled in by the report callback. May modify the report.
+using CBPeripheralReportHook = util::OptionalCallback<void(PeripheralReport &report)>;
+
 } // namespace ymir::peripheral
@@ -32,25 +32,38 @@ public:
         DisconnectPeripherals();
     }
 
+    // Peripherals hold a pointer to the port
+    PeripheralPort(const PeripheralPort &) = delete;
+    PeripheralPort(PeripheralPort &&) = delete;
+
     void SetPeripheralReportCallback(CBPeripheralReport callback) {
         m_cbPeripheralReport = callback;
-        m_peripheral->m_cbPeripheralReport = callback;
+    }
+
+    // Installs a hook that is invoked with every report produced by the peripheral report callback.
+    // The hook may inspect or replace the report before it reaches the peripheral.
+    void SetPeripheralReportHook(CBPeripheralReportHook hook) {
+        m_cbPeripheralReportHook = hook;
+    }
+
+    void ClearPeripheralReportHook() {
+        m_cbPeripheralReportHook = {};
     }
 
     ControlPad *ConnectControlPad() {
-        return ConnectPeripheral<ControlPad>(m_cbPeripheralReport);
+        return ConnectPeripheral<ControlPad>(MakeReportCallback());
     }
 
     AnalogPad *ConnectAnalogPad() {
-        return ConnectPeripheral<AnalogPad>(m_cbPeripheralReport);
+        return ConnectPeripheral<AnalogPad>(MakeReportCallback());
     }
 
     ArcadeRacerPeripheral *ConnectArcadeRacer() {
-        return ConnectPeripheral<ArcadeRacerPeripheral>(m_cbPeripheralReport);
+        return ConnectPeripheral<ArcadeRacerPeripheral>(MakeReportCallback());
     }
 
     MissionStick *ConnectMissionStick() {
-        return ConnectPeripheral<MissionStick>(m_cbPeripheralReport);
+        return ConnectPeripheral<MissionStick>(MakeReportCallback());
     }
 
     void DisconnectPeripherals() {
@@ -69,6 +82,17 @@ private:
     std::unique_ptr<BasePeripheral> m_peripheral;
 
     CBPeripheralReport m_cbPeripheralReport;
+    CBPeripheralReportHook m_cbPeripheralReportHook;
+
+    // Peripherals report through the port so that the hook sees every report regardless of when the callbacks change
+    void ProcessReport(PeripheralReport &report) {
+        m_cbPeripheralReport(report);
+        m_cbPeripheralReportHook(report);
+    }
+
+    CBPeripheralReport MakeReportCallback() {
+        return util::MakeClassMemberOptionalCallback<&PeripheralPort::ProcessReport>(this);
+    }
 
     template <typename T, typename... Args>
         requires std::derived_from<T, BasePeripheral>
@@ -9,6 +9,7 @@
 
 #include "vdp_callbacks.hpp"
 #include "vdp_internal_callbacks.hpp"
+#include "vdp_kernels.hpp"
 
 #include "slope.hpp"
 
@@ -21,6 +22,8 @@
 
 #include <ymir/hw/hw_defs.hpp>
 
+#include <ymir/debug/perf_counters.hpp>
+
 #include <ymir/util/bit_ops.hpp>
 #include <ymir/util/data_ops.hpp>
 #include <ymir/util/event.hpp>
@@ -106,6 +109,16 @@ public:
         return m_stallVDP1OnVRAMWrites;
     }
 
+    // Selects the SIMD rendering kernels for the most capable instruction set up to the specified level.
+    // Must not be called while a frame is being rendered.
+    void SetSIMDLevel(util::SIMDLevel level) {
+        m_kernels = &GetVDPKernels(level);
+    }
+
+    util::SIMDLevel GetSIMDLevel() const {
+        return m_kernels->level;
+    }
+
     void DumpVDP1VRAM(std::ostream &out) const;
     void DumpVDP2VRAM(std::ostream &out) const;
     void DumpVDP2CRAM(std::ostream &out) const;
@@ -199,6 +212,10 @@ private:
     template <mem_primitive T, bool poke>
     void VDP1WriteVRAM(uint32 address, T value);
 
+    // Writes a block of data to VDP1 VRAM as a sequence of 16-bit writes.
+    // Used by SCU DMA bulk transfers.
+    void VDP1WriteVRAMBlock(uint32 address, std::span<const uint8> data);
+
     template <mem_primitive T>
     T VDP1ReadFB(uint32 address) const;
 
@@ -220,6 +237,10 @@ private:
     template <mem_primitive T>
     void VDP2WriteVRAM(uint32 address, T value);
 
+    // Writes a block of data to VDP2 VRAM as a sequence of 16-bit writes.
+    // Used by SCU DMA bulk transfers.
+    void VDP2WriteVRAMBlock(uint32 address, std::span<const uint8> data);
+
     template <mem_primitive T, bool peek>
     T VDP2ReadCRAM(uint32 address) const;
 
@@ -714,6 +735,10 @@ private:
     FnVDP1HandleCommand m_fnVDP1HandleCommand;
     FnVDP2DrawLine m_fnVDP2DrawLine;
 
+    // SIMD kernels used by the VDP2 compositor.
+    // Defaults to the baseline instruction set of the build; see SetSIMDLevel.
+    const VDPKernels *m_kernels = &GetVDPKernels(util::SIMDLevel::Scalar);
+
     /// @brief Updates function pointers based on the current rendering settings.
     void UpdateFunctionPointers();
 
@@ -795,6 +820,9 @@ private:
         // Used when transparent meshes are enabled.
         // Indexing: [altFB][drawFB]
         std::array<std::array<SpriteFB, 2>, 2> meshFB;
+
+        // Pixels plotted by the current command. Only counted when performance counters are compiled in.
+        uint64 pixelsPlotted = 0;
     } m_VDP1RenderState;
 
     struct VDP1PixelParams {
@@ -1621,6 +1649,12 @@ public:
     // -------------------------------------------------------------------------
     // Debugger
 
+    // Attaches the specified performance counters to this component.
+    // Pass nullptr to stop counting.
+    void UsePerfCounters(debug::PerfCounters *counters) {
+        m_perf = counters;
+    }
+
     struct VDP2DebugRenderOptions {
         bool enable = false;
 
@@ -1755,6 +1789,7 @@ public:
 
 private:
     Probe m_probe{*this};
+    debug::PerfCounters *m_perf = nullptr;
 };
 
 } // namespace ymir::vdp
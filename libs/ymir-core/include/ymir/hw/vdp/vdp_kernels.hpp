@@ -0,0 +1,70 @@
+#pragma once
+
+/**
+@file
+@brief Runtime-dispatched SIMD kernels used by the VDP renderer.
+*/
+
+#include "vdp_defs.hpp"
+
+#include <ymir/core/types.hpp>
+
+#include <ymir/util/cpu_features.hpp>
+
+#include <span>
+
+namespace ymir::vdp {
+
+/// @brief A table of VDP rendering kernels compiled for a specific SIMD instruction set.
+struct VDPKernels {
+    /// @brief The SIMD level these kernels were compiled for.
+    util::SIMDLevel level;
+
+    /// @brief Tests if an array of uint8 values are all zeroes.
+    bool (*AllZeroU8)(std::span<const uint8> values);
+
+    /// @brief Tests if an array of bool values are all true.
+    bool (*AllBool)(std::span<const bool> values);
+
+    /// @brief Tests if any element in an array of bools is true.
+    bool (*AnyBool)(std::span<const bool> values);
+
+    /// @brief Halves the brightness of pixels whose mask is set.
+    void (*Color888ShadowMasked)(std::span<Color888> pixels, std::span<const bool, kMaxResH> mask);
+
+    /// @brief Stores the saturated sum of the top and bottom colors where the mask is set, or the top color otherwise.
+    void (*Color888SatAddMasked)(std::span<Color888> dest, std::span<const bool, kMaxResH> mask,
+                                 std::span<const Color888, kMaxResH> topColors,
+                                 std::span<const Color888, kMaxResH> btmColors);
+
+    /// @brief Stores the bottom color where the mask is set, or the top color otherwise.
+    void (*Color888SelectMasked)(std::span<Color888> dest, std::span<const bool, kMaxResH> mask,
+                                 std::span<const Color888> topColors, std::span<const Color888, kMaxResH> btmColors);
+
+    /// @brief Stores the average of the top and bottom colors where the mask is set, or the top color otherwise.
+    void (*Color888AverageMasked)(std::span<Color888> dest, std::span<const bool, kMaxResH> mask,
+                                  std::span<const Color888> topColors, std::span<const Color888, kMaxResH> btmColors);
+
+    /// @brief Blends the top and bottom colors with per-pixel ratios where the mask is set, or stores the top color
+    /// otherwise.
+    void (*Color888CompositeRatioPerPixelMasked)(std::span<Color888> dest, std::span<const bool> mask,
+                                                 std::span<const Color888, kMaxResH> topColors,
+                                                 std::span<const Color888, kMaxResH> btmColors,
+                                                 std::span<const uint8, kMaxResH> ratios);
+
+    /// @brief Blends the top and bottom colors with a fixed ratio where the mask is set, or stores the top color
+    /// otherwise.
+    void (*Color888CompositeRatioMasked)(std::span<Color888> dest, std::span<const bool> mask,
+                                         std::span<const Color888, kMaxResH> topColors,
+                                         std::span<const Color888, kMaxResH> btmColors, uint8 ratio);
+};
+
+/// @brief Retrieves the kernels compiled for the most capable instruction set that does not exceed `level`.
+///
+/// Falls back to the baseline kernels if no better match was compiled into this build.
+///
+/// @param[in] level the maximum SIMD level to use
+/// @return the kernel table for the selected instruction set
+[[nodiscard]] const VDPKernels &GetVDPKernels(util::SIMDLevel level);
+
+} // namespace ymir::vdp
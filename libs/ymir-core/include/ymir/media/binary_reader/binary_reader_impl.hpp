@@ -5,6 +5,8 @@
 #include "binary_reader_composite.hpp"
 #include "binary_reader_file.hpp"
 #include "binary_reader_mem.hpp"
+#include "binary_reader_mem_lz4.hpp"
 #include "binary_reader_mmap.hpp"
 #include "binary_reader_subview.hpp"
+#include "binary_reader_sync.hpp"
 #include "binary_reader_zero.hpp"
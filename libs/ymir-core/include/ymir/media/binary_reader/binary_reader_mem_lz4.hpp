@@ -0,0 +1,64 @@
+#pragma once
+
+#include "binary_reader.hpp"
+
+#include <array>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <vector>
+
+namespace ymir::media {
+
+// Implementation of IBinaryReader that keeps an LZ4-compressed copy of a file in memory.
+//
+// The file is split into independently compressed blocks, which are compressed in parallel when loading. Reads decode
+// whole blocks into a small cache, so sequential sector reads only decompress each block once.
+class CompressedMemoryBinaryReader final : public IBinaryReader {
+public:
+    // Size of each independently compressed block.
+    static constexpr uint32 kBlockSize = 64 * 1024;
+
+    // Number of decoded blocks kept in the cache.
+    static constexpr uint32 kCacheSize = 4;
+
+    // Initializes an empty buffer.
+    CompressedMemoryBinaryReader() = default;
+
+    // Initializes the buffer with the compressed contents of the specified file, if it exists and can be read.
+    // If any errors occur while reading the file, initializes an empty buffer and returns the error in the provided
+    // std::error_code object.
+    CompressedMemoryBinaryReader(std::filesystem::path path, std::error_code &error);
+
+    uintmax_t Size() const final {
+        return m_size;
+    }
+
+    uintmax_t Read(uintmax_t offset, uintmax_t size, std::span<uint8> output) const final;
+
+    // Returns the total amount of memory used by compressed blocks.
+    uintmax_t CompressedSize() const;
+
+private:
+    struct Block {
+        std::vector<char> data; // Compressed data, or raw data if the block did not compress
+        bool compressed = false;
+    };
+
+    std::vector<Block> m_blocks;
+    uintmax_t m_size = 0;
+
+    struct CacheEntry {
+        std::vector<uint8> data;
+        uintmax_t blockIndex = ~uintmax_t(0);
+        uint64 lastUse = 0;
+    };
+
+    mutable std::array<CacheEntry, kCacheSize> m_cache;
+    mutable uint64 m_useCounter = 0;
+
+    // Returns the decoded contents of the specified block, or an empty span if the block could not be decoded.
+    std::span<const uint8> DecodeBlock(uintmax_t blockIndex) const;
+};
+
+} // namespace ymir::media
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "binary_reader.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace ymir::media {
+
+// Implementation of IBinaryReader that serializes reads to another IBinaryReader with a mutex.
+// Several readers may share the same mutex to guard a common underlying reader, such as the image file backing all
+// tracks of a disc.
+class SynchronizedBinaryReader final : public IBinaryReader {
+public:
+    SynchronizedBinaryReader(std::shared_ptr<IBinaryReader> binaryReader, std::shared_ptr<std::mutex> mutex)
+        : m_binaryReader(binaryReader)
+        , m_mutex(mutex)
+        , m_size(binaryReader->Size()) {}
+
+    uintmax_t Size() const final {
+        return m_size;
+    }
+
+    uintmax_t Read(uintmax_t offset, uintmax_t size, std::span<uint8> output) const final {
+        std::unique_lock lock{*m_mutex};
+        return m_binaryReader->Read(offset, size, output);
+    }
+
+private:
+    std::shared_ptr<IBinaryReader> m_binaryReader;
+    std::shared_ptr<std::mutex> m_mutex;
+    uintmax_t m_size;
+};
+
+} // namespace ymir::media
@@ -3,6 +3,7 @@
 #include <ymir/core/types.hpp>
 
 #include <ymir/media/binary_reader/binary_reader.hpp>
+#include <ymir/media/binary_reader/binary_reader_sync.hpp>
 
 #include <ymir/util/arith_ops.hpp>
 #include <ymir/util/data_ops.hpp>
@@ -18,6 +19,7 @@
 #include <array>
 #include <cassert>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <vector>
 
@@ -45,7 +47,7 @@ struct Index {
 };
 
 struct Track {
-    std::unique_ptr<IBinaryReader> binaryReader;
+    std::shared_ptr<IBinaryReader> binaryReader;
     uint32 index = 0;
     uint32 unitSize = 0;   // size of a unit, always >= sectorSize
     uint32 sectorSize = 0; // size of the valid data in the sector
@@ -226,6 +228,24 @@ struct Track {
         subheader.submode = subheaderData[2];
         subheader.codingInfo = subheaderData[3];
     }
+
+    // Extracts the subheader from a raw sector previously read with ReadSector.
+    // Avoids touching the binary reader again.
+    void ReadSectorSubheader(std::span<const uint8, 2352> sector, Subheader &subheader) const {
+        // Subheader is only present in mode 2 tracks
+        if (!mode2) {
+            subheader.fileNum = 0;
+            subheader.chanNum = 0;
+            subheader.submode = 0;
+            subheader.codingInfo = 0;
+            return;
+        }
+
+        subheader.fileNum = sector[16];
+        subheader.chanNum = sector[17];
+        subheader.submode = sector[18];
+        subheader.codingInfo = sector[19];
+    }
 };
 
 struct Session {
@@ -418,6 +438,29 @@ struct Disc {
         header.Swap(std::move(disc.header));
     }
 
+    // Creates a copy of this disc whose tracks share the binary readers of this disc instead of duplicating the image.
+    // The readers are used concurrently by every disc sharing them; call MakeThreadSafe() first if the copies are going
+    // to be read from different threads.
+    Disc Share() const {
+        Disc disc{};
+        disc.sessions = sessions;
+        disc.header = header;
+        return disc;
+    }
+
+    // Wraps every track's binary reader with a SynchronizedBinaryReader guarded by a single mutex so that this disc and
+    // all discs shared from it can be read from multiple threads.
+    void MakeThreadSafe() {
+        auto mutex = std::make_shared<std::mutex>();
+        for (auto &session : sessions) {
+            for (auto &track : session.tracks) {
+                if (track.binaryReader) {
+                    track.binaryReader = std::make_shared<SynchronizedBinaryReader>(track.binaryReader, mutex);
+                }
+            }
+        }
+    }
+
     void Invalidate() {
         sessions.clear();
         header.Invalidate();
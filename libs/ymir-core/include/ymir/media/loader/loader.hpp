@@ -1,5 +1,6 @@
 #pragma once
 
+#include "loader_preload.hpp"
 #include "loader_result.hpp"
 
 #include <ymir/media/disc.hpp>
@@ -16,8 +17,8 @@ namespace ymir::media {
 //   ISO         (if provided a .iso file)
 // Returns true if loading the file (and any auxiliary files) succeeded.
 // If this function returns false, the Disc object is invalidated.
-// preloadToRAM specifies if the entire disc image should be preloaded into memory.
+// preload specifies if and how the entire disc image should be preloaded into memory.
 // cbMsg is the callback for message reporting.
-bool LoadDisc(std::filesystem::path path, Disc &disc, bool preloadToRAM, CbLoaderMessage cbMsg);
+bool LoadDisc(std::filesystem::path path, Disc &disc, PreloadMode preload, CbLoaderMessage cbMsg);
 
 } // namespace ymir::media
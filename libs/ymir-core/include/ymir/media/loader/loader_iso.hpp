@@ -1,5 +1,6 @@
 #pragma once
 
+#include "loader_preload.hpp"
 #include "loader_result.hpp"
 
 #include <ymir/media/disc.hpp>
@@ -19,8 +20,8 @@ namespace ymir::media::loader::iso {
 // Attempts to load an ISO file from isoPath into the specified Disc object.
 // Returns true if loading the file succeeded.
 // If this function returns false, the Disc object is invalidated.
-// preloadToRAM specifies if the entire disc image should be preloaded into memory.
+// preload specifies if and how the entire disc image should be preloaded into memory.
 // cbMsg is the callback for message reporting.
-bool Load(std::filesystem::path isoPath, Disc &disc, bool preloadToRAM, CbLoaderMessage cbMsg);
+bool Load(std::filesystem::path isoPath, Disc &disc, PreloadMode preload, CbLoaderMessage cbMsg);
 
 } // namespace ymir::media::loader::iso
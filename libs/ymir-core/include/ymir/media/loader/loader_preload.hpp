@@ -0,0 +1,23 @@
+#pragma once
+
+#include <ymir/media/binary_reader/binary_reader.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <system_error>
+
+namespace ymir::media {
+
+// Specifies how disc image files are loaded.
+enum class PreloadMode {
+    None,         // Memory-map image files and read them on demand
+    Uncompressed, // Load the entire image into memory
+    Compressed,   // Load the entire image into memory as LZ4-compressed blocks
+};
+
+// Creates a binary reader for a disc image file with the specified preload mode.
+// Returns the error in the provided std::error_code object if the file could not be opened or read.
+std::unique_ptr<IBinaryReader> OpenImageFile(const std::filesystem::path &path, PreloadMode preload,
+                                             std::error_code &error);
+
+} // namespace ymir::media
@@ -20,10 +20,10 @@ struct SaturnHeader {
         Invalidate();
     }
 
-    SaturnHeader(const SaturnHeader &) = delete;
+    SaturnHeader(const SaturnHeader &) = default;
     SaturnHeader(SaturnHeader &&) = default;
 
-    SaturnHeader &operator=(const SaturnHeader &) = delete;
+    SaturnHeader &operator=(const SaturnHeader &) = default;
     SaturnHeader &operator=(SaturnHeader &&) = default;
 
     void Swap(SaturnHeader &&header) {
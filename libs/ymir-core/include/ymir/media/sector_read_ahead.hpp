@@ -0,0 +1,98 @@
+#pragma once
+
+#include "disc.hpp"
+
+#include <ymir/core/types.hpp>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <mutex>
+#include <span>
+#include <thread>
+
+namespace ymir::media {
+
+// Asynchronous sector read-ahead for the CD drive and CD block.
+//
+// Sectors are read from the disc on a background thread into a direct-mapped ring indexed by frame address so that
+// the emulator thread rarely has to block on disc image I/O. Consumers call Prefetch to point the read-ahead window at
+// the range they are about to play and ReadSector to retrieve sectors; a miss falls back to a synchronous read and
+// repositions the window.
+//
+// Binary readers are not thread-safe, so every access to the disc's binary readers is serialized through this class
+// while the worker thread is running. Reset must be invoked before the disc is swapped or ejected.
+class SectorReadAhead {
+public:
+    // Number of sectors held in the ring. Must be a power of two.
+    static constexpr uint32 kCapacity = 128;
+    static_assert(std::has_single_bit(kCapacity), "kCapacity must be a power of two");
+
+    explicit SectorReadAhead(const Disc &disc);
+    ~SectorReadAhead();
+
+    // Starts or stops the background reader thread.
+    // When disabled, ReadSector reads directly from the track.
+    // Safe to call from any thread, but not concurrently with itself.
+    void SetEnabled(bool enabled);
+
+    [[nodiscard]] bool IsEnabled() const {
+        return m_enabled;
+    }
+
+    // Drops all buffered sectors and stops prefetching.
+    // Must be called before the disc is modified.
+    void Reset();
+
+    // Points the read-ahead window at the specified frame address range.
+    // The window depth scales with the read speed to keep ahead of fast reads.
+    void Prefetch(uint32 startFAD, uint32 endFAD, uint32 readSpeed);
+
+    // Reads a raw sector from the track, taking it from the ring if available.
+    // Returns true if the sector was read successfully, with the same semantics as Track::ReadSector.
+    bool ReadSector(const Track &track, uint32 frameAddress, std::span<uint8, 2352> outBuf);
+
+private:
+    const Disc &m_disc;
+
+    enum class SlotState : uint8 { Empty, Filling, Ready };
+
+    struct Slot {
+        alignas(16) std::array<uint8, 2352> data;
+        uint32 frameAddress = ~0u;
+        SlotState state = SlotState::Empty;
+        bool valid = false;
+    };
+
+    std::array<Slot, kCapacity> m_slots;
+
+    // Protects the ring and the window
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+
+    // Serializes access to the disc's binary readers between the worker and the emulator thread.
+    // Lock order: m_readMutex, then m_mutex.
+    std::mutex m_readMutex;
+
+    // Signals that a slot finished filling
+    std::condition_variable m_readyCV;
+
+    // Bumped on every Reset to discard reads issued against a previous disc
+    uint64 m_generation = 0;
+
+    uint32 m_consumeFAD = 0; // Next frame address expected to be consumed
+    uint32 m_fillFAD = 0;    // Next frame address to be filled by the worker
+    uint32 m_endFAD = 0;     // One past the last frame address in the window
+    uint32 m_depth = 16;     // How many sectors to stay ahead of the consumer
+
+    std::atomic_bool m_enabled = false;
+    bool m_shutdown = false;
+    std::thread m_thread;
+
+    [[nodiscard]] bool HasPendingWork() const;
+
+    void WorkerThread();
+};
+
+} // namespace ymir::media
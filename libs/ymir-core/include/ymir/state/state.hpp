@@ -54,6 +54,11 @@ struct State {
     uint64 ssh2SpilloverCycles;
     uint64 sh1SpilloverCycles;
     uint64 sh1FracCycles;
+
+    // Adaptive SH-2 synchronization quantum
+    bool sh2SyncWide;
+    uint32 sh2SyncQuietQuanta;
+    uint64 sh2SyncPendingComms; // Communication events since the end of the last quantum
 };
 
 } // namespace ymir::state
@@ -16,7 +16,10 @@
 #include <ymir/util/type_traits_ex.hpp>
 #include <ymir/util/unreachable.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <concepts>
+#include <span>
 #include <type_traits>
 
 namespace ymir::sys {
@@ -32,13 +35,16 @@ using FnWrite32 = void (*)(uint32 address, uint32 value, void *ctx); ///< Functi
 /// @brief Function signature for bus wait checks.
 using FnBusWait = bool (*)(uint32 address, uint32 size, bool write, void *ctx);
 
+/// @brief Function signature for block writes of big-endian data contained within a single page.
+using FnWriteBlock = void (*)(uint32 address, std::span<const uint8> data, void *ctx);
+
 /// @brief Specifies valid bus handler function types.
 /// @tparam T the type to check
 template <typename T>
 concept bus_handler_fn =
     fninfo::IsAssignable<FnRead8, T> || fninfo::IsAssignable<FnRead16, T> || fninfo::IsAssignable<FnRead32, T> ||
     fninfo::IsAssignable<FnWrite8, T> || fninfo::IsAssignable<FnWrite16, T> || fninfo::IsAssignable<FnWrite32, T> ||
-    fninfo::IsAssignable<FnBusWait, T>;
+    fninfo::IsAssignable<FnBusWait, T> || fninfo::IsAssignable<FnWriteBlock, T>;
 
 /// @brief Represents a memory bus interconnecting various components in the system.
 ///
@@ -145,15 +151,38 @@ public:
     template <size_t N>
         requires(bit::is_power_of_two(N) && N >= kPageSize)
     void MapArray(uint32 start, uint32 end, std::array<uint8, N> &array, bool writable) {
+        MapArray(start, end, std::span<uint8, N>{array}, writable);
+    }
+
+    /// @brief Maps a fixed-size span of memory to the specified range.
+    ///
+    /// Behaves exactly like the `std::array` overload, but allows mapping a portion of a larger array, such as one bank
+    /// of a cartridge's memory.
+    ///
+    /// Access cycle timings configured for the range are preserved.
+    ///
+    /// @tparam N the size of the span. Must be a power of two and at least as large as the bus's page size
+    /// @param[in] start the lower bound of the address range to map the handlers into
+    /// @param[in] end the upper bound of the address range to map the handlers into
+    /// @param array the memory to be mapped
+    /// @param writable indicates if the memory is meant to be writable or read-only
+    template <size_t N>
+        requires(N != std::dynamic_extent && bit::is_power_of_two(N) && N >= kPageSize)
+    void MapArray(uint32 start, uint32 end, std::span<uint8, N> array, bool writable) {
         static constexpr uint32 kMask = N - 1;
 
         const uint32 startIndex = start >> pageGranularityBits;
         const uint32 endIndex = end >> pageGranularityBits;
         uint32 offset = 0;
         for (uint32 i = startIndex; i <= endIndex; i++) {
-            m_pages[i] = {}; // clear all handlers
-            m_pages[i].array = &array[offset & kMask];
-            m_pages[i].arrayWritable = writable;
+            MemoryPage &page = m_pages[i];
+            const uint64 readCycles = page.readCycles;
+            const uint64 writeCycles = page.writeCycles;
+            page = {}; // clear all handlers
+            page.array = &array[offset & kMask];
+            page.arrayWritable = writable;
+            page.readCycles = readCycles;
+            page.writeCycles = writeCycles;
             offset += kPageSize;
         }
     }
@@ -283,6 +312,74 @@ public:
         return entry.busWait(address, size, write, entry.ctx);
     }
 
+    /// @brief Determines if the specified address is backed by an array instead of handler functions.
+    /// @param[in] address the address to check
+    /// @return `true` if the page containing the address is mapped to an array
+    [[nodiscard]] FORCE_INLINE bool IsArrayMapped(uint32 address) const {
+        address &= kAddressMask;
+
+        return m_pages[address >> pageGranularityBits].array != nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Block transfers
+
+    /// @brief Retrieves the array backing the specified address, up to the end of its page.
+    ///
+    /// Meant for bulk transfers that read directly from plain memory regions.
+    ///
+    /// @param[in] address the address to look up
+    /// @return the memory from `address` to the end of its page, or an empty span if the page is not backed by an array
+    [[nodiscard]] FORCE_INLINE std::span<const uint8> GetArrayBlock(uint32 address) const {
+        address &= kAddressMask;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+
+        if (!entry.array) {
+            return {};
+        }
+        const uint32 offset = address & kPageMask;
+        return {&entry.array[offset], kPageSize - offset};
+    }
+
+    /// @brief Determines how many bytes starting at the specified address can be written with `WriteBlock`.
+    ///
+    /// Blocks can be written to pages backed by writable arrays or pages with a block write handler.
+    ///
+    /// @param[in] address the address to check
+    /// @return the number of bytes until the end of the page, or 0 if the page doesn't accept block writes
+    [[nodiscard]] FORCE_INLINE uint32 GetWriteBlockSize(uint32 address) const {
+        address &= kAddressMask;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+
+        if ((entry.array && entry.arrayWritable) || entry.writeBlock != nullptr) {
+            return kPageSize - (address & kPageMask);
+        }
+        return 0;
+    }
+
+    /// @brief Writes a block of big-endian data to the bus.
+    ///
+    /// The block must fit in the number of bytes reported by `GetWriteBlockSize` for the same address.
+    ///
+    /// @param[in] address the address to write
+    /// @param[in] data the data to write
+    FORCE_INLINE void WriteBlock(uint32 address, std::span<const uint8> data) {
+        address &= kAddressMask;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+        assert(data.size() <= kPageSize - (address & kPageMask));
+
+        if (entry.array) {
+            if (entry.arrayWritable) {
+                std::copy(data.begin(), data.end(), &entry.array[address & kPageMask]);
+            }
+        } else if (entry.writeBlock != nullptr) {
+            entry.writeBlock(address, data, entry.ctx);
+        }
+    }
+
     // -----------------------------------------------------------------------------------------------------------------
     // Timing
 
@@ -342,6 +439,9 @@ private:
 
         FnBusWait busWait = [](uint32, uint32, bool, void *) -> bool { return false; };
 
+        // Optional handler for bulk transfers; nullptr if the page only supports individual accesses
+        FnWriteBlock writeBlock = nullptr;
+
         uint64 readCycles = 1;
         uint64 writeCycles = 1;
     };
@@ -372,6 +472,8 @@ private:
     static void AssignHandler(MemoryPage &page, THandler &&handler) {
         if constexpr (fninfo::IsAssignable<FnBusWait, THandler>) {
             page.busWait = handler;
+        } else if constexpr (fninfo::IsAssignable<FnWriteBlock, THandler>) {
+            page.writeBlock = handler;
         } else if constexpr (peekpoke) {
             if constexpr (fninfo::IsAssignable<FnRead8, THandler>) {
                 page.peek8 = handler;
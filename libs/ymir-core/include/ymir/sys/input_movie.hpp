@@ -0,0 +1,198 @@
+#pragma once
+
+/**
+@file
+@brief Deterministic input movie recording and playback.
+*/
+
+#include <ymir/core/hash.hpp>
+#include <ymir/core/types.hpp>
+
+#include <ymir/hw/smpc/peripheral/peripheral_defs.hpp>
+#include <ymir/hw/smpc/peripheral/peripheral_report.hpp>
+
+#include <ymir/state/state.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Forward declarations
+
+namespace ymir {
+
+struct Saturn;
+
+} // namespace ymir
+
+// -----------------------------------------------------------------------------
+
+namespace ymir::sys {
+
+/// @brief System events recorded in an input movie.
+enum class MovieEvent : uint8 { SoftReset, HardReset, OpenTray, CloseTray };
+
+/// @brief An input movie: a per-frame log of peripheral reports and system events, plus periodic state checkpoints.
+///
+/// Movies always start from a hard reset with the virtual RTC set to `rtcTimestamp`, so that playback on the same IPL
+/// ROM and disc reproduces emulation exactly.
+struct InputMovie {
+    /// @brief Inputs and events of a single frame.
+    struct Frame {
+        /// @brief Events applied before the frame is run, in order.
+        std::vector<MovieEvent> events;
+
+        /// @brief Reports produced for each peripheral port, in the order the SMPC requested them.
+        std::array<std::vector<peripheral::PeripheralReport>, 2> reports;
+    };
+
+    /// @brief A complete system state captured at the start of a frame.
+    struct Checkpoint {
+        uint64 frame;
+        std::unique_ptr<state::State> state;
+    };
+
+    XXH128Hash iplHash{};  ///< Hash of the IPL ROM used to record the movie
+    XXH128Hash discHash{}; ///< Hash of the disc used to record the movie
+
+    /// @brief Virtual RTC timestamp at power on.
+    sint64 rtcTimestamp = 0;
+
+    /// @brief Peripherals connected to each port when recording started.
+    std::array<peripheral::PeripheralType, 2> peripheralTypes{peripheral::PeripheralType::None,
+                                                              peripheral::PeripheralType::None};
+
+    /// @brief Number of frames between checkpoints. Zero disables checkpoints other than the initial one.
+    /// Doubles while recording whenever the checkpoints are thinned out.
+    uint64 checkpointInterval = 600;
+
+    std::vector<Frame> frames;
+    std::vector<Checkpoint> checkpoints; ///< Sorted by frame number
+};
+
+/// @brief Records and plays back input movies through the SMPC input path.
+///
+/// While active, the movie player hooks into both peripheral ports. When recording, reports produced by the frontend
+/// are logged as they are requested by the SMPC; during playback, they are replaced with the recorded reports. Frames
+/// and system events must be driven through this object instead of the `Saturn` instance.
+class MoviePlayer {
+public:
+    enum class Mode { Idle, Recording, Playback };
+
+    explicit MoviePlayer(Saturn &saturn);
+    ~MoviePlayer();
+
+    MoviePlayer(const MoviePlayer &) = delete;
+    MoviePlayer(MoviePlayer &&) = delete;
+
+    /// @brief Starts recording a new movie.
+    ///
+    /// Switches the RTC to virtual mode with a fixed hard reset timestamp, hard resets the system and captures the
+    /// initial checkpoint. The previous RTC configuration is restored when the movie is stopped.
+    ///
+    /// Every checkpoint holds a full system state, so their number is capped to bound memory usage on long recordings.
+    /// When a new checkpoint exceeds the cap, every other checkpoint after the initial one is dropped and the checkpoint
+    /// interval is doubled.
+    ///
+    /// @param[in] rtcTimestamp the virtual RTC timestamp at power on
+    /// @param[in] checkpointInterval the number of frames between checkpoints
+    /// @param[in] maxCheckpoints the maximum number of checkpoints to keep; must be at least 2
+    void StartRecording(sint64 rtcTimestamp, uint64 checkpointInterval = 600, size_t maxCheckpoints = 16);
+
+    /// @brief Starts playing back the given movie from the first frame.
+    ///
+    /// Fails if the loaded IPL ROM or disc do not match the ones used to record the movie, or if the connected
+    /// peripherals differ.
+    ///
+    /// @param[in] movie the movie to play back
+    /// @return `true` if playback started
+    [[nodiscard]] bool StartPlayback(InputMovie &&movie);
+
+    /// @brief Stops recording or playback and restores the RTC configuration.
+    void Stop();
+
+    /// @brief Runs a single frame, recording or replaying its inputs and events.
+    ///
+    /// Playback stops automatically after the last frame, returning control of the inputs to the frontend.
+    void RunFrame();
+
+    /// @brief Seeks to the start of the specified frame.
+    ///
+    /// Loads the closest checkpoint at or before the frame and replays the remaining frames. When recording, frames
+    /// and checkpoints past the target frame are discarded and recording resumes from there.
+    ///
+    /// @param[in] frame the frame to seek to; must not be past the end of the movie
+    /// @return `true` if the seek succeeded
+    bool SeekTo(uint64 frame);
+
+    /// @brief Resets the system and records the event.
+    /// @param[in] hard `true` to do a hard reset, `false` for a soft reset
+    void Reset(bool hard);
+
+    /// @brief Opens the disc tray and records the event.
+    void OpenTray();
+
+    /// @brief Closes the disc tray and records the event.
+    void CloseTray();
+
+    [[nodiscard]] Mode GetMode() const {
+        return m_mode;
+    }
+
+    /// @brief Retrieves the number of the next frame to be run.
+    [[nodiscard]] uint64 GetCurrentFrame() const {
+        return m_frame;
+    }
+
+    /// @brief Retrieves the number of reports that did not match the recording during playback.
+    /// A nonzero value means the playback desynchronized.
+    [[nodiscard]] uint64 GetMismatchCount() const {
+        return m_mismatches;
+    }
+
+    [[nodiscard]] const InputMovie &GetMovie() const {
+        return m_movie;
+    }
+
+    /// @brief Moves the movie out of the player. Stops recording or playback.
+    [[nodiscard]] InputMovie TakeMovie();
+
+private:
+    Saturn &m_saturn;
+
+    Mode m_mode = Mode::Idle;
+    InputMovie m_movie;
+
+    uint64 m_frame = 0;
+    uint64 m_mismatches = 0;
+
+    // Maximum number of checkpoints kept while recording
+    size_t m_maxCheckpoints = 16;
+
+    // Frame being recorded
+    InputMovie::Frame m_pending;
+
+    // Report cursors into the current playback frame and the last reports replayed on each port
+    std::array<size_t, 2> m_reportIndex{};
+    std::array<peripheral::PeripheralReport, 2> m_lastReport{};
+    std::array<bool, 2> m_hasLastReport{};
+
+    // RTC configuration saved when the movie started
+    struct SavedRTCConfig;
+    std::unique_ptr<SavedRTCConfig> m_savedRTCConfig;
+
+    void ConfigureRTC(sint64 rtcTimestamp);
+    void RestoreRTC();
+
+    void InstallHooks();
+    void RemoveHooks();
+
+    template <uint32 port>
+    void ProcessReport(peripheral::PeripheralReport &report);
+
+    void ApplyEvent(MovieEvent event);
+    void CaptureCheckpoint();
+};
+
+} // namespace ymir::sys
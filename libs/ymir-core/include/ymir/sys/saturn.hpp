@@ -15,6 +15,7 @@ See @ref index for instructions on how to use the emulator.
 #include <ymir/state/state.hpp>
 
 #include <ymir/debug/debug_break.hpp>
+#include <ymir/debug/perf_counters.hpp>
 
 #include "memory.hpp"
 #include "system.hpp"
@@ -33,8 +34,13 @@ See @ref index for instructions on how to use the emulator.
 #include <ymir/hw/vdp/vdp.hpp>
 
 #include <ymir/media/disc.hpp>
+#include <ymir/media/sector_read_ahead.hpp>
 
+#include <ymir/util/event.hpp>
+
+#include <atomic>
 #include <memory>
+#include <thread>
 
 namespace ymir {
 
@@ -49,6 +55,7 @@ struct Saturn {
     /// The emulator comes with no disc, no peripherals, no cartridge, and a basic IPL ROM that puts the master SH-2
     /// into an infinite do-nothing loop.
     Saturn();
+    ~Saturn();
 
     /// @brief Performs a soft or hard reset of the system.
     /// @param[in] hard `true` to do a hard reset, `false` for a soft reset
@@ -82,6 +89,14 @@ struct Saturn {
     /// @return the clock ratios in use
     [[nodiscard]] const sys::ClockRatios &GetClockRatios() const noexcept;
 
+    /// @brief Retrieves the number of system cycles elapsed since the last hard reset.
+    ///
+    /// The counter advances once per CPU execution slice, so all events within a slice share the same count.
+    /// @return the current system cycle count
+    [[nodiscard]] uint64 GetCycleCount() const noexcept {
+        return m_scheduler.CurrentCount();
+    }
+
     /// @brief Loads the specified IPL ROM image.
     /// @param[in] ipl the contents of the IPL ROM image
     void LoadIPL(std::span<uint8, sys::kIPLSize> ipl);
@@ -167,6 +182,12 @@ struct Saturn {
     /// Enabling this option incurs a noticeable performance penalty. It is disabled by default to ensure optimal
     /// performance when those features are not needed.
     ///
+    /// While enabled, the SH-2 CPUs only run their instrumented code paths when a debugging feature needs them:
+    /// breakpoints, watchpoints, suspended CPUs, or tracers that want instruction or DMA data events (see
+    /// `ymir::debug::ISH2Tracer::NeedsHotPathEvents()`). This is reevaluated at the start of every `RunFrame()`,
+    /// `StepMasterSH2()` and `StepSlaveSH2()` call. Low-frequency events such as interrupts, exceptions and DMA
+    /// transfer boundaries are traced either way.
+    ///
     /// Disabling debug tracing also detaches all tracers from all components.
     ///
     /// @param[in] enable whether to enable or disable debug tracing
@@ -201,7 +222,15 @@ struct Saturn {
     /// - **Debug tracing**: configured with `EnableDebugTracing(bool)`
     /// - **SH-2 cache emulation**: configured with `EnableSH2CacheEmulation(bool)`
     void RunFrame() {
+        if (m_systemFeatures.enableDebugTracing) [[unlikely]] {
+            UpdateDebugInstrumentation();
+        }
         (this->*m_runFrameFn)();
+        if constexpr (debug::kPerfStatsEnabled) {
+            if (m_perfStatsEnabled) [[unlikely]] {
+                CollectPerfStats();
+            }
+        }
     }
 
     /// @brief Runs a single master SH-2 instruction using the current settings.
@@ -211,6 +240,9 @@ struct Saturn {
     /// - **SH-2 cache emulation**: configured with `EnableSH2CacheEmulation(bool)`
     /// @return the number of cycles executed
     uint64 StepMasterSH2() {
+        if (m_systemFeatures.enableDebugTracing) [[unlikely]] {
+            UpdateDebugInstrumentation();
+        }
         return (this->*m_stepMSH2Fn)();
     }
 
@@ -221,6 +253,9 @@ struct Saturn {
     /// - **SH-2 cache emulation**: configured with `EnableSH2CacheEmulation(bool)`
     /// @return the number of cycles executed, zero if the slave SH-2 is disabled
     uint64 StepSlaveSH2() {
+        if (m_systemFeatures.enableDebugTracing) [[unlikely]] {
+            UpdateDebugInstrumentation();
+        }
         return (this->*m_stepSSH2Fn)();
     }
 
@@ -270,6 +305,29 @@ struct Saturn {
         m_debugBreakMgr.SetDebugBreakRaisedCallback(callback);
     }
 
+    /// @brief Enables or disables per-component performance counters.
+    ///
+    /// Counters are collected at the end of every `RunFrame()` call. Has no effect unless the core was built with
+    /// performance counters (see `debug::kPerfStatsEnabled`). Must not be called while the emulator is running.
+    ///
+    /// @param[in] enable whether to enable performance counters
+    void EnablePerfStats(bool enable);
+
+    /// @brief Determines if performance counters are being collected.
+    /// @return `true` if performance counters are enabled
+    [[nodiscard]] bool IsPerfStatsEnabled() const noexcept {
+        return m_perfStatsEnabled;
+    }
+
+    /// @brief Retrieves the performance counters of the most recent frames.
+    ///
+    /// This function is thread-safe.
+    ///
+    /// @return a snapshot of the performance counters
+    [[nodiscard]] debug::PerfStats GetPerfStats() const {
+        return m_perfHistory.Snapshot();
+    }
+
     /// @brief Dumps the CD Block DRAM to the specified output stream.
     /// @param[in] out the output stream
     void DumpCDBlockDRAM(std::ostream &out);
@@ -290,6 +348,27 @@ private:
     template <bool debug, bool enableSH2Cache, bool cdblockLLE>
     bool Run();
 
+    /// @brief Decides whether the next SH-2 synchronization quantum can be widened up to the next scheduled event.
+    ///
+    /// Called after every quantum. The quantum is widened only after several quanta without cross-CPU communication
+    /// (FRT input capture, SCU register writes) while the slave SH-2 is disabled or asleep and no SCU DMA transfer or
+    /// DSP program is running. Any communication ends a wide quantum on the spot and shrinks it back.
+    void UpdateSH2SyncQuantum();
+
+    /// @brief Resets the adaptive SH-2 synchronization quantum to the minimum size.
+    void ResetSH2SyncQuantum();
+
+    /// @brief Ends a wide SH-2 synchronization quantum at the current master SH-2 cycle.
+    ///
+    /// Invoked right before an FRT input capture or SCU register write takes effect. Runs the SCU and the sleeping
+    /// slave SH-2 up to this point and makes the master SH-2 stop after the current instruction, so that the slave SH-2
+    /// and the SCU observe the communication when it happens rather than at either end of the quantum.
+    void EndWideSH2SyncQuantum();
+
+    /// @brief Returns the total number of cross-CPU communication events tracked by the adaptive SH-2 synchronization
+    /// quantum.
+    uint64 GetSH2SyncCommCount() const;
+
     /// @brief Runs a single master SH-2 instruction.
     /// @tparam debug whether to use debug tracing
     /// @tparam enableSH2Cache whether to emulate SH-2 caches
@@ -327,10 +406,19 @@ private:
     /// Depends on debug tracing and SH-2 cache emulation settings.
     StepSH2Fn m_stepSSH2Fn;
 
+    /// @brief Whether any SH-2 currently needs the instrumented (debug) code paths.
+    ///
+    /// Only relevant while debug tracing is enabled. Updated by `UpdateDebugInstrumentation()`.
+    bool m_sh2DebugInstrumented = false;
+
     /// @brief Updates pointers to the execution functions based on the current debug tracing, SH-2 cache emulation and
     /// low-level CD Block emulation settings.
     void UpdateFunctionPointers();
 
+    /// @brief Checks if the SH-2 CPUs need the instrumented code paths and updates the execution function pointers if
+    /// that changed.
+    void UpdateDebugInstrumentation();
+
     /// @brief Helper template to convert runtime parameters into compile-time constants for building function pointers.
     template <bool... t_features>
     void UpdateFunctionPointersTemplate(bool feature, auto... features);
@@ -351,6 +439,51 @@ private:
     /// @param[in] cycles the number of system cycles to advance
     void AdvanceSH1(uint64 cycles);
 
+    // -------------------------------------------------------------------------
+    // Threaded LLE CD block
+    //
+    // When enabled, the SH-1, YGR, CD drive and CD block DRAM are advanced on a dedicated thread in quanta matching
+    // the emulator's scheduler time slices. Each quantum is posted after the scheduler advances and runs concurrently
+    // with the SH-2s in the next time slice. The emulator thread waits for the quantum to finish before any operation
+    // that touches the CD block: host accesses to the YGR registers, scheduler events (CD drive state updates),
+    // resets, clock changes and the end of a frame.
+
+    /// @brief Whether the LLE CD block runs on a dedicated thread.
+    bool m_threadedCDBlock = false;
+
+    /// @brief Whether a CD block quantum was posted and not yet synchronized. Only used by the emulator thread.
+    bool m_cdblockQuantumInFlight = false;
+
+    /// @brief Number of system cycles to advance the CD block in the current quantum.
+    uint64 m_cdblockQuantumCycles = 0;
+
+    /// @brief Set by the CD block thread when the YGR raises SCU external interrupt 0 during a quantum.
+    std::atomic_bool m_cdblockDeferredExtIntr0 = false;
+
+    bool m_cdblockThreadShutdown = false;         ///< Tells the CD block thread to exit
+    util::Event m_cdblockQuantumStartSignal{false}; ///< Signaled when a quantum is posted or on shutdown
+    util::Event m_cdblockQuantumDoneSignal{false};  ///< Signaled when the CD block thread finishes a quantum
+    std::thread m_cdblockThread;                    ///< The CD block thread
+
+    /// @brief Starts or stops the CD block thread.
+    /// @param[in] enable whether to run the LLE CD block on a dedicated thread
+    void EnableThreadedCDBlock(bool enable);
+
+    /// @brief Hands a quantum of system cycles to the CD block thread.
+    /// @param[in] cycles the number of system cycles to advance the CD block
+    void PostCDBlockQuantum(uint64 cycles);
+
+    /// @brief Waits for the CD block thread to finish the quantum in flight, if any, then delivers deferred
+    /// interrupts.
+    void SyncCDBlock();
+
+    /// @brief Triggers SCU external interrupt 0 on behalf of the YGR.
+    /// Deferred until the next synchronization if invoked from the CD block thread.
+    void TriggerCDBlockExtIntr0();
+
+    /// @brief The CD block thread loop.
+    void CDBlockThread();
+
     /// @brief Configures bus access cycles.
     /// @param[in] fastTimings `true` to use 1 waitstate for every access, `false` to use normal timings
     void ConfigureAccessCycles(bool fastTimings);
@@ -435,11 +568,22 @@ private:
     media::Disc m_disc;         ///< Currently loaded game disc
     media::fs::Filesystem m_fs; ///< Filesystem contained in the disc
 
+    media::SectorReadAhead m_readAhead{m_disc}; ///< Asynchronous sector reader shared by the CD block and drive
+
     uint64 m_msh2SpilloverCycles; ///< Master SH-2 execution cycles spilled over between executions
     uint64 m_ssh2SpilloverCycles; ///< Slave SH-2 execution cycles spilled over between executions
     uint64 m_sh1SpilloverCycles;  ///< SH-1 execution cycles spilled over between executions
     uint64 m_sh1FracCycles;       ///< SH-1 fractional execution cycles spilled over by clock ratio calculation
 
+    // Adaptive SH-2 synchronization quantum
+    bool m_sh2SyncAdaptive;      ///< Whether the quantum is allowed to widen (configuration.system.adaptiveSH2Sync)
+    bool m_sh2SyncWide;          ///< Whether the SH-2s and SCU currently run until the next scheduled event
+    uint32 m_sh2SyncQuietQuanta; ///< Consecutive quanta without cross-CPU communication and with an idle slave SH-2
+    uint64 m_sh2SyncCommCount;   ///< Cross-CPU communication event count at the end of the last quantum
+    bool m_sh2SyncInWideQuantum; ///< Whether the master SH-2 is running a wide quantum that has not been ended yet
+    uint64 m_sh2SyncSCUCycles;   ///< Cycle count up to which the SCU has run in the current quantum
+    uint64 m_sh2SyncSlaveCycles; ///< Cycle count from which the slave SH-2 runs in the current quantum
+
     // -------------------------------------------------------------------------
     // System operations (SMPC) - smpc::ISMPCOperations implementation
 
@@ -472,6 +616,29 @@ private:
     // Debugger
 
     debug::DebugBreakManager m_debugBreakMgr;
+
+    // -------------------------------------------------------------------------
+    // Performance counters
+
+    bool m_perfStatsEnabled = false;    ///< Whether performance counters are being collected
+    uint64 m_perfFrame = 0;             ///< Frames collected since performance counters were enabled
+    debug::PerfCounters m_perfCounters; ///< Live performance counters
+    debug::PerfHistory m_perfHistory;   ///< Stats of the most recent frames
+
+    /// @brief Moves the current performance counters into the history.
+    void CollectPerfStats();
+
+    /// @brief Retrieves the host time counter for the given component if performance counters are enabled.
+    /// @param[in] component the component to measure
+    /// @return a pointer to the counter, or `nullptr` if performance counters are disabled
+    FORCE_INLINE debug::PerfCounter *GetPerfTimerCounter(debug::PerfComponent component) {
+        if constexpr (debug::kPerfStatsEnabled) {
+            if (m_perfStatsEnabled) [[unlikely]] {
+                return &m_perfCounters.advanceNanos[static_cast<size_t>(component)];
+            }
+        }
+        return nullptr;
+    }
 };
 
 } // namespace ymir
@@ -109,7 +109,7 @@ template <std::size_t start, std::size_t end = start, std::integral T>
 /// @param[in] value the value to extract bits from
 /// @return the signed integer contained in the bit range between `start` and `end` of `value`
 template <std::size_t start, std::size_t end = start, std::integral T>
-[[nodiscard]] FORCE_INLINE auto extract_signed(T value) noexcept {
+[[nodiscard]] FORCE_INLINE constexpr auto extract_signed(T value) noexcept {
     return sign_extend<end - start + 1>(extract<start, end>(value));
 }
 
@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+@file
+@brief Runtime detection of host CPU features used to select SIMD code paths.
+*/
+
+#include <ymir/core/types.hpp>
+
+namespace util {
+
+/// @brief SIMD instruction set levels with dedicated code paths.
+///
+/// x86-64 levels are ordered from least to most capable. NEON is the only level on ARM64, and `Scalar` is used on
+/// every other architecture.
+enum class SIMDLevel : uint8 {
+    Scalar, ///< No SIMD instructions
+    SSE2,   ///< x86-64 baseline
+    SSE41,  ///< SSE4.1
+    AVX2,   ///< AVX2
+    AVX512, ///< AVX-512 Foundation, Byte/Word and Vector Length extensions
+    NEON,   ///< ARM64 Advanced SIMD
+};
+
+/// @brief Host CPU features relevant to the emulator.
+struct CPUFeatures {
+    bool sse2 = false;     ///< SSE2 is available
+    bool sse41 = false;    ///< SSE4.1 is available
+    bool avx2 = false;     ///< AVX2 is available and enabled by the OS
+    bool avx512bw = false; ///< AVX-512 F/BW/VL are available and enabled by the OS
+    bool neon = false;     ///< ARM64 Advanced SIMD is available
+
+    /// @brief Determines the most capable SIMD level supported by these features.
+    /// @return the highest supported SIMD level
+    [[nodiscard]] SIMDLevel GetBestSIMDLevel() const;
+};
+
+/// @brief Retrieves the features of the host CPU.
+///
+/// Detection runs once on the first call; subsequent calls return the cached result.
+///
+/// @return a reference to the host CPU features
+[[nodiscard]] const CPUFeatures &GetHostCPUFeatures();
+
+/// @brief Retrieves a human-readable name for the SIMD level.
+/// @param[in] level the SIMD level
+/// @return the name of the SIMD level
+[[nodiscard]] const char *GetSIMDLevelName(SIMDLevel level);
+
+} // namespace util
@@ -86,6 +86,12 @@ public:
     /// @brief Resets (clears) the event signal.
     void Reset();
 
+    /// @brief Determines if the event is currently signaled without blocking.
+    /// @return `true` if the event is signaled
+    [[nodiscard]] bool IsSet() const {
+        return m_value.load(std::memory_order_acquire) != 0;
+    }
+
 private:
     #ifdef _WIN32
     std::atomic<uint8> m_value;
@@ -123,8 +129,15 @@ public:
         m_set = false;
     }
 
+    /// @brief Determines if the event is currently signaled without blocking.
+    /// @return `true` if the event is signaled
+    [[nodiscard]] bool IsSet() const {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_set;
+    }
+
 private:
-    std::mutex m_mutex;
+    mutable std::mutex m_mutex;
     std::condition_variable m_condVar;
     bool m_set;
 
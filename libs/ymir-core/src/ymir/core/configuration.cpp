@@ -9,6 +9,8 @@ void Configuration::NotifyObservers() {
 
     audio.interpolation.Notify();
     audio.threadedSCSP.Notify();
+
+    cdblock.threadedLLE.Notify();
 }
 
 } // namespace ymir::core
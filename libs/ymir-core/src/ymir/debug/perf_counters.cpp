@@ -0,0 +1,57 @@
+#include <ymir/debug/perf_counters.hpp>
+
+namespace ymir::debug {
+
+void PerfCounters::Collect(PerfFrameStats &stats) {
+    for (size_t i = 0; i < sh2.size(); ++i) {
+        stats.sh2Instructions[i] = sh2[i].instructions.Take();
+        stats.sh2Cycles[i] = sh2[i].cycles.Take();
+        stats.sh2MemoryAccesses[i] = sh2[i].memoryAccesses.Take();
+        stats.sh2MMIOAccesses[i] = sh2[i].mmioAccesses.Take();
+    }
+
+    stats.scuDMABytes = scuDMABytes.Take();
+
+    stats.vdp1Commands = vdp1Commands.Take();
+    stats.vdp1Pixels = vdp1Pixels.Take();
+    stats.vdp2Lines = vdp2Lines.Take();
+    stats.vdp2Layers = vdp2Layers.Take();
+
+    stats.scspSamples = scspSamples.Take();
+    stats.m68kInstructions = m68kInstructions.Take();
+
+    for (size_t i = 0; i < eventsFired.size(); ++i) {
+        stats.eventsFired[i] = eventsFired[i].Take();
+    }
+    for (size_t i = 0; i < advanceNanos.size(); ++i) {
+        stats.advanceNanos[i] = advanceNanos[i].Take();
+    }
+}
+
+void PerfHistory::Push(const PerfFrameStats &stats) {
+    std::unique_lock lock{m_mutex};
+    m_frames[m_next] = stats;
+    m_next = (m_next + 1) % kSize;
+    if (m_count < kSize) {
+        ++m_count;
+    }
+}
+
+void PerfHistory::Clear() {
+    std::unique_lock lock{m_mutex};
+    m_next = 0;
+    m_count = 0;
+}
+
+PerfStats PerfHistory::Snapshot() const {
+    std::unique_lock lock{m_mutex};
+    PerfStats stats;
+    stats.frames.reserve(m_count);
+    const size_t first = (m_next + kSize - m_count) % kSize;
+    for (size_t i = 0; i < m_count; ++i) {
+        stats.frames.push_back(m_frames[(first + i) % kSize]);
+    }
+    return stats;
+}
+
+} // namespace ymir::debug
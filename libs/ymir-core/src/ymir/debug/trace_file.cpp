@@ -0,0 +1,433 @@
+#include <ymir/debug/trace_file.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <lz4.h>
+
+#include <algorithm>
+#include <array>
+
+namespace ymir::debug {
+
+static constexpr std::array<char, 8> kMagic = {'Y', 'M', 'I', 'R', 'T', 'R', 'C', 'E'};
+static constexpr std::array<char, 8> kIndexMagic = {'Y', 'M', 'I', 'R', 'T', 'I', 'D', 'X'};
+static constexpr uint32 kVersion = 1;
+
+static constexpr size_t kEventSize = 16;
+static constexpr size_t kChunkHeaderSize = 33;
+static constexpr size_t kTrailerSize = 16;
+
+namespace {
+
+template <typename T>
+void WriteValue(std::ostream &out, T value) {
+    std::array<uint8, sizeof(T)> buf{};
+    util::WriteLE<T>(buf.data(), value);
+    out.write(reinterpret_cast<const char *>(buf.data()), buf.size());
+}
+
+template <typename T>
+bool ReadValue(std::istream &in, T &value) {
+    std::array<uint8, sizeof(T)> buf{};
+    if (!in.read(reinterpret_cast<char *>(buf.data()), buf.size())) {
+        return false;
+    }
+    value = util::ReadLE<T>(buf.data());
+    return true;
+}
+
+void WriteChunkHeader(std::ostream &out, const TraceChunkInfo &chunk) {
+    WriteValue<uint32>(out, chunk.compressedSize);
+    WriteValue<uint32>(out, chunk.eventCount);
+    WriteValue<uint64>(out, chunk.firstCycle);
+    WriteValue<uint64>(out, chunk.lastCycle);
+    WriteValue<uint32>(out, chunk.firstFrame);
+    WriteValue<uint32>(out, chunk.lastFrame);
+    WriteValue<uint8>(out, chunk.stream);
+}
+
+bool ReadChunkHeader(std::istream &in, TraceChunkInfo &chunk) {
+    return ReadValue(in, chunk.compressedSize) && ReadValue(in, chunk.eventCount) && ReadValue(in, chunk.firstCycle) &&
+           ReadValue(in, chunk.lastCycle) && ReadValue(in, chunk.firstFrame) && ReadValue(in, chunk.lastFrame) &&
+           ReadValue(in, chunk.stream);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Writer
+
+TraceFileWriter::~TraceFileWriter() {
+    Close();
+}
+
+bool TraceFileWriter::Open(const std::filesystem::path &path, std::span<const std::string> streamNames,
+                           std::error_code &error) {
+    error.clear();
+    Close();
+
+    if (streamNames.empty() || streamNames.size() > 255) {
+        error = std::make_error_code(std::errc::invalid_argument);
+        return false;
+    }
+
+    m_out.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_out) {
+        error = std::make_error_code(std::errc::io_error);
+        return false;
+    }
+
+    m_out.write(kMagic.data(), kMagic.size());
+    WriteValue<uint32>(m_out, kVersion);
+    WriteValue<uint8>(m_out, streamNames.size());
+    for (const std::string &name : streamNames) {
+        const auto len = static_cast<uint8>(std::min<size_t>(name.size(), 255));
+        WriteValue<uint8>(m_out, len);
+        m_out.write(name.data(), len);
+    }
+
+    m_streams.clear();
+    m_streams.resize(streamNames.size());
+    for (Stream &stream : m_streams) {
+        stream.pending.reserve(kChunkEvents);
+    }
+    m_chunks.clear();
+    m_eventCount = 0;
+    m_raw.resize(kChunkEvents * kEventSize);
+    m_compressed.resize(LZ4_compressBound(kChunkEvents * kEventSize));
+
+    if (!m_out) {
+        error = std::make_error_code(std::errc::io_error);
+        m_out.close();
+        return false;
+    }
+    return true;
+}
+
+void TraceFileWriter::Write(uint8 stream, std::span<const TraceEvent> events) {
+    if (!m_out.is_open() || stream >= m_streams.size()) {
+        return;
+    }
+
+    Stream &str = m_streams[stream];
+    for (const TraceEvent &event : events) {
+        if (event.type == TraceEventType::Frame) {
+            str.frame = event.data;
+        }
+        if (str.pending.empty()) {
+            str.firstFrame = str.frame;
+        }
+        str.pending.push_back(event);
+        if (str.pending.size() >= kChunkEvents) {
+            FlushChunk(stream);
+        }
+    }
+    m_eventCount += events.size();
+}
+
+bool TraceFileWriter::Close() {
+    if (!m_out.is_open()) {
+        return true;
+    }
+
+    for (size_t i = 0; i < m_streams.size(); ++i) {
+        FlushChunk(i);
+    }
+
+    const uint64 indexOffset = m_out.tellp();
+    WriteValue<uint32>(m_out, m_chunks.size());
+    for (const TraceChunkInfo &chunk : m_chunks) {
+        WriteValue<uint64>(m_out, chunk.offset);
+    }
+    WriteValue<uint64>(m_out, indexOffset);
+    m_out.write(kIndexMagic.data(), kIndexMagic.size());
+
+    const bool success = static_cast<bool>(m_out.flush());
+    m_out.close();
+    m_streams.clear();
+    m_chunks.clear();
+    return success;
+}
+
+void TraceFileWriter::FlushChunk(uint8 stream) {
+    Stream &str = m_streams[stream];
+    if (str.pending.empty()) {
+        return;
+    }
+
+    // Store events in columns with delta-encoded cycles to help the compressor
+    const size_t count = str.pending.size();
+    uint8 *cycles = m_raw.data();
+    uint8 *data = cycles + count * sizeof(uint64);
+    uint8 *exts = data + count * sizeof(uint32);
+    uint8 *types = exts + count * sizeof(uint16);
+    uint8 *params = types + count;
+    uint64 prevCycle = str.pending.front().cycle;
+    for (size_t i = 0; i < count; ++i) {
+        const TraceEvent &event = str.pending[i];
+        util::WriteLE<uint64>(&cycles[i * sizeof(uint64)], event.cycle - prevCycle);
+        util::WriteLE<uint32>(&data[i * sizeof(uint32)], event.data);
+        util::WriteLE<uint16>(&exts[i * sizeof(uint16)], event.ext);
+        types[i] = static_cast<uint8>(event.type);
+        params[i] = event.param;
+        prevCycle = event.cycle;
+    }
+
+    const int rawSize = str.pending.size() * kEventSize;
+    const int compressedSize = LZ4_compress_default(reinterpret_cast<const char *>(m_raw.data()), m_compressed.data(),
+                                                    rawSize, m_compressed.size());
+
+    TraceChunkInfo chunk{
+        .offset = static_cast<uint64>(m_out.tellp()),
+        .compressedSize = static_cast<uint32>(compressedSize),
+        .eventCount = static_cast<uint32>(str.pending.size()),
+        .firstCycle = str.pending.front().cycle,
+        .lastCycle = str.pending.back().cycle,
+        .firstFrame = str.firstFrame,
+        .lastFrame = str.frame,
+        .stream = stream,
+    };
+    WriteChunkHeader(m_out, chunk);
+    m_out.write(m_compressed.data(), compressedSize);
+    m_chunks.push_back(chunk);
+
+    str.pending.clear();
+}
+
+// -----------------------------------------------------------------------------
+// Reader
+
+bool TraceFileReader::Open(const std::filesystem::path &path, std::error_code &error) {
+    error.clear();
+    m_in.close();
+    m_streamNames.clear();
+    m_chunks.clear();
+    m_hasIndex = false;
+
+    const uint64 fileSize = std::filesystem::file_size(path, error);
+    if (error) {
+        return false;
+    }
+
+    m_in.open(path, std::ios::binary);
+    if (!m_in) {
+        error = std::make_error_code(std::errc::io_error);
+        return false;
+    }
+
+    std::array<char, 8> magic{};
+    uint32 version{};
+    uint8 numStreams{};
+    if (!m_in.read(magic.data(), magic.size()) || magic != kMagic || !ReadValue(m_in, version) ||
+        version != kVersion || !ReadValue(m_in, numStreams) || numStreams == 0) {
+        error = std::make_error_code(std::errc::illegal_byte_sequence);
+        m_in.close();
+        return false;
+    }
+    m_streamNames.resize(numStreams);
+    for (std::string &name : m_streamNames) {
+        uint8 len{};
+        if (!ReadValue(m_in, len)) {
+            error = std::make_error_code(std::errc::illegal_byte_sequence);
+            m_in.close();
+            return false;
+        }
+        name.resize(len);
+        if (!m_in.read(name.data(), len)) {
+            error = std::make_error_code(std::errc::illegal_byte_sequence);
+            m_in.close();
+            return false;
+        }
+    }
+
+    const uint64 dataOffset = m_in.tellg();
+    m_hasIndex = ReadIndex(fileSize);
+    if (!m_hasIndex) {
+        RebuildIndex(dataOffset, fileSize);
+    }
+
+    SelectStream(0);
+    return true;
+}
+
+bool TraceFileReader::SelectStream(uint8 stream) {
+    if (stream >= m_streamNames.size()) {
+        return false;
+    }
+    m_streamChunks.clear();
+    for (size_t i = 0; i < m_chunks.size(); ++i) {
+        if (m_chunks[i].stream == stream) {
+            m_streamChunks.push_back(i);
+        }
+    }
+    m_chunkPos = 0;
+    m_events.clear();
+    m_eventPos = 0;
+    m_frame = 0;
+    return true;
+}
+
+bool TraceFileReader::SeekFrame(uint32 frame) {
+    auto it = std::find_if(m_streamChunks.begin(), m_streamChunks.end(),
+                           [&](size_t index) { return m_chunks[index].lastFrame >= frame; });
+    for (; it != m_streamChunks.end(); ++it) {
+        if (!LoadChunk(it - m_streamChunks.begin())) {
+            return false;
+        }
+        uint32 currFrame = m_chunks[*it].firstFrame;
+        for (size_t i = 0; i < m_events.size(); ++i) {
+            if (m_events[i].type == TraceEventType::Frame) {
+                currFrame = m_events[i].data;
+            }
+            if (currFrame >= frame) {
+                m_eventPos = i;
+                m_frame = currFrame;
+                return true;
+            }
+        }
+    }
+    m_chunkPos = m_streamChunks.size();
+    m_events.clear();
+    m_eventPos = 0;
+    return false;
+}
+
+bool TraceFileReader::SeekCycle(uint64 cycle) {
+    auto it = std::find_if(m_streamChunks.begin(), m_streamChunks.end(),
+                           [&](size_t index) { return m_chunks[index].lastCycle >= cycle; });
+    for (; it != m_streamChunks.end(); ++it) {
+        if (!LoadChunk(it - m_streamChunks.begin())) {
+            return false;
+        }
+        uint32 currFrame = m_chunks[*it].firstFrame;
+        for (size_t i = 0; i < m_events.size(); ++i) {
+            if (m_events[i].type == TraceEventType::Frame) {
+                currFrame = m_events[i].data;
+            }
+            if (m_events[i].cycle >= cycle) {
+                m_eventPos = i;
+                m_frame = currFrame;
+                return true;
+            }
+        }
+    }
+    m_chunkPos = m_streamChunks.size();
+    m_events.clear();
+    m_eventPos = 0;
+    return false;
+}
+
+bool TraceFileReader::Next(TraceEvent &event) {
+    while (m_eventPos >= m_events.size()) {
+        if (m_chunkPos >= m_streamChunks.size() || !LoadChunk(m_chunkPos)) {
+            return false;
+        }
+    }
+    event = m_events[m_eventPos++];
+    if (event.type == TraceEventType::Frame) {
+        m_frame = event.data;
+    }
+    return true;
+}
+
+bool TraceFileReader::ReadIndex(uint64 fileSize) {
+    if (fileSize < kTrailerSize) {
+        return false;
+    }
+
+    uint64 indexOffset{};
+    std::array<char, 8> magic{};
+    m_in.seekg(fileSize - kTrailerSize);
+    if (!ReadValue(m_in, indexOffset) || !m_in.read(magic.data(), magic.size()) || magic != kIndexMagic ||
+        indexOffset > fileSize - kTrailerSize) {
+        m_in.clear();
+        return false;
+    }
+
+    uint32 numChunks{};
+    m_in.seekg(indexOffset);
+    if (!ReadValue(m_in, numChunks) || uint64(numChunks) * sizeof(uint64) > fileSize - kTrailerSize - indexOffset) {
+        m_in.clear();
+        return false;
+    }
+    std::vector<uint64> offsets(numChunks);
+    for (uint64 &offset : offsets) {
+        if (!ReadValue(m_in, offset)) {
+            m_in.clear();
+            return false;
+        }
+    }
+
+    m_chunks.resize(numChunks);
+    for (size_t i = 0; i < numChunks; ++i) {
+        TraceChunkInfo &chunk = m_chunks[i];
+        chunk.offset = offsets[i];
+        m_in.seekg(chunk.offset);
+        if (!ReadChunkHeader(m_in, chunk) || chunk.stream >= m_streamNames.size()) {
+            m_in.clear();
+            m_chunks.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+void TraceFileReader::RebuildIndex(uint64 dataOffset, uint64 fileSize) {
+    uint64 offset = dataOffset;
+    m_in.seekg(offset);
+    while (offset + kChunkHeaderSize <= fileSize) {
+        TraceChunkInfo chunk{.offset = offset};
+        if (!ReadChunkHeader(m_in, chunk) || chunk.stream >= m_streamNames.size() || chunk.eventCount == 0 ||
+            chunk.eventCount > TraceFileWriter::kChunkEvents ||
+            offset + kChunkHeaderSize + chunk.compressedSize > fileSize) {
+            break;
+        }
+        m_chunks.push_back(chunk);
+        offset += kChunkHeaderSize + chunk.compressedSize;
+        m_in.seekg(offset);
+    }
+    m_in.clear();
+}
+
+bool TraceFileReader::LoadChunk(size_t streamChunkPos) {
+    const TraceChunkInfo &chunk = m_chunks[m_streamChunks[streamChunkPos]];
+    m_chunkPos = streamChunkPos + 1;
+    m_events.clear();
+    m_eventPos = 0;
+    m_frame = chunk.firstFrame;
+
+    m_compressed.resize(chunk.compressedSize);
+    m_in.seekg(chunk.offset + kChunkHeaderSize);
+    if (!m_in.read(m_compressed.data(), chunk.compressedSize)) {
+        m_in.clear();
+        return false;
+    }
+
+    std::vector<uint8> raw(chunk.eventCount * kEventSize);
+    const int rawSize = LZ4_decompress_safe(m_compressed.data(), reinterpret_cast<char *>(raw.data()),
+                                            chunk.compressedSize, raw.size());
+    if (rawSize != static_cast<int>(raw.size())) {
+        return false;
+    }
+
+    const size_t count = chunk.eventCount;
+    const uint8 *cycles = raw.data();
+    const uint8 *data = cycles + count * sizeof(uint64);
+    const uint8 *exts = data + count * sizeof(uint32);
+    const uint8 *types = exts + count * sizeof(uint16);
+    const uint8 *params = types + count;
+    uint64 cycle = chunk.firstCycle;
+    m_events.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        TraceEvent &event = m_events[i];
+        cycle += util::ReadLE<uint64>(&cycles[i * sizeof(uint64)]);
+        event.cycle = cycle;
+        event.data = util::ReadLE<uint32>(&data[i * sizeof(uint32)]);
+        event.ext = util::ReadLE<uint16>(&exts[i * sizeof(uint16)]);
+        event.type = static_cast<TraceEventType>(types[i]);
+        event.param = params[i];
+    }
+    return true;
+}
+
+} // namespace ymir::debug
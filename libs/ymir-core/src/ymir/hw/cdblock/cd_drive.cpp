@@ -25,10 +25,11 @@ FORCE_INLINE static void TraceRxCommandTxStatus(debug::ICDDriveTracer *tracer, s
 // Implementation
 
 CDDrive::CDDrive(core::Scheduler &scheduler, const media::Disc &disc, const media::fs::Filesystem &fs,
-                 core::Configuration::CDBlock &config)
+                 media::SectorReadAhead &readAhead, core::Configuration::CDBlock &config)
     : m_scheduler(scheduler)
     , m_disc(disc)
-    , m_fs(fs) {
+    , m_fs(fs)
+    , m_readAhead(readAhead) {
 
     m_stateEvent = m_scheduler.RegisterEvent(
         core::events::CDBlockLLEDriveState, this, [](core::EventContext &eventContext, void *userContext) {
@@ -515,7 +516,7 @@ FORCE_INLINE uint64 CDDrive::OpReadSector() {
 
         const uint32 crc = media::CalcCRC(std::span<uint8, 2064>{std::span<uint8>{m_sectorDataBuffer}.first(2064)});
         util::WriteLE<uint32>(&m_sectorDataBuffer[2348], crc);
-    } else if (track == nullptr || !track->ReadSector(m_currFAD, m_sectorDataBuffer)) {
+    } else if (track == nullptr || !m_readAhead.ReadSector(*track, m_currFAD, m_sectorDataBuffer)) {
         // Lead-in area or unavailable/empty sector
         m_sectorDataBuffer.fill(0);
         m_sectorDataBuffer[12] = util::to_bcd(m_currFAD / 75 / 60);
@@ -637,6 +638,10 @@ FORCE_INLINE void CDDrive::SetupSeek(bool read) {
                 m_currFAD = m_targetFAD = track->indices[index].startFrameAddress - 4;
                 m_seekOp = Operation::ReadAudioSector;
             }
+
+            // Start reading sectors ahead while the seek completes
+            m_readAhead.Prefetch(m_currFAD, session.endFrameAddress,
+                                 m_seekOp == Operation::ReadDataSector ? m_readSpeed : 1);
         }
     } else {
         m_seekOp = Operation::Idle;
@@ -44,10 +44,11 @@ static uint32 CalcPutOffset(uint32 size) {
 static constexpr uint32 kSeekTicks = 2;
 
 CDBlock::CDBlock(core::Scheduler &scheduler, const media::Disc &disc, const media::fs::Filesystem &fs,
-                 core::Configuration::CDBlock &config)
+                 media::SectorReadAhead &readAhead, core::Configuration::CDBlock &config)
     : m_scheduler(scheduler)
     , m_disc(disc)
-    , m_fs(fs) {
+    , m_fs(fs)
+    , m_readAhead(readAhead) {
 
     m_driveStateUpdateEvent = m_scheduler.RegisterEvent(core::events::CDBlockDriveState, this, OnDriveStateUpdateEvent);
     m_commandExecEvent = m_scheduler.RegisterEvent(core::events::CDBlockCommand, this, OnCommandExecEvent);
@@ -923,6 +924,13 @@ void CDBlock::ProcessDriveState() {
 
     switch (GetStatusCode()) {
     case kStatusCodeSeek:
+        if (m_seekTicks == kSeekTicks) {
+            // Start reading sectors ahead while the seek completes
+            const uint32 startPos = m_status.frameAddress < m_playStartPos || m_status.frameAddress > m_playEndPos
+                                        ? m_playStartPos
+                                        : m_status.frameAddress;
+            m_readAhead.Prefetch(startPos, m_playEndPos, m_status.controlADR == 0x41 ? m_readSpeed : 1);
+        }
         // HACK: Extremely hacky way to make the status transition from Seek to Play
         if (m_seekTicks > 0) {
             --m_seekTicks;
@@ -992,10 +1000,14 @@ void CDBlock::ProcessDriveStatePlay() {
             const media::Session &session = m_disc.sessions.back();
             const media::Track *track = session.FindTrack(frameAddress);
 
-            Buffer &buffer = m_scratchBuffers[0];
+            // Data sectors are read straight into a free partition buffer; audio sectors and sectors read while the
+            // buffers are full go to the scratch buffer
+            const bool isAudio = track != nullptr && track->controlADR == 0x01;
+            Buffer *poolBuffer = isAudio ? nullptr : m_partitionManager.AllocateBuffer();
+            Buffer &buffer = poolBuffer != nullptr ? *poolBuffer : m_scratchBuffers[0];
 
             // Sanity check: is the track valid?
-            if (track != nullptr && track->ReadSector(frameAddress, buffer.data)) [[likely]] {
+            if (track != nullptr && m_readAhead.ReadSector(*track, frameAddress, buffer.data)) [[likely]] {
                 devlog::trace<grp::play>("Read {} bytes from frame address {:06X}", track->sectorSize, frameAddress);
 
                 if (track->controlADR == 0x01) {
@@ -1032,7 +1044,7 @@ void CDBlock::ProcessDriveStatePlay() {
                     }
 
                     devlog::trace<grp::play>("Sector {:06X} sent to SCSP", frameAddress);
-                } else if (m_partitionManager.GetFreeBufferCount() == 0) [[unlikely]] {
+                } else if (poolBuffer == nullptr) [[unlikely]] {
                     devlog::trace<grp::play>("No free buffer available");
 
                     // TODO: what is the correct status code here?
@@ -1043,34 +1055,14 @@ void CDBlock::ProcessDriveStatePlay() {
                 } else {
                     buffer.size = m_getSectorLength;
                     buffer.frameAddress = frameAddress;
-                    track->ReadSectorSubheader(frameAddress, buffer.subheader);
+                    track->ReadSectorSubheader(buffer.data, buffer.subheader);
 
                     // Check against CD device filter and send data to the appropriate destination
-                    uint8 filterNum = m_cdDeviceConnection;
-                    for (int i = 0; i < kNumFilters && filterNum != Filter::kDisconnected; i++) {
-                        const Filter &filter = m_filters[filterNum];
-                        if (filter.Test(buffer)) {
-                            if (filter.passOutput == Filter::kDisconnected) [[unlikely]] {
-                                devlog::trace<grp::play>("Passed filter; output disconnected - discarded");
-                            } else {
-                                assert(filter.passOutput < m_filters.size());
-                                devlog::trace<grp::play>("Passed filter; sent to buffer partition {}",
-                                                         filter.passOutput);
-                                m_partitionManager.InsertHead(filter.passOutput, buffer);
-                                m_lastCDWritePartition = filter.passOutput;
-                                SetInterrupt(kHIRQ_CSCT);
-                            }
-                            break;
-                        } else {
-                            if (filter.failOutput == Filter::kDisconnected) [[unlikely]] {
-                                devlog::trace<grp::play>("Filtered out; output disconnected - discarded");
-                                break;
-                            } else {
-                                assert(filter.failOutput < m_filters.size());
-                                devlog::trace<grp::play>("Filtered out; sent to filter {}", filter.failOutput);
-                                filterNum = filter.failOutput;
-                            }
-                        }
+                    const uint8 partitionIndex = RouteSector(m_cdDeviceConnection, poolBuffer);
+                    poolBuffer = nullptr;
+                    if (partitionIndex != Filter::kDisconnected) {
+                        m_lastCDWritePartition = partitionIndex;
+                        SetInterrupt(kHIRQ_CSCT);
                     }
                 }
 
@@ -1113,6 +1105,11 @@ void CDBlock::ProcessDriveStatePlay() {
                 devlog::debug<grp::play>("Could not read sector - disc image is truncated or corrupted");
                 m_status.statusCode = kStatusCodeError;
             }
+
+            // Return the buffer to the pool if it was not handed over to a partition
+            if (poolBuffer != nullptr) {
+                m_partitionManager.ReleaseBuffer(poolBuffer);
+            }
         }
     }
 
@@ -1127,6 +1124,7 @@ void CDBlock::ProcessDriveStatePlay() {
             }
             m_status.frameAddress = m_playStartPos;
             m_status.repeatCount++;
+            m_readAhead.Prefetch(m_playStartPos, m_playEndPos, m_status.controlADR == 0x41 ? m_readSpeed : 1);
         } else {
             devlog::debug<grp::play>("Playback ended");
             m_playEndPending = true;
@@ -1580,6 +1578,33 @@ void CDBlock::EndTransfer() {
     m_xferCount = 0xFFFFFF;
 }
 
+uint8 CDBlock::RouteSector(uint8 filterNum, Buffer *buffer) {
+    for (int i = 0; i < kNumFilters && filterNum != Filter::kDisconnected; i++) {
+        const Filter &filter = m_filters[filterNum];
+        if (filter.Test(*buffer)) {
+            if (filter.passOutput == Filter::kDisconnected) [[unlikely]] {
+                devlog::trace<grp::play>("Passed filter; output disconnected - discarded");
+                break;
+            }
+            assert(filter.passOutput < m_filters.size());
+            devlog::trace<grp::play>("Passed filter; sent to buffer partition {}", filter.passOutput);
+            m_partitionManager.CommitBuffer(filter.passOutput, buffer);
+            return filter.passOutput;
+        } else {
+            if (filter.failOutput == Filter::kDisconnected) [[unlikely]] {
+                devlog::trace<grp::play>("Filtered out; output disconnected - discarded");
+                break;
+            }
+            assert(filter.failOutput < m_filters.size());
+            devlog::trace<grp::play>("Filtered out; sent to filter {}", filter.failOutput);
+            filterNum = filter.failOutput;
+        }
+    }
+
+    m_partitionManager.ReleaseBuffer(buffer);
+    return Filter::kDisconnected;
+}
+
 bool CDBlock::ConnectCDDevice(uint8 filterNumber) {
     if (filterNumber < m_filters.size()) {
         // Connect CD to specified filter
@@ -1659,8 +1684,8 @@ FORCE_INLINE void CDBlock::ProcessCommand() {
     case 0x62: CmdDeleteSectorData(); break;
     case 0x63: CmdGetThenDeleteSectorData(); break;
     case 0x64: CmdPutSectorData(); break;
-    // case 0x65: CmdCopySectorData(); break;
-    // case 0x66: CmdMoveSectorData(); break;
+    case 0x65: CmdCopySectorData(); break;
+    case 0x66: CmdMoveSectorData(); break;
     case 0x67: CmdGetCopyError(); break;
     case 0x70: CmdChangeDirectory(); break;
     case 0x71: CmdReadDirectory(); break;
@@ -2920,18 +2945,20 @@ void CDBlock::CmdCopySectorData() {
     // sector offset
     // source partition number   <blank>
     // sector number
-    // const uint8 dstPartitionNumber = bit::extract<0, 7>(m_CR[0]);
-    // const uint16 sectorOffset = m_CR[1];
-    // const uint8 srcPartitionNumber = bit::extract<8, 15>(m_CR[2]);
-    // const uint16 sectorNumber = m_CR[3];
-
-    // TODO: setup async sector copy transfer
-    // TODO: report Reject status if not enough buffer space available
-    devlog::info<grp::base>("Copy sector data command is unimplemented");
-    YMIR_DEV_CHECK();
+    const uint8 dstFilterNumber = bit::extract<0, 7>(m_CR[0]);
+    const uint16 sectorOffset = m_CR[1];
+    const uint8 srcPartitionNumber = bit::extract<8, 15>(m_CR[2]);
+    const uint16 sectorNumber = m_CR[3];
+
+    // TODO: copy asynchronously
+    const bool reject = !RelocateSectors(dstFilterNumber, srcPartitionNumber, sectorOffset, sectorNumber, true);
 
     // Output structure: standard CD status data
-    ReportCDStatus();
+    if (reject) [[unlikely]] {
+        ReportCDStatus(kStatusReject);
+    } else {
+        ReportCDStatus();
+    }
 
     SetInterrupt(kHIRQ_CMOK | kHIRQ_ECPY);
 }
@@ -2944,21 +2971,64 @@ void CDBlock::CmdMoveSectorData() {
     // sector offset
     // source partition number   <blank>
     // sector number
-    // const uint8 dstPartitionNumber = bit::extract<0, 7>(m_CR[0]);
-    // const uint16 sectorOffset = m_CR[1];
-    // const uint8 srcPartitionNumber = bit::extract<8, 15>(m_CR[2]);
-    // const uint16 sectorNumber = m_CR[3];
+    const uint8 dstFilterNumber = bit::extract<0, 7>(m_CR[0]);
+    const uint16 sectorOffset = m_CR[1];
+    const uint8 srcPartitionNumber = bit::extract<8, 15>(m_CR[2]);
+    const uint16 sectorNumber = m_CR[3];
 
-    // TODO: setup async sector move transfer
-    devlog::info<grp::base>("Move sector data command is unimplemented");
-    YMIR_DEV_CHECK();
+    // TODO: move asynchronously
+    const bool reject = !RelocateSectors(dstFilterNumber, srcPartitionNumber, sectorOffset, sectorNumber, false);
 
     // Output structure: standard CD status data
-    ReportCDStatus();
+    if (reject) [[unlikely]] {
+        ReportCDStatus(kStatusReject);
+    } else {
+        ReportCDStatus();
+    }
 
     SetInterrupt(kHIRQ_CMOK | kHIRQ_ECPY);
 }
 
+bool CDBlock::RelocateSectors(uint8 dstFilterNumber, uint8 srcPartitionNumber, uint16 sectorOffset,
+                              uint16 sectorNumber, bool copy) {
+    const char *opName = copy ? "Copy" : "Move";
+    if (srcPartitionNumber >= kNumPartitions || dstFilterNumber >= kNumFilters) [[unlikely]] {
+        devlog::trace<grp::base>("{} sector rejected: invalid partition {} or filter {}", opName, srcPartitionNumber,
+                                 dstFilterNumber);
+        return false;
+    }
+
+    const uint32 partSecCount = m_partitionManager.GetBufferCount(srcPartitionNumber);
+    const uint32 startSector = sectorOffset == 0xFFFF ? partSecCount - 1 : sectorOffset;
+    const uint32 endSector = sectorNumber == 0xFFFF ? partSecCount - 1 : startSector + sectorNumber - 1;
+    if (sectorNumber == 0 || partSecCount == 0 || startSector > endSector || endSector >= partSecCount) {
+        devlog::trace<grp::base>("{} sector rejected: invalid range {}..{} in partition {} with {} sectors", opName,
+                                 startSector, endSector, srcPartitionNumber, partSecCount);
+        return false;
+    }
+
+    const uint32 count = endSector - startSector + 1;
+    if (copy && count > m_partitionManager.GetFreeBufferCount()) {
+        devlog::trace<grp::base>("Copy sector rejected: not enough free buffers");
+        return false;
+    }
+
+    for (uint32 i = 0; i < count; i++) {
+        Buffer *buffer;
+        if (copy) {
+            buffer = m_partitionManager.AllocateBuffer();
+            *buffer = *m_partitionManager.GetTail(srcPartitionNumber, startSector + i);
+        } else {
+            // Moving only relinks buffers; the following sectors shift down into the detached sector's offset
+            buffer = m_partitionManager.DetachTail(srcPartitionNumber, startSector);
+        }
+        RouteSector(dstFilterNumber, buffer);
+    }
+    devlog::trace<grp::base>("{} {} sectors from partition {} offset {} to filter {}", opName, count,
+                             srcPartitionNumber, startSector, dstFilterNumber);
+    return true;
+}
+
 void CDBlock::CmdGetCopyError() {
     devlog::trace<grp::cmd>("-> Get copy error");
 
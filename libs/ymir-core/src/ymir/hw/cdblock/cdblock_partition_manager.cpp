@@ -2,8 +2,8 @@
 
 #include "cdblock_devlog.hpp"
 
+#include <algorithm>
 #include <cassert>
-#include <numeric>
 #include <utility>
 
 namespace ymir::cdblock {
@@ -14,6 +14,10 @@ CDBlock::PartitionManager::PartitionManager() {
 
 void CDBlock::PartitionManager::Reset() {
     m_partitions.fill({});
+    for (uint32 i = 0; i < kNumBuffers; i++) {
+        m_next[i] = i + 1 < kNumBuffers ? i + 1 : kNil;
+    }
+    m_freeHead = 0;
     m_freeBuffers = kNumBuffers;
     m_reservedBuffers = 0;
     devlog::trace<grp::part_mgr>("Cleared partitions; free buffers = {}", m_freeBuffers);
@@ -21,8 +25,8 @@ void CDBlock::PartitionManager::Reset() {
 
 uint8 CDBlock::PartitionManager::GetBufferCount(uint8 partitionIndex) const {
     assert(partitionIndex < m_partitions.size());
-    devlog::trace<grp::part_mgr>("Partition {} has {} buffers", partitionIndex, m_partitions[partitionIndex].size());
-    return m_partitions[partitionIndex].size();
+    devlog::trace<grp::part_mgr>("Partition {} has {} buffers", partitionIndex, m_partitions[partitionIndex].count);
+    return m_partitions[partitionIndex].count;
 }
 
 uint32 CDBlock::PartitionManager::GetFreeBufferCount() const {
@@ -51,44 +55,69 @@ void CDBlock::PartitionManager::ReleaseReservedBuffers() {
     m_reservedBuffers = 0;
 }
 
-void CDBlock::PartitionManager::InsertHead(uint8 partitionIndex, const Buffer &buffer) {
+Buffer *CDBlock::PartitionManager::AllocateBuffer() {
+    if (m_freeBuffers <= m_reservedBuffers) {
+        return nullptr;
+    }
+    const uint8 index = PopFree();
+    m_freeBuffers--;
+    return &m_buffers[index];
+}
+
+void CDBlock::PartitionManager::CommitBuffer(uint8 partitionIndex, Buffer *buffer) {
     assert(partitionIndex < m_partitions.size());
-    assert(m_freeBuffers > 0);
     auto &partition = m_partitions[partitionIndex];
-    partition.push_back(buffer);
-    m_freeBuffers--;
+    Append(partition, IndexOf(buffer));
     devlog::trace<grp::part_mgr>("Inserted buffer into partition {} -> {} buffers; free buffers = {}", partitionIndex,
-                                 partition.size(), m_freeBuffers);
+                                 partition.count, m_freeBuffers);
+}
+
+void CDBlock::PartitionManager::ReleaseBuffer(Buffer *buffer) {
+    PushFree(IndexOf(buffer));
+    m_freeBuffers++;
+}
+
+void CDBlock::PartitionManager::InsertHead(uint8 partitionIndex, const Buffer &buffer) {
+    assert(m_freeBuffers > 0);
+    const uint8 index = PopFree();
+    m_freeBuffers--;
+    m_buffers[index] = buffer;
+    CommitBuffer(partitionIndex, &m_buffers[index]);
 }
 
 Buffer *CDBlock::PartitionManager::GetTail(uint8 partitionIndex, uint8 offset) {
-    assert(partitionIndex < m_partitions.size());
-    auto &partition = m_partitions[partitionIndex];
-    if (offset < partition.size()) {
-        return &*(partition.begin() + offset);
-    } else {
-        return nullptr;
-    }
+    const uint8 index = FindIndex(partitionIndex, offset);
+    return index != kNil ? &m_buffers[index] : nullptr;
 }
 
 bool CDBlock::PartitionManager::RemoveTail(uint8 partitionIndex, uint8 offset) {
+    Buffer *buffer = DetachTail(partitionIndex, offset);
+    if (buffer == nullptr) {
+        return false;
+    }
+    ReleaseBuffer(buffer);
+    devlog::trace<grp::part_mgr>("Removed buffer from partition {} -> {} buffers; free buffers = {}", partitionIndex,
+                                 m_partitions[partitionIndex].count, m_freeBuffers);
+    return true;
+}
+
+Buffer *CDBlock::PartitionManager::DetachTail(uint8 partitionIndex, uint8 offset) {
     assert(partitionIndex < m_partitions.size());
     auto &partition = m_partitions[partitionIndex];
-    if (offset < partition.size()) {
-        partition.erase(partition.begin() + offset);
-        m_freeBuffers++;
-        devlog::trace<grp::part_mgr>("Removed buffer from partition {} -> {} buffers; free buffers = {}",
-                                     partitionIndex, partition.size(), m_freeBuffers);
-        return true;
+    if (offset >= partition.count) {
+        return nullptr;
     }
-    return false;
+    return &m_buffers[Unlink(partition, offset)];
 }
 
 uint32 CDBlock::PartitionManager::DeleteSectors(uint8 partitionIndex, uint16 sectorPos, uint16 sectorCount) {
     assert(partitionIndex < m_partitions.size());
 
     auto &partition = m_partitions[partitionIndex];
-    const uint32 totalSectors = partition.size();
+    const uint32 totalSectors = partition.count;
+    if (totalSectors == 0) {
+        return 0;
+    }
     uint16 start, end;
     if (sectorPos == 0xFFFF) {
         start = totalSectors - 1;
@@ -102,38 +131,121 @@ uint32 CDBlock::PartitionManager::DeleteSectors(uint8 partitionIndex, uint16 sec
     }
     start = std::min<uint16>(start, totalSectors - 1);
     end = std::min<uint16>(end, totalSectors - 1);
-    partition.erase(partition.begin() + start, partition.begin() + end + 1);
-    m_freeBuffers += end - start + 1;
-    devlog::trace<grp::part_mgr>("Removed {} buffers from partition {} -> {} buffers; free buffers = {}",
-                                 end - start + 1, partitionIndex, partition.size(), m_freeBuffers);
-    return end - start + 1;
+    if (end < start) {
+        return 0;
+    }
+    const uint32 count = end - start + 1;
+    for (uint32 i = 0; i < count; i++) {
+        PushFree(Unlink(partition, start));
+    }
+    m_freeBuffers += count;
+    devlog::trace<grp::part_mgr>("Removed {} buffers from partition {} -> {} buffers; free buffers = {}", count,
+                                 partitionIndex, partition.count, m_freeBuffers);
+    return count;
 }
 
 void CDBlock::PartitionManager::Clear(uint8 partitionIndex) {
     assert(partitionIndex < m_partitions.size());
     auto &partition = m_partitions[partitionIndex];
-    m_freeBuffers += partition.size();
-    devlog::trace<grp::part_mgr>("Cleared all {} buffers from partition {}; free buffers = {}", partition.size(),
+    m_freeBuffers += partition.count;
+    devlog::trace<grp::part_mgr>("Cleared all {} buffers from partition {}; free buffers = {}", partition.count,
                                  partitionIndex, m_freeBuffers);
-    partition.clear();
+    for (uint8 index = partition.first; index != kNil;) {
+        const uint8 next = m_next[index];
+        PushFree(index);
+        index = next;
+    }
+    partition = {};
 }
 
 uint32 CDBlock::PartitionManager::CalculateSize(uint8 partitionIndex, uint32 start, uint32 end) const {
     assert(partitionIndex < m_partitions.size());
     auto &partition = m_partitions[partitionIndex];
-    start = std::min<uint32>(start, partition.size() - 1);
-    end = std::min<uint32>(end, partition.size() - 1);
-    const uint32 size = std::accumulate(partition.begin() + start, partition.begin() + end + 1, 0u,
-                                        [](const uint32 lhs, const Buffer &rhs) { return lhs + rhs.size; });
+    if (partition.count == 0) {
+        return 0;
+    }
+    start = std::min<uint32>(start, partition.count - 1);
+    end = std::min<uint32>(end, partition.count - 1);
+    uint32 size = 0;
+    uint8 index = FindIndex(partitionIndex, start);
+    for (uint32 i = start; i <= end && index != kNil; i++) {
+        size += m_buffers[index].size;
+        index = m_next[index];
+    }
     devlog::trace<grp::part_mgr>("Calculated partition {} size from {} to {} = {} bytes", partitionIndex, start, end,
                                  size);
     return size;
 }
 
+uint8 CDBlock::PartitionManager::IndexOf(const Buffer *buffer) const {
+    assert(buffer >= m_buffers.data() && buffer < m_buffers.data() + m_buffers.size());
+    return static_cast<uint8>(buffer - m_buffers.data());
+}
+
+uint8 CDBlock::PartitionManager::FindIndex(uint8 partitionIndex, uint32 offset) const {
+    assert(partitionIndex < m_partitions.size());
+    const auto &partition = m_partitions[partitionIndex];
+    if (offset >= partition.count) {
+        return kNil;
+    }
+    uint8 index = partition.first;
+    for (uint32 i = 0; i < offset; i++) {
+        index = m_next[index];
+    }
+    return index;
+}
+
+uint8 CDBlock::PartitionManager::PopFree() {
+    const uint8 index = m_freeHead;
+    assert(index != kNil);
+    m_freeHead = m_next[index];
+    m_next[index] = kNil;
+    return index;
+}
+
+void CDBlock::PartitionManager::PushFree(uint8 index) {
+    m_next[index] = m_freeHead;
+    m_freeHead = index;
+}
+
+void CDBlock::PartitionManager::Append(Partition &partition, uint8 index) {
+    m_next[index] = kNil;
+    if (partition.last == kNil) {
+        partition.first = index;
+    } else {
+        m_next[partition.last] = index;
+    }
+    partition.last = index;
+    partition.count++;
+}
+
+uint8 CDBlock::PartitionManager::Unlink(Partition &partition, uint32 offset) {
+    assert(offset < partition.count);
+    uint8 prev = kNil;
+    uint8 index = partition.first;
+    for (uint32 i = 0; i < offset; i++) {
+        prev = index;
+        index = m_next[index];
+    }
+    const uint8 next = m_next[index];
+    if (prev == kNil) {
+        partition.first = next;
+    } else {
+        m_next[prev] = next;
+    }
+    if (next == kNil) {
+        partition.last = prev;
+    }
+    partition.count--;
+    m_next[index] = kNil;
+    return index;
+}
+
 void CDBlock::PartitionManager::SaveState(state::CDBlockState &state) const {
     size_t bufferIndex = 0;
     for (size_t i = 0; i < m_partitions.size(); i++) {
-        for (const auto &buffer : m_partitions[i]) {
+        for (uint8 index = m_partitions[i].first; index != kNil; index = m_next[index]) {
+            const Buffer &buffer = m_buffers[index];
             state.buffers[bufferIndex].data = buffer.data;
             state.buffers[bufferIndex].size = buffer.size;
             state.buffers[bufferIndex].frameAddress = buffer.frameAddress;
@@ -164,14 +276,12 @@ bool CDBlock::PartitionManager::ValidateState(const state::CDBlockState &state)
 }
 
 void CDBlock::PartitionManager::LoadState(const state::CDBlockState &state) {
-    for (auto &partition : m_partitions) {
-        partition.clear();
-    }
-    m_freeBuffers = kNumBuffers;
+    Reset();
 
     for (const auto &buffer : state.buffers) {
-        if (buffer.partitionIndex < kNumPartitions) {
-            auto &partBuffer = m_partitions[buffer.partitionIndex].emplace_back();
+        if (buffer.partitionIndex < kNumPartitions && m_freeHead != kNil) {
+            const uint8 index = PopFree();
+            auto &partBuffer = m_buffers[index];
             partBuffer.data = buffer.data;
             partBuffer.size = buffer.size;
             partBuffer.frameAddress = buffer.frameAddress;
@@ -179,6 +289,7 @@ void CDBlock::PartitionManager::LoadState(const state::CDBlockState &state) {
             partBuffer.subheader.chanNum = buffer.chanNum;
             partBuffer.subheader.submode = buffer.submode;
             partBuffer.subheader.codingInfo = buffer.codingInfo;
+            Append(m_partitions[buffer.partitionIndex], index);
             --m_freeBuffers;
         }
     }
@@ -113,6 +113,7 @@ void YGR::MapMemory(sys::SH2Bus &mainBus) {
                 }
 
                 auto &ygr = cast(ctx);
+                ygr.m_cbHostAccess();
                 if (!ygr.m_regs.TRCTL.TE) {
                     // No need to stall if transfer is disabled
                     return false;
@@ -382,6 +383,9 @@ FORCE_INLINE void YGR::CDBPokeByte(uint32 address, uint8 value) {
 
 template <bool peek>
 FORCE_INLINE uint16 YGR::HostReadWord(uint32 address) const {
+    if constexpr (!peek) {
+        m_cbHostAccess();
+    }
     address &= 0x3C;
     switch (address) {
     case 0x00:
@@ -430,6 +434,7 @@ FORCE_INLINE uint16 YGR::HostReadWord(uint32 address) const {
 
 template <bool doubleFIFOPull>
 uint32 YGR::HostReadLong(uint32 address) const {
+    m_cbHostAccess();
     address &= 0x3C;
     switch (address) {
     case 0x00:
@@ -484,6 +489,9 @@ uint32 YGR::HostReadLong(uint32 address) const {
 
 template <bool poke>
 FORCE_INLINE void YGR::HostWriteWord(uint32 address, uint16 value) {
+    if constexpr (!poke) {
+        m_cbHostAccess();
+    }
     address &= 0x3C;
     switch (address) {
     case 0x00:
@@ -6,7 +6,7 @@
 
 namespace ymir::m68k {
 
-DecodeTable BuildDecodeTable() {
+static constexpr DecodeTable BuildDecodeTable() {
     DecodeTable table{};
     table.opcodeTypes.fill(OpcodeType::Illegal);
 
@@ -576,6 +576,6 @@ DecodeTable BuildDecodeTable() {
     return table;
 }
 
-DecodeTable g_decodeTable = BuildDecodeTable();
+constinit const DecodeTable g_decodeTable = BuildDecodeTable();
 
 } // namespace ymir::m68k
@@ -7,7 +7,8 @@
 
 namespace ymir::m68k {
 
-DisassemblyTable::DisassemblyTable() {
+constexpr DisassemblyTable::DisassemblyTable()
+    : infos{} {
     for (uint32 opcode = 0; opcode < 0x10000; opcode++) {
         DisassemblyInfo &info = this->infos[opcode];
 
@@ -991,6 +992,6 @@ DisassembledInstruction Disassemble(std::function<uint16()> fetcher) {
     return disasm;
 }
 
-DisassemblyTable DisassemblyTable::s_instance{};
+constinit const DisassemblyTable DisassemblyTable::s_instance{};
 
 } // namespace ymir::m68k
@@ -182,12 +182,8 @@ void SCSP::UpdateClockRatios(const sys::ClockRatios &clockRatios) {
 }
 
 void SCSP::SetDebugTracing(bool enable) {
-    if (m_debugTracing != enable) {
-        m_debugTracing = enable;
-        if (enable) {
-            UpdateStepFunction();
-        }
-    }
+    m_debugTracing = enable;
+    UpdateDebugInstrumentation();
 }
 
 uint32 SCSP::ReceiveCDDA(std::span<uint8, 2352> data) {
@@ -605,6 +601,14 @@ void SCSP::UpdateStepFunction() {
     }
 }
 
+void SCSP::UpdateDebugInstrumentation() {
+    const bool instrumented = m_debugTracing && m_tracer != nullptr;
+    if (m_debugInstrumented != instrumented) {
+        m_debugInstrumented = instrumented;
+        UpdateStepFunction();
+    }
+}
+
 void SCSP::EnableThreading(bool enable) {
     if (enable) {
         // TODO: implement
@@ -748,10 +752,22 @@ FORCE_INLINE void SCSP::RunM68K(uint64 cycles) {
     if (m_m68kEnabled) {
         cycles <<= m_m68kClockShift;
         uint64 cy = m_m68kSpilloverCycles;
+        [[maybe_unused]] const bool perf = ::ymir::debug::kPerfStatsEnabled && m_perf != nullptr;
+        [[maybe_unused]] uint64 instructions = 0;
         while (cy < cycles) {
             cy += m_m68k.Step();
+            if constexpr (::ymir::debug::kPerfStatsEnabled) {
+                if (perf) [[unlikely]] {
+                    ++instructions;
+                }
+            }
         }
         m_m68kSpilloverCycles = cy - cycles;
+        if constexpr (::ymir::debug::kPerfStatsEnabled) {
+            if (m_perf != nullptr) [[unlikely]] {
+                m_perf->m68kInstructions.Add(instructions);
+            }
+        }
     }
 }
 
@@ -888,9 +904,26 @@ FORCE_INLINE void SCSP::ProcessSlots(uint32 i) {
         }
 
         // Write to output and reset
-        m_cbOutputSample(m_out[0], m_out[1]);
+        if (m_sampleRing != nullptr) {
+            m_sampleRing->Push(m_out[0], m_out[1]);
+            if (m_captureRing != nullptr) [[unlikely]] {
+                m_captureRing->Push(m_out[0], m_out[1]);
+            }
+            if (++m_sampleBlockCount >= m_sampleBlockSize) {
+                m_sampleBlockCount = 0;
+                m_cbOutputSampleBlock(m_sampleRing->Publish());
+            }
+        } else {
+            m_cbOutputSample(m_out[0], m_out[1]);
+        }
         m_out.fill(0);
 
+        if constexpr (::ymir::debug::kPerfStatsEnabled) {
+            if (m_perf != nullptr) [[unlikely]] {
+                m_perf->scspSamples.Add(1);
+            }
+        }
+
         // Copy CDDA data to DSP EXTS (0=left, 1=right)
         if (m_cddaReady && m_cddaReadPos != m_cddaWritePos) {
             m_dsp.audioInOut[0] = util::ReadLE<uint16>(&m_cddaBuffer[m_cddaReadPos + 0]);
@@ -90,23 +90,7 @@ void SCU::MapMemory(sys::SH2Bus &bus) {
     static constexpr auto cast = [](void *ctx) -> SCU & { return *static_cast<SCU *>(ctx); };
 
     // A-Bus CS0 and CS1 - Cartridge
-    bus.MapNormal(
-        0x200'0000, 0x4FF'FFFF, this,
-        [](uint32 address, void *ctx) -> uint8 { return cast(ctx).ReadCartridge<uint8, false>(address); },
-        [](uint32 address, void *ctx) -> uint16 { return cast(ctx).ReadCartridge<uint16, false>(address); },
-        [](uint32 address, void *ctx) -> uint32 { return cast(ctx).ReadCartridge<uint32, false>(address); },
-        [](uint32 address, uint8 value, void *ctx) { cast(ctx).WriteCartridge<uint8, false>(address, value); },
-        [](uint32 address, uint16 value, void *ctx) { cast(ctx).WriteCartridge<uint16, false>(address, value); },
-        [](uint32 address, uint32 value, void *ctx) { cast(ctx).WriteCartridge<uint32, false>(address, value); });
-
-    bus.MapSideEffectFree(
-        0x200'0000, 0x4FF'FFFF, this,
-        [](uint32 address, void *ctx) -> uint8 { return cast(ctx).ReadCartridge<uint8, true>(address); },
-        [](uint32 address, void *ctx) -> uint16 { return cast(ctx).ReadCartridge<uint16, true>(address); },
-        [](uint32 address, void *ctx) -> uint32 { return cast(ctx).ReadCartridge<uint32, true>(address); },
-        [](uint32 address, uint8 value, void *ctx) { cast(ctx).WriteCartridge<uint8, true>(address, value); },
-        [](uint32 address, uint16 value, void *ctx) { cast(ctx).WriteCartridge<uint16, true>(address, value); },
-        [](uint32 address, uint32 value, void *ctx) { cast(ctx).WriteCartridge<uint32, true>(address, value); });
+    MapCartridgeMemory(bus);
 
     // A-Bus CS2 - 0x580'0000..0x58F'FFFF
     // CD block maps itself here
@@ -123,9 +107,21 @@ void SCU::MapMemory(sys::SH2Bus &bus) {
         [](uint32 address, void *ctx) -> uint16 { return cast(ctx).ReadReg<uint16, false>(address & 0xFF); },
         [](uint32 address, void *ctx) -> uint32 { return cast(ctx).ReadReg<uint32, false>(address & 0xFF); },
 
-        [](uint32 address, uint8 value, void *ctx) { cast(ctx).WriteRegByte<false>(address & 0xFF, value); },
-        [](uint32 address, uint16 value, void *ctx) { cast(ctx).WriteRegWord<false>(address & 0xFF, value); },
-        [](uint32 address, uint32 value, void *ctx) { cast(ctx).WriteRegLong<false>(address & 0xFF, value); });
+        [](uint32 address, uint8 value, void *ctx) {
+            ++cast(ctx).m_regWriteCount;
+            cast(ctx).m_cbRegisterWrite();
+            cast(ctx).WriteRegByte<false>(address & 0xFF, value);
+        },
+        [](uint32 address, uint16 value, void *ctx) {
+            ++cast(ctx).m_regWriteCount;
+            cast(ctx).m_cbRegisterWrite();
+            cast(ctx).WriteRegWord<false>(address & 0xFF, value);
+        },
+        [](uint32 address, uint32 value, void *ctx) {
+            ++cast(ctx).m_regWriteCount;
+            cast(ctx).m_cbRegisterWrite();
+            cast(ctx).WriteRegLong<false>(address & 0xFF, value);
+        });
 
     bus.MapSideEffectFree(
         0x5FE'0000, 0x5FE'FFFF, this,
@@ -140,6 +136,37 @@ void SCU::MapMemory(sys::SH2Bus &bus) {
     // TODO: 0x5FF'0000..0x5FF'FFFF - Unknown registers
 }
 
+void SCU::MapCartridgeHandlers(sys::SH2Bus &bus, uint32 start, uint32 end) {
+    static constexpr auto cast = [](void *ctx) -> SCU & { return *static_cast<SCU *>(ctx); };
+
+    bus.MapNormal(
+        start, end, this,
+        [](uint32 address, void *ctx) -> uint8 { return cast(ctx).ReadCartridge<uint8, false>(address); },
+        [](uint32 address, void *ctx) -> uint16 { return cast(ctx).ReadCartridge<uint16, false>(address); },
+        [](uint32 address, void *ctx) -> uint32 { return cast(ctx).ReadCartridge<uint32, false>(address); },
+        [](uint32 address, uint8 value, void *ctx) { cast(ctx).WriteCartridge<uint8, false>(address, value); },
+        [](uint32 address, uint16 value, void *ctx) { cast(ctx).WriteCartridge<uint16, false>(address, value); },
+        [](uint32 address, uint32 value, void *ctx) { cast(ctx).WriteCartridge<uint32, false>(address, value); });
+
+    bus.MapSideEffectFree(
+        start, end, this,
+        [](uint32 address, void *ctx) -> uint8 { return cast(ctx).ReadCartridge<uint8, true>(address); },
+        [](uint32 address, void *ctx) -> uint16 { return cast(ctx).ReadCartridge<uint16, true>(address); },
+        [](uint32 address, void *ctx) -> uint32 { return cast(ctx).ReadCartridge<uint32, true>(address); },
+        [](uint32 address, uint8 value, void *ctx) { cast(ctx).WriteCartridge<uint8, true>(address, value); },
+        [](uint32 address, uint16 value, void *ctx) { cast(ctx).WriteCartridge<uint16, true>(address, value); },
+        [](uint32 address, uint32 value, void *ctx) { cast(ctx).WriteCartridge<uint32, true>(address, value); });
+}
+
+void SCU::MapCartridgeMemory(sys::SH2Bus &bus) {
+    MapCartridgeHandlers(bus, 0x200'0000, 0x4FF'FFFF);
+    m_cartSlot.MapMemory(bus);
+
+    // Pages containing special registers must always go through the handlers
+    MapCartridgeHandlers(bus, 0x210'0000, 0x210'FFFF); // mednafen debug port at 0x210'0001
+    MapCartridgeHandlers(bus, 0x4FF'0000, 0x4FF'FFFF); // cartridge ID at 0x4FF'FFFE..0x4FF'FFFF
+}
+
 template <bool debug>
 void SCU::Advance(uint64 cycles) {
     // FIXME: SCU DMA transfers should stall SH-2s and other components.
@@ -474,25 +501,25 @@ void SCU::LoadState(const state::SCUState &state) {
     switch (state.cartType) {
     case state::SCUState::CartType::DRAM8Mbit: //
     {
-        auto *cart = m_cartSlot.InsertCartridge<cart::DRAM8MbitCartridge>();
+        auto *cart = InsertCartridge<cart::DRAM8MbitCartridge>();
         cart->LoadRAM(std::span<const uint8, 1_MiB>(state.cartData.begin(), 1_MiB));
         break;
     }
     case state::SCUState::CartType::DRAM32Mbit: //
     {
-        auto *cart = m_cartSlot.InsertCartridge<cart::DRAM32MbitCartridge>();
+        auto *cart = InsertCartridge<cart::DRAM32MbitCartridge>();
         cart->LoadRAM(std::span<const uint8, 4_MiB>(state.cartData.begin(), 4_MiB));
         break;
     }
     case state::SCUState::CartType::DRAM48Mbit: //
     {
-        auto *cart = m_cartSlot.InsertCartridge<cart::DRAM48MbitCartridge>();
+        auto *cart = InsertCartridge<cart::DRAM48MbitCartridge>();
         cart->LoadRAM(std::span<const uint8, 6_MiB>(state.cartData.begin(), 6_MiB));
         break;
     }
     case state::SCUState::CartType::ROM: //
     {
-        auto *cart = m_cartSlot.InsertCartridge<cart::ROMCartridge>();
+        auto *cart = InsertCartridge<cart::ROMCartridge>();
         cart->LoadROM(std::span<const uint8, 4_MiB>(state.cartData.begin(), 4_MiB));
         break;
     }
@@ -674,6 +701,11 @@ void SCU::DMAReadIndirectTransfer(uint8 level) {
 
     TraceDMA(m_tracer, level, ch.currSrcAddr, ch.currDstAddr, ch.currXferCount, ch.currSrcAddrInc, ch.currDstAddrInc,
              true, baseIndirectSrc);
+    if constexpr (debug::kPerfStatsEnabled) {
+        if (m_perf != nullptr) [[unlikely]] {
+            m_perf->scuDMABytes.Add(ch.currXferCount);
+        }
+    }
 }
 
 void SCU::RunDMA(uint64 cycles) {
@@ -832,6 +864,17 @@ void SCU::RunDMA(uint64 cycles) {
 
             // 32-bit transfers -- the bulk of the DMA operation
             while (ch.currXferCount >= 4) {
+                // Fast path for transfers between plain memory regions.
+                // Once the first longword is written, each iteration writes to the next longword.
+                if (xfer.bufPos == 4 && currDstOffset == 4 && ch.currSrcAddrInc == 4 && ch.currDstAddrInc == 4) {
+                    const uint32 count = DMATransferBulk(level, (currDstAddr + 4) & 0x7FF'FFFF);
+                    if (count > 0) {
+                        currDstAddr += count;
+                        currDstAddr &= 0x7FF'FFFF;
+                        continue;
+                    }
+                }
+
                 incDst();
                 const uint32 addr = (currDstAddr + currDstOffset) & ~3u;
                 if (checkReadStall(sizeof(uint32)) || checkWriteStall(addr, sizeof(uint32))) {
@@ -949,6 +992,23 @@ void SCU::RunDMA(uint64 cycles) {
             // 32-bit -> 2x 16-bit transfer -- the bulk of the DMA operation
             // B-Bus is 16-bit but the SCU seems to attempt to handle this as a 32-bit write anyway
             while (ch.currXferCount >= 4) {
+                // Fast path for transfers into plain memory regions or VDP VRAM.
+                // With +2 increments, once the first longword is written, each iteration writes the next longword
+                // starting two bytes past the current write address.
+                if (xfer.bufPos == 4 && currDstOffset == 4 && ch.currSrcAddrInc == 4 && ch.currDstAddrInc == 2) {
+                    const uint32 count = DMATransferBulk(level, (currDstAddr + 2) & 0x7FF'FFFF);
+                    if (count > 0) {
+                        currDstAddr += count;
+                        currDstAddr &= 0x7FF'FFFF;
+                        if (ch.currXferCount == 0) {
+                            // Same backwards step as below
+                            currDstAddr -= ch.currDstAddrInc;
+                            currDstAddr &= 0x7FF'FFFF;
+                        }
+                        continue;
+                    }
+                }
+
                 incDst();
 
                 const uint32 addr1 = (currDstAddr | currDstOffset) & ~1u;
@@ -1073,6 +1133,36 @@ void SCU::RunDMA(uint64 cycles) {
     }
 }
 
+uint32 SCU::DMATransferBulk(uint8 level, uint32 dstAddr) {
+    auto &ch = m_dmaChannels[level];
+    auto &xfer = ch.xfer;
+
+    uint32 total = 0;
+    while (ch.currXferCount >= 4) {
+        const uint32 srcAddr = ((ch.currSrcAddr & ~3u) + 4u) & 0x7FF'FFFF;
+        const std::span<const uint8> src = m_bus.GetArrayBlock(srcAddr);
+        const uint32 dstSize = m_bus.GetWriteBlockSize(dstAddr);
+        const uint32 size = std::min<uint32>({ch.currXferCount, src.size(), dstSize}) & ~3u;
+        if (size == 0) {
+            break;
+        }
+
+        m_bus.WriteBlock(dstAddr, src.first(size));
+        xfer.buf = util::ReadBE<uint32>(&src[size - 4]);
+
+        devlog::trace<grp::dma>("SCU DMA{}: Bulk transfer from {:08X} to {:08X}, {:X} bytes", level, srcAddr, dstAddr,
+                                size);
+
+        ch.currSrcAddr += size;
+        ch.currSrcAddr &= 0x7FF'FFFF;
+        ch.currXferCount -= size;
+        dstAddr += size;
+        dstAddr &= 0x7FF'FFFF;
+        total += size;
+    }
+    return total;
+}
+
 void SCU::RecalcDMAChannel() {
     m_activeDMAChannelLevel = m_dmaChannels.size();
 
@@ -1130,6 +1220,11 @@ void SCU::RecalcDMAChannel() {
             }
             TraceDMA(m_tracer, level, ch.currSrcAddr, ch.currDstAddr, ch.currXferCount, ch.currSrcAddrInc,
                      ch.currDstAddrInc, false, 0);
+            if constexpr (debug::kPerfStatsEnabled) {
+                if (m_perf != nullptr) [[unlikely]] {
+                    m_perf->scuDMABytes.Add(ch.currXferCount);
+                }
+            }
         }
         m_activeDMAChannelLevel = level;
         break;
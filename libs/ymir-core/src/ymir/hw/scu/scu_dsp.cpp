@@ -9,13 +9,10 @@ namespace ymir::scu {
 // -----------------------------------------------------------------------------
 // Debugger
 
-template <bool debug>
 FORCE_INLINE static void TraceDSPDMA(debug::ISCUTracer *tracer, bool toD0, uint32 addrD0, uint8 addrDSP, uint8 count,
                                      uint8 addrInc, bool hold) {
-    if constexpr (debug) {
-        if (tracer) {
-            return tracer->DSPDMA(toD0, addrD0, addrDSP, count, addrInc, hold);
-        }
+    if (tracer) {
+        return tracer->DSPDMA(toD0, addrD0, addrDSP, count, addrInc, hold);
     }
 }
 
@@ -580,7 +577,7 @@ FORCE_INLINE void SCUDSP::Cmd_Special_DMA(DSPInstr command) {
         dmaAddrD0 = dmaWriteAddr;
         devlog::trace<grp::dsp>("Running DSP DMA transfer: DSP -> {:08X} (+{:X}), {} longwords", dmaAddrD0, dmaAddrInc,
                                 dmaCount);
-        TraceDSPDMA<debug>(m_tracer, dmaToD0, dmaAddrD0, dmaSrc, dmaCount, dmaAddrInc, dmaHold);
+        TraceDSPDMA(m_tracer, dmaToD0, dmaAddrD0, dmaSrc, dmaCount, dmaAddrInc, dmaHold);
     } else {
         // DMA D0,[RAM],SImm
         // DMA D0,[RAM],[s]
@@ -591,7 +588,7 @@ FORCE_INLINE void SCUDSP::Cmd_Special_DMA(DSPInstr command) {
         dmaAddrD0 = dmaReadAddr;
         devlog::trace<grp::dsp>("Running DSP DMA transfer: {:08X} -> DSP (+{:X}), {} longwords", dmaAddrD0, dmaAddrInc,
                                 dmaCount);
-        TraceDSPDMA<debug>(m_tracer, dmaToD0, dmaAddrD0, dmaDst, dmaCount, dmaAddrInc, dmaHold);
+        TraceDSPDMA(m_tracer, dmaToD0, dmaAddrD0, dmaDst, dmaCount, dmaAddrInc, dmaHold);
     }
 
     devlog::trace<grp::dsp>("DSP DMA command: {:04X} @ {:02X}", command.u32, PC);
@@ -16,6 +16,14 @@
 
 namespace ymir::sh1 {
 
+namespace static_config {
+
+    // Run code from the on-chip ROM through the pre-decoded block cache instead of fetching and decoding every
+    // instruction.
+    static constexpr bool rom_block_cache = true;
+
+} // namespace static_config
+
 // -----------------------------------------------------------------------------
 // Dev log groups
 
@@ -80,6 +88,7 @@ SH1::SH1(sys::SH1Bus &bus)
 
     nullprog::CopyNullProgram(m_rom);
     m_romHash = CalcHash128(m_rom.data(), m_rom.size(), kROMHashSeed);
+    UpdateROMCache(0, kROMSize);
 
     Reset(true);
 }
@@ -146,6 +155,64 @@ void SH1::Reset(bool hard, bool watchdogInitiated) {
 void SH1::LoadROM(std::span<uint8, 64 * 1024> rom) {
     std::copy(rom.begin(), rom.end(), m_rom.begin());
     m_romHash = CalcHash128(m_rom.data(), m_rom.size(), kROMHashSeed);
+    UpdateROMCache(0, kROMSize);
+}
+
+void SH1::UpdateROMCache(uint32 offset, uint32 size) {
+    // Instructions that end a basic block.
+    // Delayed branches also include their delay slot in the block.
+    auto isBlockEnd = [](OpcodeType opcode) {
+        switch (opcode) {
+        case OpcodeType::BF:
+        case OpcodeType::BT:
+        case OpcodeType::TRAPA:
+        case OpcodeType::SLEEP:
+        case OpcodeType::Illegal: return true;
+        default: return false;
+        }
+    };
+    auto isDelayedBranch = [](OpcodeType opcode) {
+        switch (opcode) {
+        case OpcodeType::BFS:
+        case OpcodeType::BTS:
+        case OpcodeType::BRA:
+        case OpcodeType::BSR:
+        case OpcodeType::JMP:
+        case OpcodeType::JSR:
+        case OpcodeType::RTE:
+        case OpcodeType::RTS: return true;
+        default: return false;
+        }
+    };
+
+    const uint32 first = offset / sizeof(uint16);
+    const uint32 last = (offset + size - 1) / sizeof(uint16);
+
+    // Walk backwards so that each entry can extend the block length of the following instruction
+    for (uint32 i = last + 1; i-- > 0;) {
+        CachedInstruction &cached = m_romCache[i];
+        if (i >= first) {
+            const uint16 instr = util::ReadBE<uint16>(&m_rom[i * sizeof(uint16)]);
+            cached.opcodes[0] = DecodeTable::s_instance.GetOpcode(false, instr);
+            cached.opcodes[1] = DecodeTable::s_instance.GetOpcode(true, instr);
+            cached.args = DecodeTable::s_instance.args[instr];
+        }
+
+        if (isBlockEnd(cached.opcodes[0]) || i + 1 == m_romCache.size()) {
+            // The delay slot of a branch at the very end of the ROM falls outside of the cache
+            cached.blockLength = 1;
+        } else if (isDelayedBranch(cached.opcodes[0])) {
+            cached.blockLength = 2;
+        } else {
+            cached.blockLength = m_romCache[i + 1].blockLength + 1;
+            continue;
+        }
+
+        // Blocks that end before the updated range are not affected by it
+        if (i < first) {
+            break;
+        }
+    }
 }
 
 uint64 SH1::Advance(uint64 cycles, uint64 spilloverCycles) {
@@ -181,7 +248,13 @@ uint64 SH1::Advance(uint64 cycles, uint64 spilloverCycles) {
         // TODO: choose between interpreter (cached or uncached) and JIT recompiler
         uint64 loopCycles = 0;
         do {
-            const uint64 instrCycles = InterpretNext();
+            uint64 instrCycles;
+            const uint32 partition = (PC >> 24u) & 0xF;
+            if (static_config::rom_block_cache && !m_intrPending && (partition == 0x0 || partition == 0x8)) {
+                instrCycles = ExecuteROMBlock(std::min<uint64>(cycles - m_cyclesExecuted, 16 - loopCycles));
+            } else {
+                instrCycles = InterpretNext();
+            }
             loopCycles += instrCycles;
             m_cyclesExecuted += instrCycles;
         } while (m_cyclesExecuted < cycles && loopCycles < 16);
@@ -597,6 +670,7 @@ void SH1::MemWrite(uint32 address, T value) {
     case 0x0: [[fallthrough]];
     case 0x8: // on-chip ROM
         util::WriteBE<T>(&m_rom[address & 0xFFFF], value);
+        UpdateROMCache(address & 0xFFFF, sizeof(T));
         break;
     case 0x5: // on-chip modules
         OnChipRegWrite<T, poke>(address & 0x1FF, value);
@@ -2539,9 +2613,28 @@ FORCE_INLINE uint64 SH1::InterpretNext() {
 
     const uint16 instr = FetchInstruction(PC);
 
-    const OpcodeType opcode = DecodeTable::s_instance.opcodes[m_delaySlot][instr];
+    const OpcodeType opcode = DecodeTable::s_instance.GetOpcode(m_delaySlot, instr);
     const DecodedArgs &args = DecodeTable::s_instance.args[instr];
 
+    return ExecuteInstruction(opcode, args);
+}
+
+FORCE_INLINE uint64 SH1::ExecuteROMBlock(uint64 maxCycles) {
+    const CachedInstruction *cached = &m_romCache[(PC & 0xFFFF) >> 1u];
+    const CachedInstruction *const end = cached + cached->blockLength;
+    uint32 nextPC = PC;
+    uint64 cycles = 0;
+    do {
+        cycles += ExecuteInstruction(cached->opcodes[m_delaySlot], cached->args);
+        ++cached;
+        nextPC += 2;
+
+        // Exceptions, SLEEP and branches taken out of a delay slot entered from outside the block move PC elsewhere
+    } while (cached != end && cycles < maxCycles && PC == nextPC && !m_intrPending);
+    return cycles;
+}
+
+FORCE_INLINE uint64 SH1::ExecuteInstruction(OpcodeType opcode, const DecodedArgs &args) {
     // TODO: check program execution
     switch (opcode) {
     case OpcodeType::NOP: return NOP<false>();
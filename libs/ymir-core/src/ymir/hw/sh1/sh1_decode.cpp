@@ -4,9 +4,12 @@
 
 namespace ymir::sh1 {
 
-DecodeTable::DecodeTable() {
-    opcodes[0].fill(OpcodeType::Illegal);
-    opcodes[1].fill(OpcodeType::Illegal);
+constexpr DecodeTable::DecodeTable()
+    : opcodes{}
+    , args{}
+    , mem{} {
+    opcodes[0].fill(static_cast<uint8>(OpcodeType::Illegal));
+    opcodes[1].fill(static_cast<uint8>(static_cast<uint16>(OpcodeType::Illegal) - kDelayBase));
 
     for (uint32 instr = 0; instr < 0x10000; instr++) {
         auto &regularOpcode = opcodes[0][instr];
@@ -15,13 +18,13 @@ DecodeTable::DecodeTable() {
         auto &mem = DecodeTable::mem[instr];
 
         auto setOpcode = [&](OpcodeType type) {
-            static constexpr uint16 delayOffset = static_cast<uint16>(OpcodeType::Delay_NOP);
-            regularOpcode = type;
-            delayOpcode = static_cast<OpcodeType>(static_cast<uint16>(type) + delayOffset);
+            constexpr uint16 delayOffset = static_cast<uint16>(OpcodeType::Delay_NOP);
+            regularOpcode = static_cast<uint8>(type);
+            delayOpcode = static_cast<uint8>(static_cast<uint16>(type) + delayOffset - kDelayBase);
         };
         auto setNonDelayOpcode = [&](OpcodeType type) {
-            regularOpcode = type;
-            delayOpcode = OpcodeType::IllegalSlot;
+            regularOpcode = static_cast<uint8>(type);
+            delayOpcode = static_cast<uint8>(static_cast<uint16>(OpcodeType::IllegalSlot) - kDelayBase);
         };
 
         // ---------------------------------------
@@ -441,6 +444,6 @@ DecodeTable::DecodeTable() {
     }
 }
 
-DecodeTable DecodeTable::s_instance{};
+constinit const DecodeTable DecodeTable::s_instance{};
 
 } // namespace ymir::sh1
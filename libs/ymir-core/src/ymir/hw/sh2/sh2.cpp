@@ -11,6 +11,7 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <utility>
 
 namespace ymir::sh2 {
 
@@ -121,62 +122,44 @@ FORCE_INLINE static void TraceExecuteInstruction(debug::ISH2Tracer *tracer, uint
     }
 }
 
-template <bool debug>
 FORCE_INLINE static void TraceInterrupt(debug::ISH2Tracer *tracer, uint8 vecNum, uint8 level,
                                         sh2::InterruptSource source, uint32 pc) {
-    if constexpr (debug) {
-        if (tracer) {
-            return tracer->Interrupt(vecNum, level, source, pc);
-        }
+    if (tracer) {
+        return tracer->Interrupt(vecNum, level, source, pc);
     }
 }
 
-template <bool debug>
 FORCE_INLINE static void TraceException(debug::ISH2Tracer *tracer, uint8 vecNum, uint32 pc, uint32 sr) {
-    if constexpr (debug) {
-        if (tracer) {
-            return tracer->Exception(vecNum, pc, sr);
-        }
+    if (tracer) {
+        return tracer->Exception(vecNum, pc, sr);
     }
 }
 
-template <bool debug>
 FORCE_INLINE static void TraceBegin32x32Division(debug::ISH2Tracer *tracer, sint32 dividend, sint32 divisor,
                                                  bool overflowIntrEnable) {
-    if constexpr (debug) {
-        if (tracer) {
-            return tracer->Begin32x32Division(dividend, divisor, overflowIntrEnable);
-        }
+    if (tracer) {
+        return tracer->Begin32x32Division(dividend, divisor, overflowIntrEnable);
     }
 }
 
-template <bool debug>
 FORCE_INLINE static void TraceBegin64x32Division(debug::ISH2Tracer *tracer, sint64 dividend, sint32 divisor,
                                                  bool overflowIntrEnable) {
-    if constexpr (debug) {
-        if (tracer) {
-            return tracer->Begin64x32Division(dividend, divisor, overflowIntrEnable);
-        }
+    if (tracer) {
+        return tracer->Begin64x32Division(dividend, divisor, overflowIntrEnable);
     }
 }
 
-template <bool debug>
 FORCE_INLINE static void TraceEndDivision(debug::ISH2Tracer *tracer, sint32 quotient, sint32 remainder, bool overflow) {
-    if constexpr (debug) {
-        if (tracer) {
-            return tracer->EndDivision(quotient, remainder, overflow);
-        }
+    if (tracer) {
+        return tracer->EndDivision(quotient, remainder, overflow);
     }
 }
 
-template <bool debug>
 FORCE_INLINE static void TraceDMAXferBegin(debug::ISH2Tracer *tracer, uint32 channel, uint32 srcAddress,
                                            uint32 dstAddress, uint32 count, uint32 unitSize, sint32 srcInc,
                                            sint32 dstInc) {
-    if constexpr (debug) {
-        if (tracer) {
-            return tracer->DMAXferBegin(channel, srcAddress, dstAddress, count, unitSize, srcInc, dstInc);
-        }
+    if (tracer) {
+        return tracer->DMAXferBegin(channel, srcAddress, dstAddress, count, unitSize, srcInc, dstInc);
     }
 }
 
@@ -190,12 +173,9 @@ FORCE_INLINE static void TraceDMAXferData(debug::ISH2Tracer *tracer, uint32 chan
     }
 }
 
-template <bool debug>
 FORCE_INLINE static void TraceDMAXferEnd(debug::ISH2Tracer *tracer, uint32 channel, bool irqRaised) {
-    if constexpr (debug) {
-        if (tracer) {
-            return tracer->DMAXferEnd(channel, irqRaised);
-        }
+    if (tracer) {
+        return tracer->DMAXferEnd(channel, irqRaised);
     }
 }
 
@@ -312,6 +292,7 @@ void SH2::DumpCacheAddressTag(std::ostream &out) const {
 template <bool debug, bool enableCache>
 FLATTEN uint64 SH2::Advance(uint64 cycles, uint64 spilloverCycles) {
     m_cyclesExecuted = spilloverCycles;
+    m_cyclesTarget = cycles;
     AdvanceWDT<false>();
     AdvanceFRT<false>();
 
@@ -332,11 +313,18 @@ FLATTEN uint64 SH2::Advance(uint64 cycles, uint64 spilloverCycles) {
         }
     }
 
-    while (m_cyclesExecuted < cycles) {
+    [[maybe_unused]] const bool perf = ::ymir::debug::kPerfStatsEnabled && m_perf != nullptr;
+    [[maybe_unused]] uint64 instructions = 0;
+    while (m_cyclesExecuted < m_cyclesTarget) {
         // [[maybe_unused]] const uint32 prevPC = PC; // debug aid
 
         // TODO: choose between interpreter (cached or uncached) and JIT recompiler
         m_cyclesExecuted += InterpretNext<debug, enableCache>();
+        if constexpr (::ymir::debug::kPerfStatsEnabled) {
+            if (perf) [[unlikely]] {
+                ++instructions;
+            }
+        }
 
         // If PC is not in any of these places, something went horribly wrong
 
@@ -356,10 +344,12 @@ FLATTEN uint64 SH2::Advance(uint64 cycles, uint64 spilloverCycles) {
                     break;
                 }
 
-                const uint16 instr = MemRead<uint16, true, true, enableCache>(PC);
-                const auto &mem = DecodeTable::s_instance.mem[instr];
-                if (CheckWatchpoints(mem)) {
-                    break;
+                if (!m_watchpoints.empty()) {
+                    const uint16 instr = MemRead<uint16, true, true, enableCache>(PC);
+                    const auto &mem = DecodeTable::s_instance.mem[instr];
+                    if (CheckWatchpoints(mem)) {
+                        break;
+                    }
                 }
             }
         }
@@ -373,6 +363,14 @@ FLATTEN uint64 SH2::Advance(uint64 cycles, uint64 spilloverCycles) {
         }
     }
     AdvanceDMA<debug, enableCache>(m_cyclesExecuted - spilloverCycles);
+
+    if constexpr (::ymir::debug::kPerfStatsEnabled) {
+        if (m_perf != nullptr) [[unlikely]] {
+            m_perf->instructions.Add(instructions);
+            m_perf->cycles.Add(m_cyclesExecuted - spilloverCycles);
+            FlushPerfBusAccesses();
+        }
+    }
     return m_cyclesExecuted;
 }
 
@@ -388,6 +386,14 @@ FLATTEN uint64 SH2::Step() {
     AdvanceFRT<false>();
     m_cyclesExecuted = InterpretNext<debug, enableCache>();
     AdvanceDMA<debug, enableCache>(m_cyclesExecuted);
+
+    if constexpr (::ymir::debug::kPerfStatsEnabled) {
+        if (m_perf != nullptr) [[unlikely]] {
+            m_perf->instructions.Add(1);
+            m_perf->cycles.Add(m_cyclesExecuted);
+            FlushPerfBusAccesses();
+        }
+    }
     return m_cyclesExecuted;
 }
 
@@ -508,6 +514,14 @@ T SH2::MemRead(uint32 address) {
     case 0b000: // cache
         if constexpr (enableCache) {
             if (m_cache.CCR.CE) {
+                if constexpr (instrFetch && !peek) {
+                    // Fast path for sequential fetches from the same line
+                    if (const uint8 *line = m_cache.GetFetchLine(address)) {
+                        const uint32 byte = bit::extract<0, 3>(address) ^ (4 - sizeof(T));
+                        return util::ReadNE<T>(&line[byte]);
+                    }
+                }
+
                 CacheEntry &entry = m_cache.GetEntry(address);
                 uint32 way = entry.FindWay(address);
 
@@ -523,6 +537,7 @@ T SH2::MemRead(uint32 address) {
                                 const uint32 memValue = m_bus.Read<uint32>((baseAddress + addressInc) & 0x7FFFFFF);
                                 util::WriteNE<uint32>(&entry.line[way][addressInc], memValue);
                             }
+                            CountPerfBusAccesses(baseAddress & 0x7FFFFFF, 4);
                         }
                     }
                 }
@@ -533,6 +548,9 @@ T SH2::MemRead(uint32 address) {
                     const T value = util::ReadNE<T>(&entry.line[way][byte]);
                     if constexpr (!peek) {
                         m_cache.UpdateLRU(address, way);
+                        if constexpr (instrFetch) {
+                            m_cache.SetFetchLine(address, way);
+                        }
                         devlog::trace<grp::cache>(m_logPrefix,
                                                   "[PC = {:08X}] {}-bit SH-2 cached area read from {:08X} = {:X} (hit)",
                                                   PC, sizeof(T) * 8, address, value);
@@ -552,6 +570,7 @@ T SH2::MemRead(uint32 address) {
         if constexpr (peek) {
             return m_bus.Peek<T>(address & 0x7FFFFFF);
         } else {
+            CountPerfBusAccesses(address & 0x7FFFFFF, 1);
             return m_bus.Read<T>(address & 0x7FFFFFF);
         }
     case 0b010: // associative purge
@@ -652,6 +671,7 @@ void SH2::MemWrite(uint32 address, T value) {
         if constexpr (poke) {
             m_bus.Poke<T>(address & 0x7FFFFFF, value);
         } else {
+            CountPerfBusAccesses(address & 0x7FFFFFF, 1);
             m_bus.Write<T>(address & 0x7FFFFFF, value);
         }
         break;
@@ -1572,71 +1592,75 @@ bool SH2::StepDMAC(uint32 channel) {
     const sint32 srcInc = getAddressInc(ch.srcMode);
     const sint32 dstInc = getAddressInc(ch.dstMode);
 
-    if constexpr (debug) {
-        if (!m_dmacTraced[channel]) {
-            m_dmacTraced[channel] = true;
-            TraceDMAXferBegin<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, ch.xferCount, xferSize, srcInc,
-                                     dstInc);
-        }
+    if (!m_dmacTraced[channel]) {
+        m_dmacTraced[channel] = true;
+        TraceDMAXferBegin(m_tracer, channel, ch.srcAddress, ch.dstAddress, ch.xferCount, xferSize, srcInc, dstInc);
     }
 
-    // Perform one unit of transfer
-    switch (ch.xferSize) {
-    case DMATransferSize::Byte: {
-        const uint8 value = MemReadByte<enableCache>(ch.srcAddress);
-        devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 8-bit transfer from {:08X} to {:08X} -> {:X}", channel,
-                                     ch.srcAddress, ch.dstAddress, value);
-        MemWriteByte<debug, enableCache>(ch.dstAddress, value);
-        TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
-        break;
-    }
-    case DMATransferSize::Word: {
-        const uint16 value = MemReadWord<enableCache>(ch.srcAddress);
-        devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 16-bit transfer from {:08X} to {:08X} -> {:X}", channel,
-                                     ch.srcAddress, ch.dstAddress, value);
-        MemWriteWord<debug, enableCache>(ch.dstAddress, value);
-        TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
-        break;
+    // Copy whole blocks of plain memory at once when possible.
+    // Tracing needs to observe every unit, so debug mode always uses the regular path.
+    bool blockXfer = false;
+    if constexpr (!debug) {
+        blockXfer = StepDMACBlock<enableCache>(channel, xferSize);
     }
-    case DMATransferSize::Longword: {
-        const uint32 value = MemReadLong<enableCache>(ch.srcAddress);
-        devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 32-bit transfer from {:08X} to {:08X} -> {:X}", channel,
-                                     ch.srcAddress, ch.dstAddress, value);
-        MemWriteLong<debug, enableCache>(ch.dstAddress, value);
-        TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
-        break;
-    }
-    case DMATransferSize::QuadLongword:
-        for (int i = 0; i < 4; i++) {
-            const uint32 value = MemReadLong<enableCache>(ch.srcAddress + i * sizeof(uint32));
-            devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 16-byte transfer {:d} from {:08X} to {:08X} -> {:X}",
-                                         channel, i, ch.srcAddress, ch.dstAddress, value);
-            MemWriteLong<debug, enableCache>(ch.dstAddress + i * sizeof(uint32), value);
-            TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, 4);
+
+    if (!blockXfer) {
+        // Perform one unit of transfer
+        switch (ch.xferSize) {
+        case DMATransferSize::Byte: {
+            const uint8 value = MemReadByte<enableCache>(ch.srcAddress);
+            devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 8-bit transfer from {:08X} to {:08X} -> {:X}", channel,
+                                         ch.srcAddress, ch.dstAddress, value);
+            MemWriteByte<debug, enableCache>(ch.dstAddress, value);
+            TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
+            break;
+        }
+        case DMATransferSize::Word: {
+            const uint16 value = MemReadWord<enableCache>(ch.srcAddress);
+            devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 16-bit transfer from {:08X} to {:08X} -> {:X}", channel,
+                                         ch.srcAddress, ch.dstAddress, value);
+            MemWriteWord<debug, enableCache>(ch.dstAddress, value);
+            TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
+            break;
+        }
+        case DMATransferSize::Longword: {
+            const uint32 value = MemReadLong<enableCache>(ch.srcAddress);
+            devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 32-bit transfer from {:08X} to {:08X} -> {:X}", channel,
+                                         ch.srcAddress, ch.dstAddress, value);
+            MemWriteLong<debug, enableCache>(ch.dstAddress, value);
+            TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
+            break;
+        }
+        case DMATransferSize::QuadLongword:
+            for (int i = 0; i < 4; i++) {
+                const uint32 value = MemReadLong<enableCache>(ch.srcAddress + i * sizeof(uint32));
+                devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 16-byte transfer {:d} from {:08X} to {:08X} -> {:X}",
+                                             channel, i, ch.srcAddress, ch.dstAddress, value);
+                MemWriteLong<debug, enableCache>(ch.dstAddress + i * sizeof(uint32), value);
+                TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, 4);
+            }
+            break;
         }
-        break;
-    }
 
-    // Update address and remaining count
-    ch.srcAddress += srcInc;
-    ch.dstAddress += dstInc;
+        // Update address and remaining count
+        ch.srcAddress += srcInc;
+        ch.dstAddress += dstInc;
 
-    if (ch.xferSize == DMATransferSize::QuadLongword) {
-        if (ch.xferCount >= 4) {
-            ch.xferCount -= 4;
+        if (ch.xferSize == DMATransferSize::QuadLongword) {
+            if (ch.xferCount >= 4) {
+                ch.xferCount -= 4;
+            } else {
+                devlog::trace<grp::dma>(m_logPrefix, "DMAC{} 16-byte transfer count misaligned", channel);
+                ch.xferCount = 0;
+            }
         } else {
-            devlog::trace<grp::dma>(m_logPrefix, "DMAC{} 16-byte transfer count misaligned", channel);
-            ch.xferCount = 0;
+            --ch.xferCount;
         }
-    } else {
-        --ch.xferCount;
     }
 
     if (ch.xferCount == 0) {
-        TraceDMAXferEnd<debug>(m_tracer, channel, ch.irqEnable);
-        if constexpr (debug) {
-            m_dmacTraced[channel] = false;
-        }
+        TraceDMAXferEnd(m_tracer, channel, ch.irqEnable);
+        m_dmacTraced[channel] = false;
 
         ch.xferEnded = true;
         devlog::trace<grp::dma>(m_logPrefix, "DMAC{} transfer finished", channel);
@@ -1652,6 +1676,79 @@ bool SH2::StepDMAC(uint32 channel) {
     return true;
 }
 
+template <bool enableCache>
+bool SH2::StepDMACBlock(uint32 channel, uint32 xferSize) {
+    auto &ch = m_dmaChannels[channel];
+
+    using enum DMATransferIncrementMode;
+    if (!ch.autoRequest || ch.srcMode != Increment || ch.dstMode != Increment) {
+        return false;
+    }
+
+    // Block writes to some regions (VDP1 VRAM, for instance) must be 16-bit aligned
+    if (xferSize < sizeof(uint16)) {
+        return false;
+    }
+    const uint32 alignMask = std::min<uint32>(xferSize, sizeof(uint32)) - 1u;
+    if ((ch.srcAddress | ch.dstAddress) & alignMask) {
+        return false;
+    }
+
+    // Cached accesses may fill or update cache lines, so only cache-through accesses can be copied directly
+    auto isCacheThrough = [&](uint32 address) {
+        switch (address >> 29u) {
+        case 0b000: return !enableCache || !m_cache.CCR.CE;
+        case 0b001: [[fallthrough]];
+        case 0b101: return true;
+        default: return false;
+        }
+    };
+
+    // 16-byte transfers decrement the count by 4 per unit
+    const uint32 countPerUnit = ch.xferSize == DMATransferSize::QuadLongword ? 4 : 1;
+
+    bool transferred = false;
+    while (ch.xferCount >= countPerUnit && isCacheThrough(ch.srcAddress) && isCacheThrough(ch.dstAddress)) {
+        const uint32 srcAddress = ch.srcAddress & 0x7FFFFFF;
+        const uint32 dstAddress = ch.dstAddress & 0x7FFFFFF;
+
+        const std::span<const uint8> src = m_bus.GetArrayBlock(srcAddress);
+        const uint32 remaining = ch.xferCount / countPerUnit * xferSize;
+        const uint32 dstSize = m_bus.GetWriteBlockSize(dstAddress);
+        uint32 size = std::min<uint32>({static_cast<uint32>(src.size()), dstSize, remaining});
+
+        // A unit-by-unit transfer into an overlapping region ahead of the source reads back data written earlier in
+        // the same transfer, so stop the block right before that point
+        const std::span<const uint8> dst = m_bus.GetArrayBlock(dstAddress);
+        if (!dst.empty()) {
+            const auto srcPtr = reinterpret_cast<uintptr_t>(src.data());
+            const auto dstPtr = reinterpret_cast<uintptr_t>(dst.data());
+            if (dstPtr > srcPtr && dstPtr < srcPtr + size) {
+                size = dstPtr - srcPtr;
+            }
+        }
+        size -= size % xferSize;
+        if (size == 0) {
+            break;
+        }
+
+        m_bus.WriteBlock(dstAddress, src.first(size));
+        devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} block transfer of {:X} bytes from {:08X} to {:08X}", channel,
+                                     size, ch.srcAddress, ch.dstAddress);
+
+        ch.srcAddress += size;
+        ch.dstAddress += size;
+        ch.xferCount -= size / xferSize * countPerUnit;
+        // One read and one write per longword or smaller unit
+        const uint32 units = size / std::min<uint32>(xferSize, sizeof(uint32));
+        CountPerfBusAccesses(srcAddress, units);
+        CountPerfBusAccesses(dstAddress, units);
+        transferred = true;
+    }
+
+    return transferred;
+}
+
 template <bool debug, bool enableCache>
 FORCE_INLINE void SH2::AdvanceDMA(uint64 cycles) {
     for (uint32 i = 0; i < 2; ++i) {
@@ -1681,9 +1778,9 @@ template <bool debug>
 FORCE_INLINE void SH2::ExecuteDiv32() {
     DIVU.DVDNTL = DIVU.DVDNT;
     DIVU.DVDNTH = static_cast<sint32>(DIVU.DVDNT) >> 31;
-    TraceBegin32x32Division<debug>(m_tracer, DIVU.DVDNTL, DIVU.DVSR, DIVU.DVCR.OVFIE);
+    TraceBegin32x32Division(m_tracer, DIVU.DVDNTL, DIVU.DVSR, DIVU.DVCR.OVFIE);
     DIVU.Calc32();
-    TraceEndDivision<debug>(m_tracer, DIVU.DVDNTL, DIVU.DVDNTH, DIVU.DVCR.OVF);
+    TraceEndDivision(m_tracer, DIVU.DVDNTL, DIVU.DVDNTH, DIVU.DVCR.OVF);
     if (DIVU.DVCR.OVF && DIVU.DVCR.OVFIE) {
         RaiseInterrupt(InterruptSource::DIVU_OVFI);
     }
@@ -1691,11 +1788,10 @@ FORCE_INLINE void SH2::ExecuteDiv32() {
 
 template <bool debug>
 FORCE_INLINE void SH2::ExecuteDiv64() {
-    TraceBegin64x32Division<debug>(m_tracer,
-                                   (static_cast<sint64>(DIVU.DVDNTH) << 32ll) | static_cast<sint64>(DIVU.DVDNTL),
-                                   DIVU.DVSR, DIVU.DVCR.OVFIE);
+    TraceBegin64x32Division(m_tracer, (static_cast<sint64>(DIVU.DVDNTH) << 32ll) | static_cast<sint64>(DIVU.DVDNTL),
+                            DIVU.DVSR, DIVU.DVCR.OVFIE);
     DIVU.Calc64();
-    TraceEndDivision<debug>(m_tracer, DIVU.DVDNTL, DIVU.DVDNTH, DIVU.DVCR.OVF);
+    TraceEndDivision(m_tracer, DIVU.DVDNTL, DIVU.DVDNTH, DIVU.DVCR.OVF);
     if (DIVU.DVCR.OVF && DIVU.DVCR.OVFIE) {
         RaiseInterrupt(InterruptSource::DIVU_OVFI);
     }
@@ -1714,6 +1810,8 @@ FORCE_INLINE void SH2::AdvanceFRT() {
 
 FORCE_INLINE void SH2::TriggerFRTInputCapture() {
     // TODO: FRT.TCR.IEDGA
+    m_cbFRTInputCapture();
+    ++m_frtInputCaptureCount;
     FRT.ICR = FRT.FRC;
     FRT.FTCSR.ICF = 1;
     if (FRT.TIER.ICIE) {
@@ -1852,6 +1950,9 @@ void SH2::RecalcInterrupts() {
 // Debugger
 
 FORCE_INLINE bool SH2::CheckBreakpoint() {
+    if (!IsBreakpointFiltered(PC)) {
+        return false;
+    }
     if (m_breakpoints.contains(PC)) {
         m_debugBreakMgr->SignalDebugBreak(debug::DebugBreakInfo::SH2Breakpoint(IsMaster(), PC));
         return true;
@@ -1860,7 +1961,7 @@ FORCE_INLINE bool SH2::CheckBreakpoint() {
 }
 
 FORCE_INLINE bool SH2::CheckWatchpoints(const DecodedMemAccesses &mem) {
-    if (m_watchpoints.empty() || !mem.anyAccess) {
+    if (!mem.anyAccess) {
         return false;
     }
     const bool wtpt1 = CheckWatchpoint(mem.first);
@@ -1930,7 +2031,7 @@ FORCE_INLINE uint64 SH2::EnterException(uint8 vectorNumber) {
     const uint32 address3 = VBR + (static_cast<uint32>(vectorNumber) << 2u);
     const uint64 cycles = AccessCycles<true, enableCache>(address1) + AccessCycles<true, enableCache>(address2) +
                           AccessCycles<false, enableCache>(address3) + 5;
-    TraceException<debug>(m_tracer, vectorNumber, PC, SR.u32);
+    TraceException(m_tracer, vectorNumber, PC, SR.u32);
     MemWriteLong<debug, enableCache>(address1, SR.u32);
     MemWriteLong<debug, enableCache>(address2, PC);
     PC = MemReadLong<enableCache>(address3);
@@ -1946,7 +2047,7 @@ FORCE_INLINE uint64 SH2::InterpretNext() {
     if (m_intrPending) [[unlikely]] {
         // Service interrupt
         const uint8 vecNum = INTC.GetVector(INTC.pending.source);
-        TraceInterrupt<debug>(m_tracer, vecNum, INTC.pending.level, INTC.pending.source, PC);
+        TraceInterrupt(m_tracer, vecNum, INTC.pending.level, INTC.pending.source, PC);
         devlog::trace<grp::intr>(m_logPrefix, "[PC = {:08X}] Handling interrupt level {:02X}, vector number {:02X}", PC,
                                  INTC.pending.level, vecNum);
         const uint64 cycles = EnterException<debug, enableCache>(vecNum);
@@ -1975,7 +2076,7 @@ FORCE_INLINE uint64 SH2::InterpretNext() {
     const uint16 instr = FetchInstruction<enableCache>(PC);
     TraceExecuteInstruction<debug>(m_tracer, PC, instr, m_delaySlot);
 
-    const OpcodeType opcode = DecodeTable::s_instance.opcodes[m_delaySlot][instr];
+    const OpcodeType opcode = DecodeTable::s_instance.GetOpcode(m_delaySlot, instr);
     const DecodedArgs &args = DecodeTable::s_instance.args[instr];
 
     // TODO: check program execution
@@ -3890,6 +3991,10 @@ void SH2::Probe::SetSleepState(bool sleep) {
     m_sh2.m_sleep = sleep;
 }
 
+uint64 SH2::Probe::GetCycleCount() const {
+    return m_sh2.GetCurrentCycleCount();
+}
+
 void SH2::Probe::ExecuteDiv32() {
     m_sh2.ExecuteDiv32<true>();
 }
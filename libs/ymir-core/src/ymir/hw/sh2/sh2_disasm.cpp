@@ -6,7 +6,8 @@
 
 namespace ymir::sh2 {
 
-DisassemblyTable::DisassemblyTable() {
+constexpr DisassemblyTable::DisassemblyTable()
+    : instrs{} {
     for (uint32 opcode = 0; opcode < 0x10000; opcode++) {
         DisassembledInstruction &instr = this->instrs[opcode];
 
@@ -383,7 +384,7 @@ DisassemblyTable::DisassemblyTable() {
     }
 }
 
-DisassemblyTable DisassemblyTable::s_instance{};
+constinit const DisassemblyTable DisassemblyTable::s_instance{};
 
 const DisassembledInstruction &Disassemble(uint16 opcode) {
     return DisassemblyTable::s_instance.instrs[opcode];
@@ -7,14 +7,10 @@
 #include <ymir/util/thread_name.hpp>
 #include <ymir/util/unreachable.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
-
-#if defined(_M_X64) || defined(__x86_64__)
-    #include <immintrin.h>
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    #include <arm_neon.h>
-#endif
+#include <utility>
 
 namespace ymir::vdp {
 
@@ -196,7 +192,8 @@ void VDP::MapMemory(sys::SH2Bus &bus) {
         [](uint32 address, uint32 value, void *ctx) {
             cast(ctx).VDP1WriteVRAM<uint16, false>(address + 0, value >> 16u);
             cast(ctx).VDP1WriteVRAM<uint16, false>(address + 2, value >> 0u);
-        });
+        },
+        [](uint32 address, std::span<const uint8> data, void *ctx) { cast(ctx).VDP1WriteVRAMBlock(address, data); });
     bus.MapSideEffectFree(
         0x5C0'0000, 0x5C7'FFFF, this,
         [](uint32 address, uint8 value, void *ctx) { cast(ctx).VDP1WriteVRAM<uint8, true>(address, value); },
@@ -290,7 +287,8 @@ void VDP::MapMemory(sys::SH2Bus &bus) {
         [](uint32 address, uint32 value, void *ctx) {
             cast(ctx).VDP2WriteVRAM<uint16>(address + 0, value >> 16u);
             cast(ctx).VDP2WriteVRAM<uint16>(address + 2, value >> 0u);
-        });
+        },
+        [](uint32 address, std::span<const uint8> data, void *ctx) { cast(ctx).VDP2WriteVRAMBlock(address, data); });
 
     // VDP2 CRAM
     bus.MapNormal(
@@ -427,6 +425,23 @@ FORCE_INLINE void VDP::VDP1WriteVRAM(uint32 address, T value) {
     }
 }
 
+void VDP::VDP1WriteVRAMBlock(uint32 address, std::span<const uint8> data) {
+    address &= 0x7FFFF;
+    assert((address & 1) == 0 && (data.size() & 1) == 0);
+    assert(address + data.size() <= m_state.VRAM1.size());
+
+    std::copy(data.begin(), data.end(), &m_state.VRAM1[address]);
+    if (m_threadedVDP1Rendering) {
+        for (uint32 offset = 0; offset < data.size(); offset += sizeof(uint16)) {
+            const uint16 value = util::ReadBE<uint16>(&data[offset]);
+            m_vdp1RenderingContext.EnqueueEvent(VDP1RenderEvent::VRAMWriteWord(address + offset, value));
+        }
+    }
+    if (m_stallVDP1OnVRAMWrites && m_VDP1RenderState.rendering) {
+        m_VDP1TimingPenaltyCycles += kVDP1TimingPenaltyPerWrite * (data.size() / sizeof(uint16));
+    }
+}
+
 template <mem_primitive T>
 FORCE_INLINE T VDP::VDP1ReadFB(uint32 address) const {
     address &= 0x3FFFF;
@@ -505,6 +520,21 @@ FORCE_INLINE void VDP::VDP2WriteVRAM(uint32 address, T value) {
     }
 }
 
+void VDP::VDP2WriteVRAMBlock(uint32 address, std::span<const uint8> data) {
+    // TODO: handle VRSIZE.VRAMSZ
+    address &= 0x7FFFF;
+    assert((address & 1) == 0 && (data.size() & 1) == 0);
+    assert(address + data.size() <= m_state.VRAM2.size());
+
+    std::copy(data.begin(), data.end(), &m_state.VRAM2[address]);
+    if (m_threadedVDP2Rendering) {
+        for (uint32 offset = 0; offset < data.size(); offset += sizeof(uint16)) {
+            const uint16 value = util::ReadBE<uint16>(&data[offset]);
+            m_vdp2RenderingContext.EnqueueEvent(VDP2RenderEvent::VDP2VRAMWriteWord(address + offset, value));
+        }
+    }
+}
+
 template <mem_primitive T, bool peek>
 FORCE_INLINE T VDP::VDP2ReadCRAM(uint32 address) const {
     if constexpr (std::is_same_v<T, uint32>) {
@@ -1790,6 +1820,12 @@ void VDP::VDP1ProcessCommand() {
         }
 
         m_VDP1RenderState.cyclesSpent += VDP1CalcCommandTiming(cmdAddress, control);
+
+        if constexpr (debug::kPerfStatsEnabled) {
+            if (m_perf != nullptr) [[unlikely]] {
+                m_perf->vdp1Commands.Add(1);
+            }
+        }
     }
 
     // Go to the next command
@@ -1933,6 +1969,12 @@ FORCE_INLINE bool VDP::VDP1PlotPixel(CoordS32 coord, const VDP1PixelParams &pixe
         return false;
     }
 
+    if constexpr (debug::kPerfStatsEnabled) {
+        if (m_perf != nullptr) [[unlikely]] {
+            ++m_VDP1RenderState.pixelsPlotted;
+        }
+    }
+
     if constexpr (!transparentMeshes) {
         if (pixelParams.mode.meshEnable && ((x ^ y) & 1)) {
             return true;
@@ -2487,6 +2529,13 @@ FORCE_INLINE void VDP::VDP1Cmd_Handle(uint32 cmdAddress, VDP1Command::Control co
     case SystemClipping: VDP1Cmd_SetSystemClipping(cmdAddress); break;
     case SetLocalCoordinates: VDP1Cmd_SetLocalCoordinates(cmdAddress); break;
     }
+
+    if constexpr (debug::kPerfStatsEnabled) {
+        const uint64 pixels = std::exchange(m_VDP1RenderState.pixelsPlotted, 0);
+        if (m_perf != nullptr) [[unlikely]] {
+            m_perf->vdp1Pixels.Add(pixels);
+        }
+    }
 }
 
 template <bool deinterlace, bool transparentMeshes>
@@ -3829,6 +3878,15 @@ void VDP::VDP2DrawLine(uint32 y, bool altField) {
 
     // Compose image
     VDP2ComposeLine<deinterlace, transparentMeshes>(y, altField);
+
+    if constexpr (debug::kPerfStatsEnabled) {
+        if (m_perf != nullptr) [[unlikely]] {
+            // Sprite layer plus enabled background layers
+            const uint64 layers = 1 + std::count(regs2.bgEnabled.begin(), regs2.bgEnabled.end(), true);
+            m_perf->vdp2Lines.Add(1);
+            m_perf->vdp2Layers.Add(layers);
+        }
+    }
 }
 
 FORCE_INLINE void VDP::VDP2DrawLineColorAndBackScreens(uint32 y) {
@@ -4166,882 +4224,6 @@ static const auto kColorOffsetLUT = [] {
     return arr;
 }();
 
-// Tests if an array of uint8 values are all zeroes
-FORCE_INLINE bool AllZeroU8(std::span<const uint8> values) {
-
-#if defined(_M_X64) || defined(__x86_64__)
-
-    #if defined(__AVX__)
-    // 32 at a time
-    for (; values.size() >= 32; values = values.subspan(32)) {
-        const __m256i vec32 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values.data()));
-
-        // Test if all bits are 0
-        if (!_mm256_testz_si256(vec32, vec32)) {
-            return false;
-        }
-    }
-    #endif
-
-    #if defined(__SSE2__)
-    // 16 at a time
-    for (; values.size() >= 16; values = values.subspan(16)) {
-        __m128i vec16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values.data()));
-
-        // Compare to zero
-        vec16 = _mm_cmpeq_epi8(vec16, _mm_setzero_si128());
-
-        // Extract MSB all into a 16-bit mask, if any bit is clear, then we have a true value
-        if (_mm_movemask_epi8(vec16) != 0xFFFF) {
-            return false;
-        }
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // 64 at a time
-    for (; values.size() >= 64; values = values.subspan(64)) {
-        const uint8x16x4_t vec64 = vld1q_u8_x4(reinterpret_cast<const uint8 *>(values.data()));
-
-        // If the largest value is not zero, we have a true value
-        if ((vmaxvq_u8(vec64.val[0]) != 0u) || (vmaxvq_u8(vec64.val[1]) != 0u) || (vmaxvq_u8(vec64.val[2]) != 0u) ||
-            (vmaxvq_u8(vec64.val[3]) != 0u)) {
-            return false;
-        }
-    }
-
-    // 16 at a time
-    for (; values.size() >= 16; values = values.subspan(16)) {
-        const uint8x16_t vec16 = vld1q_u8(reinterpret_cast<const uint8 *>(values.data()));
-
-        // If the largest value is not zero, we have a true value
-        if (vmaxvq_u8(vec16) != 0u) {
-            return false;
-        }
-    }
-#elif defined(__clang__) || defined(__GNUC__)
-    // 16 at a time
-    for (; values.size() >= sizeof(__int128); values = values.subspan(sizeof(__int128))) {
-        const __int128 &vec16 = *reinterpret_cast<const __int128 *>(values.data());
-
-        if (vec16 != __int128(0)) {
-            return false;
-        }
-    }
-#endif
-
-    // 8 at a time
-    for (; values.size() >= sizeof(uint64); values = values.subspan(sizeof(uint64))) {
-        const uint64 &vec8 = *reinterpret_cast<const uint64 *>(values.data());
-
-        if (vec8 != 0ull) {
-            return false;
-        }
-    }
-
-    // 4 at a time
-    for (; values.size() >= sizeof(uint32); values = values.subspan(sizeof(uint32))) {
-        const uint32 &vec4 = *reinterpret_cast<const uint32 *>(values.data());
-
-        if (vec4 != 0u) {
-            return false;
-        }
-    }
-
-    for (const uint8 &value : values) {
-        if (value != 0u) {
-            return false;
-        }
-    }
-    return true;
-}
-
-// Tests if an array of bool values are all true
-FORCE_INLINE bool AllBool(std::span<const bool> values) {
-
-#if defined(_M_X64) || defined(__x86_64__)
-    #if defined(__AVX__)
-    // 32 at a time
-    for (; values.size() >= 32; values = values.subspan(32)) {
-        __m256i vec32 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values.data()));
-
-        // Move bit 0 into the MSB
-        vec32 = _mm256_slli_epi64(vec32, 7);
-
-        // Extract 32 MSBs into a 32-bit mask, if any bit is zero, then we have a false value
-        if (_mm256_movemask_epi8(vec32) != 0xFFFF'FFFF) {
-            return false;
-        }
-    }
-    #endif
-
-    #if defined(__SSE2__)
-    // 16 at a time
-    for (; values.size() >= 16; values = values.subspan(16)) {
-        __m128i vec16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values.data()));
-
-        // Move bit 0 into the MSB
-        vec16 = _mm_slli_epi64(vec16, 7);
-
-        // Extract 16 MSBs into a 32-bit mask, if any bit is zero, then we have a false value
-        if (_mm_movemask_epi8(vec16) != 0xFFFF) {
-            return false;
-        }
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // 64 at a time
-    for (; values.size() >= 64; values = values.subspan(64)) {
-        const uint8x16x4_t vec64 = vld1q_u8_x4(reinterpret_cast<const uint8 *>(values.data()));
-
-        // If the smallest value is zero, then we have a false value
-        if ((vminvq_u8(vec64.val[0]) == 0u) || (vminvq_u8(vec64.val[1]) == 0u) || (vminvq_u8(vec64.val[2]) == 0u) ||
-            (vminvq_u8(vec64.val[3]) == 0u)) {
-            return false;
-        }
-    }
-    // 16 at a time
-    for (; values.size() >= 16; values = values.subspan(16)) {
-        const uint8x16_t vec16 = vld1q_u8(reinterpret_cast<const uint8 *>(values.data()));
-
-        // If the smallest value is zero, then we have a false value
-        if (vminvq_u8(vec16) == 0u) {
-            return false;
-        }
-    }
-#elif defined(__clang__) || defined(__GNUC__)
-    // 16 at a time
-    for (; values.size() >= sizeof(__int128); values = values.subspan(sizeof(__int128))) {
-        const __int128 &vec16 = *reinterpret_cast<const __int128 *>(values.data());
-
-        if (vec16 != __int128((__int128(0x01'01'01'01'01'01'01'01) << 64) | 0x01'01'01'01'01'01'01'01)) {
-            return false;
-        }
-    }
-#endif
-
-    // 8 at a time
-    for (; values.size() >= sizeof(uint64); values = values.subspan(sizeof(uint64))) {
-        const uint64 &vec8 = *reinterpret_cast<const uint64 *>(values.data());
-
-        if (vec8 != 0x01'01'01'01'01'01'01'01) {
-            return false;
-        }
-    }
-
-    // 4 at a time
-    for (; values.size() >= sizeof(uint32); values = values.subspan(sizeof(uint32))) {
-        const uint32 &vec4 = *reinterpret_cast<const uint32 *>(values.data());
-
-        if (vec4 != 0x01'01'01'01) {
-            return false;
-        }
-    }
-
-    for (const bool &value : values) {
-        if (!value) {
-            return false;
-        }
-    }
-    return true;
-}
-
-// Tests if an any element in an array of bools are true
-FORCE_INLINE bool AnyBool(std::span<const bool> values) {
-#if defined(_M_X64) || defined(__x86_64__)
-    #if defined(__AVX__)
-    // 32 at a time
-    for (; values.size() >= 32; values = values.subspan(32)) {
-        __m256i vec32 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values.data()));
-
-        // Move bit 0 into the MSB
-        vec32 = _mm256_slli_epi64(vec32, 7);
-
-        // Extract MSB into a 32-bit mask, if any bit is set, then we have a true value
-        if (_mm256_movemask_epi8(vec32) != 0u) {
-            return true;
-        }
-    }
-    #endif
-    #if defined(__SSE2__)
-    // 16 at a time
-    for (; values.size() >= 16; values = values.subspan(16)) {
-        __m128i vec16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values.data()));
-
-        // Move bit 0 into the MSB
-        vec16 = _mm_slli_epi64(vec16, 7);
-
-        // Extract MSB into a 16-bit mask, if any bit is set, then we have a true value
-        if (_mm_movemask_epi8(vec16) != 0u) {
-            return true;
-        }
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // 64 at a time
-    for (; values.size() >= 64; values = values.subspan(64)) {
-        const uint8x16x4_t vec64 = vld1q_u8_x4(reinterpret_cast<const uint8 *>(values.data()));
-
-        // If the smallest value is not zero, then we have a true value
-        if ((vmaxvq_u8(vec64.val[0]) != 0u) || (vmaxvq_u8(vec64.val[1]) != 0u) || (vmaxvq_u8(vec64.val[2]) != 0u) ||
-            (vmaxvq_u8(vec64.val[3]) != 0u)) {
-            return true;
-        }
-    }
-
-    // 16 at a time
-    for (; values.size() >= 16; values = values.subspan(16)) {
-        const uint8x16_t vec16 = vld1q_u8(reinterpret_cast<const uint8 *>(values.data()));
-
-        // If the smallest value is not zero, then we have a true value
-        if (vmaxvq_u8(vec16) != 0u) {
-            return true;
-        }
-    }
-#elif defined(__clang__) || defined(__GNUC__)
-    // 16 at a time
-    for (; values.size() >= sizeof(__int128); values = values.subspan(sizeof(__int128))) {
-        const __int128 &vec16 = *reinterpret_cast<const __int128 *>(values.data());
-
-        if (vec16) {
-            return true;
-        }
-    }
-#endif
-
-    // 8 at a time
-    for (; values.size() >= sizeof(uint64); values = values.subspan(sizeof(uint64))) {
-        const uint64 &vec8 = *reinterpret_cast<const uint64 *>(values.data());
-
-        if (vec8) {
-            return true;
-        }
-    }
-
-    // 4 at a time
-    for (; values.size() >= sizeof(uint32); values = values.subspan(sizeof(uint32))) {
-        const uint32 &vec4 = *reinterpret_cast<const uint32 *>(values.data());
-
-        if (vec4) {
-            return true;
-        }
-    }
-
-    for (const bool &value : values) {
-        if (value) {
-            return true;
-        }
-    }
-    return false;
-}
-
-FORCE_INLINE void Color888ShadowMasked(const std::span<Color888> pixels, const std::span<const bool, kMaxResH> mask) {
-    size_t i = 0;
-
-#if defined(_M_X64) || defined(__x86_64__)
-    #if defined(__AVX2__)
-    // Eight pixels at a time
-    for (; (i + 8) < pixels.size(); i += 8) {
-        // Load eight mask bytes into 32-bit lanes of 000... or 111...
-        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
-        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
-
-        const __m256i pixel_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&pixels[i]));
-
-        __m256i shadowed_x8 = _mm256_srli_epi32(pixel_x8, 1);
-        shadowed_x8 = _mm256_and_si256(shadowed_x8, _mm256_set1_epi8(0x7F));
-
-        // Blend with mask
-        const __m256i dstColor_x8 = _mm256_blendv_epi8(pixel_x8, shadowed_x8, mask_x8);
-
-        // Write
-        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&pixels[i]), dstColor_x8);
-    }
-    #endif
-
-    #if defined(__SSE2__)
-    // Four pixels at a time
-    for (; (i + 4) < pixels.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        __m128i mask_x4 = _mm_loadu_si32(mask.data() + i);
-        mask_x4 = _mm_unpacklo_epi8(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_unpacklo_epi16(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_sub_epi32(_mm_setzero_si128(), mask_x4);
-
-        const __m128i pixel_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pixels[i]));
-
-        __m128i shadowed_x4 = _mm_srli_epi64(pixel_x4, 1);
-
-        shadowed_x4 = _mm_and_si128(shadowed_x4, _mm_set1_epi8(0x7F));
-
-        // Blend with mask
-        const __m128i dstColor_x4 =
-            _mm_or_si128(_mm_and_si128(mask_x4, shadowed_x4), _mm_andnot_si128(mask_x4, pixel_x4));
-
-        // Write
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(&pixels[i]), dstColor_x4);
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // Four pixels at a time
-    for (; (i + 4) < pixels.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
-        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
-        mask_x4 = vnegq_s32(mask_x4);
-
-        const uint32x4_t pixel_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&pixels[i]));
-        const uint32x4_t shadowed_x4 = vshrq_n_u8(pixel_x4, 1);
-
-        // Blend with mask
-        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, shadowed_x4, pixel_x4);
-
-        // Write
-        vst1q_u32(reinterpret_cast<uint32 *>(&pixels[i]), dstColor_x4);
-    }
-#endif
-
-    for (; i < pixels.size(); i++) {
-        Color888 &pixel = pixels[i];
-        if (mask[i]) {
-            pixel.u32 >>= 1;
-            pixel.u32 &= 0x7F'7F'7F'7F;
-        }
-    }
-}
-
-FORCE_INLINE void Color888SatAddMasked(const std::span<Color888> dest, const std::span<const bool, kMaxResH> mask,
-                                       const std::span<const Color888, kMaxResH> topColors,
-                                       const std::span<const Color888, kMaxResH> btmColors) {
-    size_t i = 0;
-
-#if defined(_M_X64) || defined(__x86_64__)
-
-    #if defined(__AVX2__)
-    // Eight pixels at a time
-    for (; (i + 8) < dest.size(); i += 8) {
-        // Load eight mask bytes into 32-bit lanes of 000... or 111...
-        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
-        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
-
-        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
-        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
-
-        // Pack back into 8-bit values, be sure to truncate to avoid saturation
-        __m256i dstColor_x8 = _mm256_adds_epu8(topColor_x8, btmColor_x8);
-
-        // Blend with mask
-        dstColor_x8 = _mm256_blendv_epi8(topColor_x8, dstColor_x8, mask_x8);
-
-        // Write
-        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
-    }
-    #endif
-
-    #if defined(__SSE2__)
-    // Four pixels at a time
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        __m128i mask_x4 = _mm_loadu_si32(mask.data() + i);
-        mask_x4 = _mm_unpacklo_epi8(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_unpacklo_epi16(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_sub_epi32(_mm_setzero_si128(), mask_x4);
-
-        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
-        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
-
-        // Saturated add
-        __m128i dstColor_x4 = _mm_adds_epu8(topColor_x4, btmColor_x4);
-
-        // Blend with mask
-        dstColor_x4 = _mm_or_si128(_mm_and_si128(mask_x4, dstColor_x4), _mm_andnot_si128(mask_x4, topColor_x4));
-
-        // Write
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // Four pixels at a time
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
-        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
-        mask_x4 = vnegq_s32(mask_x4);
-
-        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
-        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
-
-        // Saturated add
-        const uint32x4_t add_x4 = vqaddq_u8(topColor_x4, btmColor_x4);
-
-        // Blend with mask
-        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, add_x4, topColor_x4);
-
-        // Write
-        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
-    }
-#endif
-
-    for (; i < dest.size(); i++) {
-        const Color888 &topColor = topColors[i];
-        const Color888 &btmColor = btmColors[i];
-        Color888 &dstColor = dest[i];
-        if (mask[i]) {
-            dstColor.r = std::min<uint16>(topColor.r + btmColor.r, 255u);
-            dstColor.g = std::min<uint16>(topColor.g + btmColor.g, 255u);
-            dstColor.b = std::min<uint16>(topColor.b + btmColor.b, 255u);
-        } else {
-            dstColor = topColor;
-        }
-    }
-}
-
-FORCE_INLINE void Color888SelectMasked(const std::span<Color888> dest, const std::span<const bool, kMaxResH> mask,
-                                       const std::span<const Color888> topColors,
-                                       const std::span<const Color888, kMaxResH> btmColors) {
-    size_t i = 0;
-
-#if defined(_M_X64) || defined(__x86_64__)
-    #if defined(__AVX2__)
-    // Eight pixels at a time
-    for (; (i + 8) < dest.size(); i += 8) {
-        // Load eight mask bytes into 32-bit lanes of 000... or 111...
-        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
-        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
-
-        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
-        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
-
-        // Blend with mask
-        const __m256i dstColor_x8 = _mm256_blendv_epi8(topColor_x8, btmColor_x8, mask_x8);
-
-        // Write
-        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
-    }
-    #endif
-
-    #if defined(__SSE2__)
-    // Four pixels at a time
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        __m128i mask_x4 = _mm_loadu_si32(mask.data() + i);
-        mask_x4 = _mm_unpacklo_epi8(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_unpacklo_epi16(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_sub_epi32(_mm_setzero_si128(), mask_x4);
-
-        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
-        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
-
-        // Blend with mask
-        const __m128i dstColor_x4 =
-            _mm_or_si128(_mm_and_si128(mask_x4, btmColor_x4), _mm_andnot_si128(mask_x4, topColor_x4));
-
-        // Write
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // Four pixels at a time
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
-        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
-        mask_x4 = vnegq_s32(mask_x4);
-
-        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
-        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
-
-        // Blend with mask
-        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, btmColor_x4, topColor_x4);
-
-        // Write
-        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
-    }
-#endif
-
-    for (; i < dest.size(); i++) {
-        dest[i] = mask[i] ? btmColors[i] : topColors[i];
-    }
-}
-
-FORCE_INLINE void Color888AverageMasked(const std::span<Color888> dest, const std::span<const bool, kMaxResH> mask,
-                                        const std::span<const Color888> topColors,
-                                        const std::span<const Color888, kMaxResH> btmColors) {
-    size_t i = 0;
-
-#if defined(_M_X64) || defined(__x86_64__)
-    #if defined(__AVX2__)
-    // Eight pixels at a time
-    for (; (i + 8) < dest.size(); i += 8) {
-        // Load eight mask bytes into 32-bit lanes of 000... or 111...
-        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
-        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
-
-        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
-        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
-
-        const __m256i average_x8 = _mm256_add_epi32(
-            _mm256_srli_epi32(_mm256_and_si256(_mm256_xor_si256(topColor_x8, btmColor_x8), _mm256_set1_epi8(0xFE)), 1),
-            _mm256_and_si256(topColor_x8, btmColor_x8));
-
-        // Blend with mask
-        const __m256i dstColor_x8 = _mm256_blendv_epi8(topColor_x8, average_x8, mask_x8);
-
-        // Write
-        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
-    }
-    #endif
-
-    #if defined(__SSE2__)
-    // Four pixels at a time
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        __m128i mask_x4 = _mm_loadu_si32(mask.data() + i);
-        mask_x4 = _mm_unpacklo_epi8(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_unpacklo_epi16(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_sub_epi32(_mm_setzero_si128(), mask_x4);
-
-        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
-        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
-
-        const __m128i average_x4 = _mm_add_epi32(
-            _mm_srli_epi32(_mm_and_si128(_mm_xor_si128(topColor_x4, btmColor_x4), _mm_set1_epi8(0xFE)), 1),
-            _mm_and_si128(topColor_x4, btmColor_x4));
-
-        // Blend with mask
-        const __m128i dstColor_x4 =
-            _mm_or_si128(_mm_and_si128(mask_x4, average_x4), _mm_andnot_si128(mask_x4, topColor_x4));
-
-        // Write
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // Four pixels at a time
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
-        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
-        mask_x4 = vnegq_s32(mask_x4);
-
-        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
-        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
-
-        // Halving average
-        const uint32x4_t average_x4 = vhaddq_u8(topColor_x4, btmColor_x4);
-
-        // Blend with mask
-        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, average_x4, topColor_x4);
-
-        // Write
-        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
-    }
-#endif
-
-    for (; i < dest.size(); i++) {
-        const Color888 &topColor = topColors[i];
-        const Color888 &btmColor = btmColors[i];
-        Color888 &dstColor = dest[i];
-        if (mask[i]) {
-            dstColor = AverageRGB888(topColor, btmColor);
-        } else {
-            dstColor = topColor;
-        }
-    }
-}
-
-FORCE_INLINE void Color888CompositeRatioPerPixelMasked(const std::span<Color888> dest, const std::span<const bool> mask,
-                                                       const std::span<const Color888, kMaxResH> topColors,
-                                                       const std::span<const Color888, kMaxResH> btmColors,
-                                                       const std::span<const uint8, kMaxResH> ratios) {
-    size_t i = 0;
-
-#if defined(_M_X64) || defined(__x86_64__)
-    #if defined(__AVX2__)
-    // Eight pixels at a time
-    for (; (i + 8) < dest.size(); i += 8) {
-        // Load eightmask values and expand each byte into 32-bit 000... or 111...
-        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
-        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
-
-        // Load eight ratios and widen each byte into 32-bit lanes
-        // Put each byte into a 32-bit lane
-        __m256i ratio_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(&ratios[i]));
-        // Repeat the byte
-        ratio_x8 = _mm256_mullo_epi32(ratio_x8, _mm256_set1_epi32(0x01'01'01'01));
-
-        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
-        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
-
-        // Expand to 16-bit values
-        __m256i ratio16lo_x8 = _mm256_unpacklo_epi8(ratio_x8, _mm256_setzero_si256());
-        __m256i ratio16hi_x8 = _mm256_unpackhi_epi8(ratio_x8, _mm256_setzero_si256());
-
-        const __m256i topColor16lo = _mm256_unpacklo_epi8(topColor_x8, _mm256_setzero_si256());
-        const __m256i btmColor16lo = _mm256_unpacklo_epi8(btmColor_x8, _mm256_setzero_si256());
-
-        const __m256i topColor16hi = _mm256_unpackhi_epi8(topColor_x8, _mm256_setzero_si256());
-        const __m256i btmColor16hi = _mm256_unpackhi_epi8(btmColor_x8, _mm256_setzero_si256());
-
-        // Lerp
-        const __m256i dstColor16lo = _mm256_add_epi16(
-            btmColor16lo,
-            _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(topColor16lo, btmColor16lo), ratio16lo_x8), 5));
-        const __m256i dstColor16hi = _mm256_add_epi16(
-            btmColor16hi,
-            _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(topColor16hi, btmColor16hi), ratio16hi_x8), 5));
-
-        // Pack back into 8-bit values, be sure to truncate to avoid saturation
-        __m256i dstColor_x8 = _mm256_packus_epi16(_mm256_and_si256(dstColor16lo, _mm256_set1_epi16(0xFF)),
-                                                  _mm256_and_si256(dstColor16hi, _mm256_set1_epi16(0xFF)));
-
-        // Blend with mask
-        dstColor_x8 = _mm256_blendv_epi8(topColor_x8, dstColor_x8, mask_x8);
-
-        // Write
-        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
-    }
-    #endif
-
-    #if defined(__SSE2__)
-    // Four pixels at a time
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        __m128i mask_x4 = _mm_loadu_si32(mask.data() + i);
-        mask_x4 = _mm_unpacklo_epi8(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_unpacklo_epi16(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_sub_epi32(_mm_setzero_si128(), mask_x4);
-
-        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
-        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
-
-        // Load four ratios and splat each byte into 32-bit lanes
-        __m128i ratio_x4 = _mm_loadu_si32(&ratios[i]);
-        ratio_x4 = _mm_unpacklo_epi8(ratio_x4, ratio_x4);
-        ratio_x4 = _mm_unpacklo_epi16(ratio_x4, ratio_x4);
-
-        // Expand to 16-bit values
-        const __m128i ratio16lo_x4 = _mm_unpacklo_epi8(ratio_x4, _mm_setzero_si128());
-        const __m128i ratio16hi_x4 = _mm_unpackhi_epi8(ratio_x4, _mm_setzero_si128());
-
-        const __m128i topColor16lo = _mm_unpacklo_epi8(topColor_x4, _mm_setzero_si128());
-        const __m128i btmColor16lo = _mm_unpacklo_epi8(btmColor_x4, _mm_setzero_si128());
-
-        const __m128i topColor16hi = _mm_unpackhi_epi8(topColor_x4, _mm_setzero_si128());
-        const __m128i btmColor16hi = _mm_unpackhi_epi8(btmColor_x4, _mm_setzero_si128());
-
-        // Composite
-        const __m128i dstColor16lo = _mm_add_epi16(
-            btmColor16lo, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(topColor16lo, btmColor16lo), ratio16lo_x4), 5));
-        const __m128i dstColor16hi = _mm_add_epi16(
-            btmColor16hi, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(topColor16hi, btmColor16hi), ratio16hi_x4), 5));
-
-        // Pack back into 8-bit values, be sure to truncate to avoid saturation
-        __m128i dstColor_x4 = _mm_packus_epi16(_mm_and_si128(dstColor16lo, _mm_set1_epi16(0xFF)),
-                                               _mm_and_si128(dstColor16hi, _mm_set1_epi16(0xFF)));
-
-        // Blend with mask
-        dstColor_x4 = _mm_or_si128(_mm_and_si128(mask_x4, dstColor_x4), _mm_andnot_si128(mask_x4, topColor_x4));
-
-        // Write
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // Four pixels at a time
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
-        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
-        mask_x4 = vnegq_s32(mask_x4);
-
-        // Load four ratios and splat each byte into 32-bit lanes
-        uint32x4_t ratio_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(ratios.data() + i), vdupq_n_u32(0), 0);
-        // 8 -> 16
-        ratio_x4 = vzip1q_u8(ratio_x4, ratio_x4);
-        // 16 -> 32
-        ratio_x4 = vzip1q_u16(ratio_x4, ratio_x4);
-
-        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
-        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
-
-        const uint16x8_t topColor16lo = vmovl_u8(vget_low_u8(topColor_x4));
-        const uint16x8_t btmColor16lo = vmovl_u8(vget_low_u8(btmColor_x4));
-
-        const uint16x8_t topColor16hi = vmovl_high_u8(topColor_x4);
-        const uint16x8_t btmColor16hi = vmovl_high_u8(btmColor_x4);
-
-        // Composite
-        int16x8_t composite16lo = vsubq_s16(topColor16lo, btmColor16lo);
-        int16x8_t composite16hi = vsubq_s16(topColor16hi, btmColor16hi);
-
-        composite16lo = vmulq_u16(composite16lo, vmovl_u8(vget_low_s8(ratio_x4)));
-        composite16hi = vmulq_u16(composite16hi, vmovl_high_u8(ratio_x4));
-
-        composite16lo = vsraq_n_s16(vmovl_s8(vget_low_s8(btmColor_x4)), composite16lo, 5);
-        composite16hi = vsraq_n_s16(vmovl_high_s8(btmColor_x4), composite16hi, 5);
-
-        int8x16_t composite_x4 = vmovn_high_s16(vmovn_s16(composite16lo), composite16hi);
-
-        // Blend with mask
-        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, composite_x4, topColor_x4);
-
-        // Write
-        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
-    }
-#endif
-
-    for (; i < dest.size(); i++) {
-        const Color888 &topColor = topColors[i];
-        const Color888 &btmColor = btmColors[i];
-        const uint8 &ratio = ratios[i];
-        Color888 &dstColor = dest[i];
-        if (mask[i]) {
-            dstColor.r = btmColor.r + ((int)topColor.r - (int)btmColor.r) * ratio / 32;
-            dstColor.g = btmColor.g + ((int)topColor.g - (int)btmColor.g) * ratio / 32;
-            dstColor.b = btmColor.b + ((int)topColor.b - (int)btmColor.b) * ratio / 32;
-        } else {
-            dstColor = topColor;
-        }
-    }
-}
-
-FORCE_INLINE void Color888CompositeRatioMasked(const std::span<Color888> dest, const std::span<const bool> mask,
-                                               const std::span<const Color888, kMaxResH> topColors,
-                                               const std::span<const Color888, kMaxResH> btmColors, uint8 ratio) {
-    size_t i = 0;
-
-#if defined(_M_X64) || defined(__x86_64__)
-    #if defined(__AVX2__)
-    // Eight pixels at a time
-    const __m256i ratio_x8 = _mm256_set1_epi32(0x01'01'01'01 * ratio);
-    // Expand to 16-bit values
-    const __m256i ratio16lo_x8 = _mm256_unpacklo_epi8(ratio_x8, _mm256_setzero_si256());
-    const __m256i ratio16hi_x8 = _mm256_unpackhi_epi8(ratio_x8, _mm256_setzero_si256());
-    for (; (i + 8) < dest.size(); i += 8) {
-        // Load eight mask values and expand each byte into 32-bit 000... or 111...
-        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
-        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
-
-        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
-        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
-
-        const __m256i topColor16lo = _mm256_unpacklo_epi8(topColor_x8, _mm256_setzero_si256());
-        const __m256i btmColor16lo = _mm256_unpacklo_epi8(btmColor_x8, _mm256_setzero_si256());
-
-        const __m256i topColor16hi = _mm256_unpackhi_epi8(topColor_x8, _mm256_setzero_si256());
-        const __m256i btmColor16hi = _mm256_unpackhi_epi8(btmColor_x8, _mm256_setzero_si256());
-
-        // Lerp
-        const __m256i dstColor16lo = _mm256_add_epi16(
-            btmColor16lo,
-            _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(topColor16lo, btmColor16lo), ratio16lo_x8), 5));
-        const __m256i dstColor16hi = _mm256_add_epi16(
-            btmColor16hi,
-            _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(topColor16hi, btmColor16hi), ratio16hi_x8), 5));
-
-        // Pack back into 8-bit values, be sure to truncate to avoid saturation
-        __m256i dstColor_x8 = _mm256_packus_epi16(_mm256_and_si256(dstColor16lo, _mm256_set1_epi16(0xFF)),
-                                                  _mm256_and_si256(dstColor16hi, _mm256_set1_epi16(0xFF)));
-
-        // Blend with mask
-        dstColor_x8 = _mm256_blendv_epi8(topColor_x8, dstColor_x8, mask_x8);
-
-        // Write
-        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
-    }
-    #endif
-
-    #if defined(__SSE2__)
-    // Four pixels at a time
-    const __m128i ratio_x4 = _mm_set1_epi32(0x01'01'01'01 * ratio);
-    // Expand to 16-bit values
-    const __m128i ratio16lo_x4 = _mm_unpacklo_epi8(ratio_x4, _mm_setzero_si128());
-    const __m128i ratio16hi_x4 = _mm_unpackhi_epi8(ratio_x4, _mm_setzero_si128());
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        __m128i mask_x4 = _mm_loadu_si32(mask.data() + i);
-        mask_x4 = _mm_unpacklo_epi8(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_unpacklo_epi16(mask_x4, _mm_setzero_si128());
-        mask_x4 = _mm_sub_epi32(_mm_setzero_si128(), mask_x4);
-
-        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
-        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
-
-        const __m128i topColor16lo = _mm_unpacklo_epi8(topColor_x4, _mm_setzero_si128());
-        const __m128i btmColor16lo = _mm_unpacklo_epi8(btmColor_x4, _mm_setzero_si128());
-
-        const __m128i topColor16hi = _mm_unpackhi_epi8(topColor_x4, _mm_setzero_si128());
-        const __m128i btmColor16hi = _mm_unpackhi_epi8(btmColor_x4, _mm_setzero_si128());
-
-        // Composite
-        const __m128i dstColor16lo = _mm_add_epi16(
-            btmColor16lo, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(topColor16lo, btmColor16lo), ratio16lo_x4), 5));
-        const __m128i dstColor16hi = _mm_add_epi16(
-            btmColor16hi, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(topColor16hi, btmColor16hi), ratio16hi_x4), 5));
-
-        // Pack back into 8-bit values, be sure to truncate to avoid saturation
-        __m128i dstColor_x4 = _mm_packus_epi16(_mm_and_si128(dstColor16lo, _mm_set1_epi16(0xFF)),
-                                               _mm_and_si128(dstColor16hi, _mm_set1_epi16(0xFF)));
-
-        // Blend with mask
-        dstColor_x4 = _mm_or_si128(_mm_and_si128(mask_x4, dstColor_x4), _mm_andnot_si128(mask_x4, topColor_x4));
-
-        // Write
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
-    }
-    #endif
-#elif defined(_M_ARM64) || defined(__aarch64__)
-    // Four pixels at a time
-    const uint8x16_t ratio_x4 = vdupq_n_u8(ratio);
-    for (; (i + 4) < dest.size(); i += 4) {
-        // Load four mask values and expand each byte into 32-bit 000... or 111...
-        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
-        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
-        mask_x4 = vnegq_s32(mask_x4);
-
-        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
-        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
-
-        const uint16x8_t topColor16lo = vmovl_u8(vget_low_u8(topColor_x4));
-        const uint16x8_t btmColor16lo = vmovl_u8(vget_low_u8(btmColor_x4));
-
-        const uint16x8_t topColor16hi = vmovl_high_u8(topColor_x4);
-        const uint16x8_t btmColor16hi = vmovl_high_u8(btmColor_x4);
-
-        // Composite
-        int16x8_t composite16lo = vsubq_s16(topColor16lo, btmColor16lo);
-        int16x8_t composite16hi = vsubq_s16(topColor16hi, btmColor16hi);
-
-        composite16lo = vmulq_u16(composite16lo, vmovl_u8(vget_low_s8(ratio_x4)));
-        composite16hi = vmulq_u16(composite16hi, vmovl_high_u8(ratio_x4));
-
-        composite16lo = vsraq_n_s16(vmovl_s8(vget_low_s8(btmColor_x4)), composite16lo, 5);
-        composite16hi = vsraq_n_s16(vmovl_high_s8(btmColor_x4), composite16hi, 5);
-
-        int8x16_t composite_x4 = vmovn_high_s16(vmovn_s16(composite16lo), composite16hi);
-
-        // Blend with mask
-        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, composite_x4, topColor_x4);
-
-        // Write
-        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
-    }
-#endif
-
-    for (; i < dest.size(); i++) {
-        const Color888 &topColor = topColors[i];
-        const Color888 &btmColor = btmColors[i];
-        Color888 &dstColor = dest[i];
-        if (mask[i]) {
-            dstColor.r = btmColor.r + ((int)topColor.r - (int)btmColor.r) * ratio / 32;
-            dstColor.g = btmColor.g + ((int)topColor.g - (int)btmColor.g) * ratio / 32;
-            dstColor.b = btmColor.b + ((int)topColor.b - (int)btmColor.b) * ratio / 32;
-        } else {
-            dstColor = topColor;
-        }
-    }
-}
-
 template <bool deinterlace, bool transparentMeshes>
 FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
     const VDP2Regs &regs = VDP2GetRegs();
@@ -5077,12 +4259,12 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
 
         const LayerState &state = m_layerStates[altField][layer];
 
-        if (AllBool(std::span{state.pixels.transparent}.first(m_HRes))) {
+        if (m_kernels->AllBool(std::span{state.pixels.transparent}.first(m_HRes))) {
             // All pixels are transparent
             continue;
         }
 
-        if (AllZeroU8(std::span{state.pixels.priority}.first(m_HRes))) {
+        if (m_kernels->AllZeroU8(std::span{state.pixels.priority}.first(m_HRes))) {
             // All priorities are zero
             continue;
         }
@@ -5127,8 +4309,9 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
     if constexpr (transparentMeshes) {
         std::fill_n(scanline_meshLayers.begin(), m_HRes, 0xFF);
 
-        if (m_layerEnabled[0] && !AllBool(std::span{m_meshLayerState[altField].pixels.transparent}.first(m_HRes)) &&
-            !AllZeroU8(std::span{m_meshLayerState[altField].pixels.priority}.first(m_HRes))) {
+        if (m_layerEnabled[0] &&
+            !m_kernels->AllBool(std::span{m_meshLayerState[altField].pixels.transparent}.first(m_HRes)) &&
+            !m_kernels->AllZeroU8(std::span{m_meshLayerState[altField].pixels.priority}.first(m_HRes))) {
 
             for (uint32 x = 0; x < m_HRes; x++) {
                 if (m_meshLayerState[altField].pixels.transparent[x]) {
@@ -5222,7 +4405,7 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
 
     const std::span<Color888> framebufferOutput(reinterpret_cast<Color888 *>(&m_framebuffer[y * m_HRes]), m_HRes);
 
-    if (AnyBool(std::span{layer0ColorCalcEnabled}.first(m_HRes))) {
+    if (m_kernels->AnyBool(std::span{layer0ColorCalcEnabled}.first(m_HRes))) {
         // Gather pixels for layer 1
         alignas(16) std::array<Color888, kMaxResH> layer1Pixels;
         alignas(16) std::array<bool, kMaxResH> layer1BlendMeshLayer;
@@ -5286,24 +4469,24 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
             // Blend layer 2 with sprite mesh layer colors
             // TODO: apply color calculation effects
             if constexpr (transparentMeshes) {
-                Color888AverageMasked(std::span{layer2Pixels}.first(m_HRes), layer2BlendMeshLayer, layer2Pixels,
-                                      m_meshLayerState[altField].pixels.color);
+                m_kernels->Color888AverageMasked(std::span{layer2Pixels}.first(m_HRes), layer2BlendMeshLayer,
+                                                 layer2Pixels, m_meshLayerState[altField].pixels.color);
             }
 
             // TODO: honor color RAM mode + palette/RGB format restrictions
             // - modes 1 and 2 don't blend layers if the bottom layer uses palette color
             // HACK: assuming color RAM mode 0 for now (aka no restrictions)
-            Color888AverageMasked(std::span{layer1Pixels}.first(m_HRes), layer1ColorCalcEnabled, layer1Pixels,
-                                  layer2Pixels);
+            m_kernels->Color888AverageMasked(std::span{layer1Pixels}.first(m_HRes), layer1ColorCalcEnabled,
+                                             layer1Pixels, layer2Pixels);
 
             if (regs.lineScreenParams.colorCalcEnable) {
                 // Blend line color if top layer uses it
-                Color888AverageMasked(std::span{layer1Pixels}.first(m_HRes), layer0LineColorEnabled, layer1Pixels,
-                                      layer0LineColors);
+                m_kernels->Color888AverageMasked(std::span{layer1Pixels}.first(m_HRes), layer0LineColorEnabled,
+                                                 layer1Pixels, layer0LineColors);
             } else {
                 // Replace with line color if top layer uses it
-                Color888SelectMasked(std::span{layer1Pixels}.first(m_HRes), layer0LineColorEnabled, layer1Pixels,
-                                     layer0LineColors);
+                m_kernels->Color888SelectMasked(std::span{layer1Pixels}.first(m_HRes), layer0LineColorEnabled,
+                                                layer1Pixels, layer0LineColors);
             }
         } else {
             // Replace layer 1 pixels with line color screen where applicable
@@ -5317,14 +4500,14 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
         // Blend layer 1 with sprite mesh layer colors
         // TODO: apply color calculation effects
         if constexpr (transparentMeshes) {
-            Color888AverageMasked(std::span{layer1Pixels}.first(m_HRes), layer1BlendMeshLayer, layer1Pixels,
-                                  m_meshLayerState[altField].pixels.color);
+            m_kernels->Color888AverageMasked(std::span{layer1Pixels}.first(m_HRes), layer1BlendMeshLayer, layer1Pixels,
+                                             m_meshLayerState[altField].pixels.color);
         }
 
         // Blend layer 0 and layer 1
         if (colorCalcParams.useAdditiveBlend) {
             // Saturated add
-            Color888SatAddMasked(framebufferOutput, layer0ColorCalcEnabled, layer0Pixels, layer1Pixels);
+            m_kernels->Color888SatAddMasked(framebufferOutput, layer0ColorCalcEnabled, layer0Pixels, layer1Pixels);
         } else {
             // Gather color ratio info
             alignas(16) std::array<uint8, kMaxResH> scanline_ratio;
@@ -5346,8 +4529,8 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
             }
 
             // Alpha composite
-            Color888CompositeRatioPerPixelMasked(framebufferOutput, layer0ColorCalcEnabled, layer0Pixels, layer1Pixels,
-                                                 scanline_ratio);
+            m_kernels->Color888CompositeRatioPerPixelMasked(framebufferOutput, layer0ColorCalcEnabled, layer0Pixels,
+                                                            layer1Pixels, scanline_ratio);
         }
     } else {
         std::copy_n(layer0Pixels.cbegin(), framebufferOutput.size(), framebufferOutput.begin());
@@ -5356,8 +4539,8 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
     // Blend layer 0 with sprite mesh layer colors
     // TODO: apply color calculation effects
     if constexpr (transparentMeshes) {
-        Color888AverageMasked(framebufferOutput, layer0BlendMeshLayer, framebufferOutput,
-                              m_meshLayerState[altField].pixels.color);
+        m_kernels->Color888AverageMasked(framebufferOutput, layer0BlendMeshLayer, framebufferOutput,
+                                         m_meshLayerState[altField].pixels.color);
     }
 
     // Gather shadow data
@@ -5387,8 +4570,8 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
 
     // Apply sprite shadow
     // TODO: apply shadow from mesh layer
-    if (AnyBool(std::span{layer0ShadowEnabled}.first(m_HRes))) {
-        Color888ShadowMasked(framebufferOutput, layer0ShadowEnabled);
+    if (m_kernels->AnyBool(std::span{layer0ShadowEnabled}.first(m_HRes))) {
+        m_kernels->Color888ShadowMasked(framebufferOutput, layer0ShadowEnabled);
     }
 
     // Gather color offset info
@@ -5398,7 +4581,7 @@ FORCE_INLINE void VDP::VDP2ComposeLine(uint32 y, bool altField) {
     }
 
     // Apply color offset if enabled
-    if (AnyBool(std::span{layer0ColorOffsetEnabled}.first(m_HRes))) {
+    if (m_kernels->AnyBool(std::span{layer0ColorOffsetEnabled}.first(m_HRes))) {
         for (uint32 x = 0; Color888 &outputColor : framebufferOutput) {
             if (layer0ColorOffsetEnabled[x]) {
                 const auto &colorOffset = regs.colorOffset[regs.colorOffsetSelect[scanline_layers[x][0]]];
@@ -0,0 +1,59 @@
+#define YMIR_VDP_KERNELS_NS baseline
+#include "vdp_kernels_impl.hpp"
+
+namespace ymir::vdp {
+
+namespace kernels {
+
+    // Defined in the vdp_kernels_<isa>.cpp translation units.
+    // Each returns nullptr if the build does not compile that instruction set.
+    const VDPKernels *GetSSE41Kernels();
+    const VDPKernels *GetAVX2Kernels();
+    const VDPKernels *GetAVX512Kernels();
+
+    // The instruction set enabled by the global compiler flags
+    inline constexpr util::SIMDLevel kBaselineLevel =
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+        util::SIMDLevel::AVX512;
+#elif defined(__AVX2__)
+        util::SIMDLevel::AVX2;
+#elif defined(__SSE4_1__)
+        util::SIMDLevel::SSE41;
+#elif defined(_M_X64) || defined(__x86_64__)
+        util::SIMDLevel::SSE2;
+#elif defined(_M_ARM64) || defined(__aarch64__)
+        util::SIMDLevel::NEON;
+#else
+        util::SIMDLevel::Scalar;
+#endif
+
+    static constexpr VDPKernels kBaselineKernels = baseline::MakeKernels(kBaselineLevel);
+
+} // namespace kernels
+
+const VDPKernels &GetVDPKernels(util::SIMDLevel level) {
+#if defined(_M_X64) || defined(__x86_64__)
+    // NEON and Scalar are not x86 levels
+    if (level == util::SIMDLevel::NEON || level == util::SIMDLevel::Scalar) {
+        return kernels::kBaselineKernels;
+    }
+
+    // Pick the most capable instruction set that does not exceed the requested level and improves on the baseline
+    const VDPKernels *selected = nullptr;
+    if (level >= util::SIMDLevel::AVX512) {
+        selected = kernels::GetAVX512Kernels();
+    }
+    if (selected == nullptr && level >= util::SIMDLevel::AVX2) {
+        selected = kernels::GetAVX2Kernels();
+    }
+    if (selected == nullptr && level >= util::SIMDLevel::SSE41) {
+        selected = kernels::GetSSE41Kernels();
+    }
+    if (selected != nullptr && selected->level > kernels::kBaselineLevel) {
+        return *selected;
+    }
+#endif
+    return kernels::kBaselineKernels;
+}
+
+} // namespace ymir::vdp
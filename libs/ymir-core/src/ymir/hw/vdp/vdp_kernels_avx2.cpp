@@ -0,0 +1,15 @@
+#define YMIR_VDP_KERNELS_NS avx2
+#include "vdp_kernels_impl.hpp"
+
+namespace ymir::vdp::kernels {
+
+const VDPKernels *GetAVX2Kernels() {
+#if defined(__AVX2__)
+    static constexpr VDPKernels kKernels = avx2::MakeKernels(util::SIMDLevel::AVX2);
+    return &kKernels;
+#else
+    return nullptr;
+#endif
+}
+
+} // namespace ymir::vdp::kernels
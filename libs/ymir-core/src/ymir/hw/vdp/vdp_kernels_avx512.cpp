@@ -0,0 +1,15 @@
+#define YMIR_VDP_KERNELS_NS avx512
+#include "vdp_kernels_impl.hpp"
+
+namespace ymir::vdp::kernels {
+
+const VDPKernels *GetAVX512Kernels() {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    static constexpr VDPKernels kKernels = avx512::MakeKernels(util::SIMDLevel::AVX512);
+    return &kKernels;
+#else
+    return nullptr;
+#endif
+}
+
+} // namespace ymir::vdp::kernels
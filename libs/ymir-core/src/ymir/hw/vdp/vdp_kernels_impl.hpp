@@ -0,0 +1,1035 @@
+#pragma once
+
+// VDP rendering kernels, compiled once per supported instruction set.
+//
+// Each vdp_kernels*.cpp translation unit defines YMIR_VDP_KERNELS_NS to a unique namespace name and includes this
+// file, so that the same source is compiled with different instruction set flags. The SIMD paths are selected with
+// the usual compiler-defined macros (__SSE4_1__, __AVX2__, __AVX512BW__, ...), which reflect the flags of the
+// including translation unit.
+//
+// Everything here must have internal linkage or be force-inlined. Out-of-line copies of inline functions compiled
+// with wider instruction sets could otherwise be picked by the linker for callers on hosts that lack them.
+
+#include <ymir/hw/vdp/vdp_kernels.hpp>
+
+#include <algorithm>
+#include <span>
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #include <immintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
+#ifndef YMIR_VDP_KERNELS_NS
+    #error "YMIR_VDP_KERNELS_NS must be defined before including vdp_kernels_impl.hpp"
+#endif
+
+namespace ymir::vdp::kernels::YMIR_VDP_KERNELS_NS {
+
+namespace {
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+// Loads four mask values and expands each byte into 32-bit 000... or 111...
+FORCE_INLINE __m128i ExpandMask_x4(const bool *mask) {
+    #if defined(__SSE4_1__)
+    return _mm_sub_epi32(_mm_setzero_si128(), _mm_cvtepu8_epi32(_mm_loadu_si32(mask)));
+    #else
+    __m128i mask_x4 = _mm_loadu_si32(mask);
+    mask_x4 = _mm_unpacklo_epi8(mask_x4, _mm_setzero_si128());
+    mask_x4 = _mm_unpacklo_epi16(mask_x4, _mm_setzero_si128());
+    return _mm_sub_epi32(_mm_setzero_si128(), mask_x4);
+    #endif
+}
+
+// Selects bytes from b where the mask is set, or from a otherwise
+FORCE_INLINE __m128i Blend_x4(__m128i a, __m128i b, __m128i mask) {
+    #if defined(__SSE4_1__)
+    return _mm_blendv_epi8(a, b, mask);
+    #else
+    return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+    #endif
+}
+
+    #if defined(__AVX512BW__) && defined(__AVX512VL__)
+// Loads sixteen mask values into a 16-bit lane mask
+FORCE_INLINE __mmask16 LoadMask_x16(const bool *mask) {
+    const __m128i mask_x16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask));
+    return _mm_test_epi8_mask(mask_x16, mask_x16);
+}
+    #endif
+
+#endif
+
+// Tests if an array of uint8 values are all zeroes
+bool AllZeroU8(std::span<const uint8> values) {
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+    #if defined(__AVX512BW__)
+    // 64 at a time
+    for (; values.size() >= 64; values = values.subspan(64)) {
+        const __m512i vec64 = _mm512_loadu_si512(values.data());
+
+        // If any byte is not zero, we have a true value
+        if (_mm512_test_epi8_mask(vec64, vec64) != 0u) {
+            return false;
+        }
+    }
+    #endif
+
+    #if defined(__AVX__)
+    // 32 at a time
+    for (; values.size() >= 32; values = values.subspan(32)) {
+        const __m256i vec32 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values.data()));
+
+        // Test if all bits are 0
+        if (!_mm256_testz_si256(vec32, vec32)) {
+            return false;
+        }
+    }
+    #endif
+
+    #if defined(__SSE2__)
+    // 16 at a time
+    for (; values.size() >= 16; values = values.subspan(16)) {
+        __m128i vec16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values.data()));
+
+        // Compare to zero
+        vec16 = _mm_cmpeq_epi8(vec16, _mm_setzero_si128());
+
+        // Extract MSB all into a 16-bit mask, if any bit is clear, then we have a true value
+        if (_mm_movemask_epi8(vec16) != 0xFFFF) {
+            return false;
+        }
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // 64 at a time
+    for (; values.size() >= 64; values = values.subspan(64)) {
+        const uint8x16x4_t vec64 = vld1q_u8_x4(reinterpret_cast<const uint8 *>(values.data()));
+
+        // If the largest value is not zero, we have a true value
+        if ((vmaxvq_u8(vec64.val[0]) != 0u) || (vmaxvq_u8(vec64.val[1]) != 0u) || (vmaxvq_u8(vec64.val[2]) != 0u) ||
+            (vmaxvq_u8(vec64.val[3]) != 0u)) {
+            return false;
+        }
+    }
+
+    // 16 at a time
+    for (; values.size() >= 16; values = values.subspan(16)) {
+        const uint8x16_t vec16 = vld1q_u8(reinterpret_cast<const uint8 *>(values.data()));
+
+        // If the largest value is not zero, we have a true value
+        if (vmaxvq_u8(vec16) != 0u) {
+            return false;
+        }
+    }
+#elif defined(__clang__) || defined(__GNUC__)
+    // 16 at a time
+    for (; values.size() >= sizeof(__int128); values = values.subspan(sizeof(__int128))) {
+        const __int128 &vec16 = *reinterpret_cast<const __int128 *>(values.data());
+
+        if (vec16 != __int128(0)) {
+            return false;
+        }
+    }
+#endif
+
+    // 8 at a time
+    for (; values.size() >= sizeof(uint64); values = values.subspan(sizeof(uint64))) {
+        const uint64 &vec8 = *reinterpret_cast<const uint64 *>(values.data());
+
+        if (vec8 != 0ull) {
+            return false;
+        }
+    }
+
+    // 4 at a time
+    for (; values.size() >= sizeof(uint32); values = values.subspan(sizeof(uint32))) {
+        const uint32 &vec4 = *reinterpret_cast<const uint32 *>(values.data());
+
+        if (vec4 != 0u) {
+            return false;
+        }
+    }
+
+    for (const uint8 &value : values) {
+        if (value != 0u) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Tests if an array of bool values are all true
+bool AllBool(std::span<const bool> values) {
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(__AVX512BW__)
+    // 64 at a time
+    for (; values.size() >= 64; values = values.subspan(64)) {
+        const __m512i vec64 = _mm512_loadu_si512(values.data());
+
+        // If any byte is zero, then we have a false value
+        if (_mm512_cmpeq_epi8_mask(vec64, _mm512_setzero_si512()) != 0u) {
+            return false;
+        }
+    }
+    #endif
+
+    #if defined(__AVX__)
+    // 32 at a time
+    for (; values.size() >= 32; values = values.subspan(32)) {
+        __m256i vec32 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values.data()));
+
+        // Move bit 0 into the MSB
+        vec32 = _mm256_slli_epi64(vec32, 7);
+
+        // Extract 32 MSBs into a 32-bit mask, if any bit is zero, then we have a false value
+        if (_mm256_movemask_epi8(vec32) != 0xFFFF'FFFF) {
+            return false;
+        }
+    }
+    #endif
+
+    #if defined(__SSE2__)
+    // 16 at a time
+    for (; values.size() >= 16; values = values.subspan(16)) {
+        __m128i vec16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values.data()));
+
+        // Move bit 0 into the MSB
+        vec16 = _mm_slli_epi64(vec16, 7);
+
+        // Extract 16 MSBs into a 32-bit mask, if any bit is zero, then we have a false value
+        if (_mm_movemask_epi8(vec16) != 0xFFFF) {
+            return false;
+        }
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // 64 at a time
+    for (; values.size() >= 64; values = values.subspan(64)) {
+        const uint8x16x4_t vec64 = vld1q_u8_x4(reinterpret_cast<const uint8 *>(values.data()));
+
+        // If the smallest value is zero, then we have a false value
+        if ((vminvq_u8(vec64.val[0]) == 0u) || (vminvq_u8(vec64.val[1]) == 0u) || (vminvq_u8(vec64.val[2]) == 0u) ||
+            (vminvq_u8(vec64.val[3]) == 0u)) {
+            return false;
+        }
+    }
+    // 16 at a time
+    for (; values.size() >= 16; values = values.subspan(16)) {
+        const uint8x16_t vec16 = vld1q_u8(reinterpret_cast<const uint8 *>(values.data()));
+
+        // If the smallest value is zero, then we have a false value
+        if (vminvq_u8(vec16) == 0u) {
+            return false;
+        }
+    }
+#elif defined(__clang__) || defined(__GNUC__)
+    // 16 at a time
+    for (; values.size() >= sizeof(__int128); values = values.subspan(sizeof(__int128))) {
+        const __int128 &vec16 = *reinterpret_cast<const __int128 *>(values.data());
+
+        if (vec16 != __int128((__int128(0x01'01'01'01'01'01'01'01) << 64) | 0x01'01'01'01'01'01'01'01)) {
+            return false;
+        }
+    }
+#endif
+
+    // 8 at a time
+    for (; values.size() >= sizeof(uint64); values = values.subspan(sizeof(uint64))) {
+        const uint64 &vec8 = *reinterpret_cast<const uint64 *>(values.data());
+
+        if (vec8 != 0x01'01'01'01'01'01'01'01) {
+            return false;
+        }
+    }
+
+    // 4 at a time
+    for (; values.size() >= sizeof(uint32); values = values.subspan(sizeof(uint32))) {
+        const uint32 &vec4 = *reinterpret_cast<const uint32 *>(values.data());
+
+        if (vec4 != 0x01'01'01'01) {
+            return false;
+        }
+    }
+
+    for (const bool &value : values) {
+        if (!value) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Tests if an any element in an array of bools are true
+bool AnyBool(std::span<const bool> values) {
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(__AVX512BW__)
+    // 64 at a time
+    for (; values.size() >= 64; values = values.subspan(64)) {
+        const __m512i vec64 = _mm512_loadu_si512(values.data());
+
+        // If any byte is not zero, then we have a true value
+        if (_mm512_test_epi8_mask(vec64, vec64) != 0u) {
+            return true;
+        }
+    }
+    #endif
+
+    #if defined(__AVX__)
+    // 32 at a time
+    for (; values.size() >= 32; values = values.subspan(32)) {
+        __m256i vec32 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values.data()));
+
+        // Move bit 0 into the MSB
+        vec32 = _mm256_slli_epi64(vec32, 7);
+
+        // Extract MSB into a 32-bit mask, if any bit is set, then we have a true value
+        if (_mm256_movemask_epi8(vec32) != 0u) {
+            return true;
+        }
+    }
+    #endif
+    #if defined(__SSE2__)
+    // 16 at a time
+    for (; values.size() >= 16; values = values.subspan(16)) {
+        __m128i vec16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values.data()));
+
+        // Move bit 0 into the MSB
+        vec16 = _mm_slli_epi64(vec16, 7);
+
+        // Extract MSB into a 16-bit mask, if any bit is set, then we have a true value
+        if (_mm_movemask_epi8(vec16) != 0u) {
+            return true;
+        }
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // 64 at a time
+    for (; values.size() >= 64; values = values.subspan(64)) {
+        const uint8x16x4_t vec64 = vld1q_u8_x4(reinterpret_cast<const uint8 *>(values.data()));
+
+        // If the smallest value is not zero, then we have a true value
+        if ((vmaxvq_u8(vec64.val[0]) != 0u) || (vmaxvq_u8(vec64.val[1]) != 0u) || (vmaxvq_u8(vec64.val[2]) != 0u) ||
+            (vmaxvq_u8(vec64.val[3]) != 0u)) {
+            return true;
+        }
+    }
+
+    // 16 at a time
+    for (; values.size() >= 16; values = values.subspan(16)) {
+        const uint8x16_t vec16 = vld1q_u8(reinterpret_cast<const uint8 *>(values.data()));
+
+        // If the smallest value is not zero, then we have a true value
+        if (vmaxvq_u8(vec16) != 0u) {
+            return true;
+        }
+    }
+#elif defined(__clang__) || defined(__GNUC__)
+    // 16 at a time
+    for (; values.size() >= sizeof(__int128); values = values.subspan(sizeof(__int128))) {
+        const __int128 &vec16 = *reinterpret_cast<const __int128 *>(values.data());
+
+        if (vec16) {
+            return true;
+        }
+    }
+#endif
+
+    // 8 at a time
+    for (; values.size() >= sizeof(uint64); values = values.subspan(sizeof(uint64))) {
+        const uint64 &vec8 = *reinterpret_cast<const uint64 *>(values.data());
+
+        if (vec8) {
+            return true;
+        }
+    }
+
+    // 4 at a time
+    for (; values.size() >= sizeof(uint32); values = values.subspan(sizeof(uint32))) {
+        const uint32 &vec4 = *reinterpret_cast<const uint32 *>(values.data());
+
+        if (vec4) {
+            return true;
+        }
+    }
+
+    for (const bool &value : values) {
+        if (value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Color888ShadowMasked(const std::span<Color888> pixels, const std::span<const bool, kMaxResH> mask) {
+    size_t i = 0;
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(__AVX512BW__) && defined(__AVX512VL__)
+    // Sixteen pixels at a time
+    for (; (i + 16) < pixels.size(); i += 16) {
+        const __mmask16 mask_x16 = LoadMask_x16(mask.data() + i);
+
+        const __m512i pixel_x16 = _mm512_loadu_si512(&pixels[i]);
+
+        __m512i shadowed_x16 = _mm512_srli_epi32(pixel_x16, 1);
+        shadowed_x16 = _mm512_and_si512(shadowed_x16, _mm512_set1_epi8(0x7F));
+
+        // Write only the masked pixels
+        _mm512_mask_storeu_epi32(&pixels[i], mask_x16, shadowed_x16);
+    }
+    #endif
+
+    #if defined(__AVX2__)
+    // Eight pixels at a time
+    for (; (i + 8) < pixels.size(); i += 8) {
+        // Load eight mask bytes into 32-bit lanes of 000... or 111...
+        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
+        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
+
+        const __m256i pixel_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&pixels[i]));
+
+        __m256i shadowed_x8 = _mm256_srli_epi32(pixel_x8, 1);
+        shadowed_x8 = _mm256_and_si256(shadowed_x8, _mm256_set1_epi8(0x7F));
+
+        // Blend with mask
+        const __m256i dstColor_x8 = _mm256_blendv_epi8(pixel_x8, shadowed_x8, mask_x8);
+
+        // Write
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&pixels[i]), dstColor_x8);
+    }
+    #endif
+
+    #if defined(__SSE2__)
+    // Four pixels at a time
+    for (; (i + 4) < pixels.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        const __m128i mask_x4 = ExpandMask_x4(mask.data() + i);
+
+        const __m128i pixel_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pixels[i]));
+
+        __m128i shadowed_x4 = _mm_srli_epi64(pixel_x4, 1);
+
+        shadowed_x4 = _mm_and_si128(shadowed_x4, _mm_set1_epi8(0x7F));
+
+        // Blend with mask
+        const __m128i dstColor_x4 = Blend_x4(pixel_x4, shadowed_x4, mask_x4);
+
+        // Write
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&pixels[i]), dstColor_x4);
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // Four pixels at a time
+    for (; (i + 4) < pixels.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
+        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
+        mask_x4 = vnegq_s32(mask_x4);
+
+        const uint32x4_t pixel_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&pixels[i]));
+        const uint32x4_t shadowed_x4 = vshrq_n_u8(pixel_x4, 1);
+
+        // Blend with mask
+        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, shadowed_x4, pixel_x4);
+
+        // Write
+        vst1q_u32(reinterpret_cast<uint32 *>(&pixels[i]), dstColor_x4);
+    }
+#endif
+
+    for (; i < pixels.size(); i++) {
+        Color888 &pixel = pixels[i];
+        if (mask[i]) {
+            pixel.u32 >>= 1;
+            pixel.u32 &= 0x7F'7F'7F'7F;
+        }
+    }
+}
+
+void Color888SatAddMasked(const std::span<Color888> dest, const std::span<const bool, kMaxResH> mask,
+                                       const std::span<const Color888, kMaxResH> topColors,
+                                       const std::span<const Color888, kMaxResH> btmColors) {
+    size_t i = 0;
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+    #if defined(__AVX512BW__) && defined(__AVX512VL__)
+    // Sixteen pixels at a time
+    for (; (i + 16) < dest.size(); i += 16) {
+        const __mmask16 mask_x16 = LoadMask_x16(mask.data() + i);
+
+        const __m512i topColor_x16 = _mm512_loadu_si512(&topColors[i]);
+        const __m512i btmColor_x16 = _mm512_loadu_si512(&btmColors[i]);
+
+        // Saturated add
+        const __m512i sum_x16 = _mm512_adds_epu8(topColor_x16, btmColor_x16);
+
+        // Blend with mask and write
+        _mm512_storeu_si512(&dest[i], _mm512_mask_blend_epi32(mask_x16, topColor_x16, sum_x16));
+    }
+    #endif
+
+    #if defined(__AVX2__)
+    // Eight pixels at a time
+    for (; (i + 8) < dest.size(); i += 8) {
+        // Load eight mask bytes into 32-bit lanes of 000... or 111...
+        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
+        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
+
+        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
+        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
+
+        // Pack back into 8-bit values, be sure to truncate to avoid saturation
+        __m256i dstColor_x8 = _mm256_adds_epu8(topColor_x8, btmColor_x8);
+
+        // Blend with mask
+        dstColor_x8 = _mm256_blendv_epi8(topColor_x8, dstColor_x8, mask_x8);
+
+        // Write
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
+    }
+    #endif
+
+    #if defined(__SSE2__)
+    // Four pixels at a time
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        const __m128i mask_x4 = ExpandMask_x4(mask.data() + i);
+
+        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
+        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
+
+        // Saturated add
+        __m128i dstColor_x4 = _mm_adds_epu8(topColor_x4, btmColor_x4);
+
+        // Blend with mask
+        dstColor_x4 = Blend_x4(topColor_x4, dstColor_x4, mask_x4);
+
+        // Write
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // Four pixels at a time
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
+        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
+        mask_x4 = vnegq_s32(mask_x4);
+
+        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
+        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
+
+        // Saturated add
+        const uint32x4_t add_x4 = vqaddq_u8(topColor_x4, btmColor_x4);
+
+        // Blend with mask
+        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, add_x4, topColor_x4);
+
+        // Write
+        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
+    }
+#endif
+
+    for (; i < dest.size(); i++) {
+        const Color888 &topColor = topColors[i];
+        const Color888 &btmColor = btmColors[i];
+        Color888 &dstColor = dest[i];
+        if (mask[i]) {
+            dstColor.r = std::min<uint16>(topColor.r + btmColor.r, 255u);
+            dstColor.g = std::min<uint16>(topColor.g + btmColor.g, 255u);
+            dstColor.b = std::min<uint16>(topColor.b + btmColor.b, 255u);
+        } else {
+            dstColor = topColor;
+        }
+    }
+}
+
+void Color888SelectMasked(const std::span<Color888> dest, const std::span<const bool, kMaxResH> mask,
+                                       const std::span<const Color888> topColors,
+                                       const std::span<const Color888, kMaxResH> btmColors) {
+    size_t i = 0;
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(__AVX512BW__) && defined(__AVX512VL__)
+    // Sixteen pixels at a time
+    for (; (i + 16) < dest.size(); i += 16) {
+        const __mmask16 mask_x16 = LoadMask_x16(mask.data() + i);
+
+        const __m512i topColor_x16 = _mm512_loadu_si512(&topColors[i]);
+        const __m512i btmColor_x16 = _mm512_loadu_si512(&btmColors[i]);
+
+        // Blend with mask and write
+        _mm512_storeu_si512(&dest[i], _mm512_mask_blend_epi32(mask_x16, topColor_x16, btmColor_x16));
+    }
+    #endif
+
+    #if defined(__AVX2__)
+    // Eight pixels at a time
+    for (; (i + 8) < dest.size(); i += 8) {
+        // Load eight mask bytes into 32-bit lanes of 000... or 111...
+        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
+        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
+
+        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
+        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
+
+        // Blend with mask
+        const __m256i dstColor_x8 = _mm256_blendv_epi8(topColor_x8, btmColor_x8, mask_x8);
+
+        // Write
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
+    }
+    #endif
+
+    #if defined(__SSE2__)
+    // Four pixels at a time
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        const __m128i mask_x4 = ExpandMask_x4(mask.data() + i);
+
+        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
+        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
+
+        // Blend with mask
+        const __m128i dstColor_x4 = Blend_x4(topColor_x4, btmColor_x4, mask_x4);
+
+        // Write
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // Four pixels at a time
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
+        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
+        mask_x4 = vnegq_s32(mask_x4);
+
+        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
+        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
+
+        // Blend with mask
+        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, btmColor_x4, topColor_x4);
+
+        // Write
+        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
+    }
+#endif
+
+    for (; i < dest.size(); i++) {
+        dest[i] = mask[i] ? btmColors[i] : topColors[i];
+    }
+}
+
+void Color888AverageMasked(const std::span<Color888> dest, const std::span<const bool, kMaxResH> mask,
+                                        const std::span<const Color888> topColors,
+                                        const std::span<const Color888, kMaxResH> btmColors) {
+    size_t i = 0;
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(__AVX512BW__) && defined(__AVX512VL__)
+    // Sixteen pixels at a time
+    for (; (i + 16) < dest.size(); i += 16) {
+        const __mmask16 mask_x16 = LoadMask_x16(mask.data() + i);
+
+        const __m512i topColor_x16 = _mm512_loadu_si512(&topColors[i]);
+        const __m512i btmColor_x16 = _mm512_loadu_si512(&btmColors[i]);
+
+        const __m512i diff_x16 = _mm512_xor_si512(topColor_x16, btmColor_x16);
+        const __m512i halfDiff_x16 = _mm512_srli_epi32(_mm512_and_si512(diff_x16, _mm512_set1_epi8(0xFE)), 1);
+        const __m512i average_x16 = _mm512_add_epi32(halfDiff_x16, _mm512_and_si512(topColor_x16, btmColor_x16));
+
+        // Blend with mask and write
+        _mm512_storeu_si512(&dest[i], _mm512_mask_blend_epi32(mask_x16, topColor_x16, average_x16));
+    }
+    #endif
+
+    #if defined(__AVX2__)
+    // Eight pixels at a time
+    for (; (i + 8) < dest.size(); i += 8) {
+        // Load eight mask bytes into 32-bit lanes of 000... or 111...
+        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
+        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
+
+        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
+        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
+
+        const __m256i average_x8 = _mm256_add_epi32(
+            _mm256_srli_epi32(_mm256_and_si256(_mm256_xor_si256(topColor_x8, btmColor_x8), _mm256_set1_epi8(0xFE)), 1),
+            _mm256_and_si256(topColor_x8, btmColor_x8));
+
+        // Blend with mask
+        const __m256i dstColor_x8 = _mm256_blendv_epi8(topColor_x8, average_x8, mask_x8);
+
+        // Write
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
+    }
+    #endif
+
+    #if defined(__SSE2__)
+    // Four pixels at a time
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        const __m128i mask_x4 = ExpandMask_x4(mask.data() + i);
+
+        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
+        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
+
+        const __m128i average_x4 = _mm_add_epi32(
+            _mm_srli_epi32(_mm_and_si128(_mm_xor_si128(topColor_x4, btmColor_x4), _mm_set1_epi8(0xFE)), 1),
+            _mm_and_si128(topColor_x4, btmColor_x4));
+
+        // Blend with mask
+        const __m128i dstColor_x4 = Blend_x4(topColor_x4, average_x4, mask_x4);
+
+        // Write
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // Four pixels at a time
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
+        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
+        mask_x4 = vnegq_s32(mask_x4);
+
+        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
+        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
+
+        // Halving average
+        const uint32x4_t average_x4 = vhaddq_u8(topColor_x4, btmColor_x4);
+
+        // Blend with mask
+        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, average_x4, topColor_x4);
+
+        // Write
+        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
+    }
+#endif
+
+    for (; i < dest.size(); i++) {
+        const Color888 &topColor = topColors[i];
+        const Color888 &btmColor = btmColors[i];
+        Color888 &dstColor = dest[i];
+        if (mask[i]) {
+            dstColor = AverageRGB888(topColor, btmColor);
+        } else {
+            dstColor = topColor;
+        }
+    }
+}
+
+void Color888CompositeRatioPerPixelMasked(const std::span<Color888> dest, const std::span<const bool> mask,
+                                                       const std::span<const Color888, kMaxResH> topColors,
+                                                       const std::span<const Color888, kMaxResH> btmColors,
+                                                       const std::span<const uint8, kMaxResH> ratios) {
+    size_t i = 0;
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(__AVX2__)
+    // Eight pixels at a time
+    for (; (i + 8) < dest.size(); i += 8) {
+        // Load eightmask values and expand each byte into 32-bit 000... or 111...
+        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
+        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
+
+        // Load eight ratios and widen each byte into 32-bit lanes
+        // Put each byte into a 32-bit lane
+        __m256i ratio_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(&ratios[i]));
+        // Repeat the byte
+        ratio_x8 = _mm256_mullo_epi32(ratio_x8, _mm256_set1_epi32(0x01'01'01'01));
+
+        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
+        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
+
+        // Expand to 16-bit values
+        __m256i ratio16lo_x8 = _mm256_unpacklo_epi8(ratio_x8, _mm256_setzero_si256());
+        __m256i ratio16hi_x8 = _mm256_unpackhi_epi8(ratio_x8, _mm256_setzero_si256());
+
+        const __m256i topColor16lo = _mm256_unpacklo_epi8(topColor_x8, _mm256_setzero_si256());
+        const __m256i btmColor16lo = _mm256_unpacklo_epi8(btmColor_x8, _mm256_setzero_si256());
+
+        const __m256i topColor16hi = _mm256_unpackhi_epi8(topColor_x8, _mm256_setzero_si256());
+        const __m256i btmColor16hi = _mm256_unpackhi_epi8(btmColor_x8, _mm256_setzero_si256());
+
+        // Lerp
+        const __m256i dstColor16lo = _mm256_add_epi16(
+            btmColor16lo,
+            _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(topColor16lo, btmColor16lo), ratio16lo_x8), 5));
+        const __m256i dstColor16hi = _mm256_add_epi16(
+            btmColor16hi,
+            _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(topColor16hi, btmColor16hi), ratio16hi_x8), 5));
+
+        // Pack back into 8-bit values, be sure to truncate to avoid saturation
+        __m256i dstColor_x8 = _mm256_packus_epi16(_mm256_and_si256(dstColor16lo, _mm256_set1_epi16(0xFF)),
+                                                  _mm256_and_si256(dstColor16hi, _mm256_set1_epi16(0xFF)));
+
+        // Blend with mask
+        dstColor_x8 = _mm256_blendv_epi8(topColor_x8, dstColor_x8, mask_x8);
+
+        // Write
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
+    }
+    #endif
+
+    #if defined(__SSE2__)
+    // Four pixels at a time
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        const __m128i mask_x4 = ExpandMask_x4(mask.data() + i);
+
+        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
+        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
+
+        // Load four ratios and splat each byte into 32-bit lanes
+        __m128i ratio_x4 = _mm_loadu_si32(&ratios[i]);
+        ratio_x4 = _mm_unpacklo_epi8(ratio_x4, ratio_x4);
+        ratio_x4 = _mm_unpacklo_epi16(ratio_x4, ratio_x4);
+
+        // Expand to 16-bit values
+        const __m128i ratio16lo_x4 = _mm_unpacklo_epi8(ratio_x4, _mm_setzero_si128());
+        const __m128i ratio16hi_x4 = _mm_unpackhi_epi8(ratio_x4, _mm_setzero_si128());
+
+        const __m128i topColor16lo = _mm_unpacklo_epi8(topColor_x4, _mm_setzero_si128());
+        const __m128i btmColor16lo = _mm_unpacklo_epi8(btmColor_x4, _mm_setzero_si128());
+
+        const __m128i topColor16hi = _mm_unpackhi_epi8(topColor_x4, _mm_setzero_si128());
+        const __m128i btmColor16hi = _mm_unpackhi_epi8(btmColor_x4, _mm_setzero_si128());
+
+        // Composite
+        const __m128i dstColor16lo = _mm_add_epi16(
+            btmColor16lo, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(topColor16lo, btmColor16lo), ratio16lo_x4), 5));
+        const __m128i dstColor16hi = _mm_add_epi16(
+            btmColor16hi, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(topColor16hi, btmColor16hi), ratio16hi_x4), 5));
+
+        // Pack back into 8-bit values, be sure to truncate to avoid saturation
+        __m128i dstColor_x4 = _mm_packus_epi16(_mm_and_si128(dstColor16lo, _mm_set1_epi16(0xFF)),
+                                               _mm_and_si128(dstColor16hi, _mm_set1_epi16(0xFF)));
+
+        // Blend with mask
+        dstColor_x4 = Blend_x4(topColor_x4, dstColor_x4, mask_x4);
+
+        // Write
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // Four pixels at a time
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
+        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
+        mask_x4 = vnegq_s32(mask_x4);
+
+        // Load four ratios and splat each byte into 32-bit lanes
+        uint32x4_t ratio_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(ratios.data() + i), vdupq_n_u32(0), 0);
+        // 8 -> 16
+        ratio_x4 = vzip1q_u8(ratio_x4, ratio_x4);
+        // 16 -> 32
+        ratio_x4 = vzip1q_u16(ratio_x4, ratio_x4);
+
+        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
+        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
+
+        const uint16x8_t topColor16lo = vmovl_u8(vget_low_u8(topColor_x4));
+        const uint16x8_t btmColor16lo = vmovl_u8(vget_low_u8(btmColor_x4));
+
+        const uint16x8_t topColor16hi = vmovl_high_u8(topColor_x4);
+        const uint16x8_t btmColor16hi = vmovl_high_u8(btmColor_x4);
+
+        // Composite
+        int16x8_t composite16lo = vsubq_s16(topColor16lo, btmColor16lo);
+        int16x8_t composite16hi = vsubq_s16(topColor16hi, btmColor16hi);
+
+        composite16lo = vmulq_u16(composite16lo, vmovl_u8(vget_low_s8(ratio_x4)));
+        composite16hi = vmulq_u16(composite16hi, vmovl_high_u8(ratio_x4));
+
+        composite16lo = vsraq_n_s16(vmovl_s8(vget_low_s8(btmColor_x4)), composite16lo, 5);
+        composite16hi = vsraq_n_s16(vmovl_high_s8(btmColor_x4), composite16hi, 5);
+
+        int8x16_t composite_x4 = vmovn_high_s16(vmovn_s16(composite16lo), composite16hi);
+
+        // Blend with mask
+        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, composite_x4, topColor_x4);
+
+        // Write
+        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
+    }
+#endif
+
+    for (; i < dest.size(); i++) {
+        const Color888 &topColor = topColors[i];
+        const Color888 &btmColor = btmColors[i];
+        const uint8 &ratio = ratios[i];
+        Color888 &dstColor = dest[i];
+        if (mask[i]) {
+            dstColor.r = btmColor.r + ((int)topColor.r - (int)btmColor.r) * ratio / 32;
+            dstColor.g = btmColor.g + ((int)topColor.g - (int)btmColor.g) * ratio / 32;
+            dstColor.b = btmColor.b + ((int)topColor.b - (int)btmColor.b) * ratio / 32;
+        } else {
+            dstColor = topColor;
+        }
+    }
+}
+
+void Color888CompositeRatioMasked(const std::span<Color888> dest, const std::span<const bool> mask,
+                                               const std::span<const Color888, kMaxResH> topColors,
+                                               const std::span<const Color888, kMaxResH> btmColors, uint8 ratio) {
+    size_t i = 0;
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(__AVX2__)
+    // Eight pixels at a time
+    const __m256i ratio_x8 = _mm256_set1_epi32(0x01'01'01'01 * ratio);
+    // Expand to 16-bit values
+    const __m256i ratio16lo_x8 = _mm256_unpacklo_epi8(ratio_x8, _mm256_setzero_si256());
+    const __m256i ratio16hi_x8 = _mm256_unpackhi_epi8(ratio_x8, _mm256_setzero_si256());
+    for (; (i + 8) < dest.size(); i += 8) {
+        // Load eight mask values and expand each byte into 32-bit 000... or 111...
+        __m256i mask_x8 = _mm256_cvtepu8_epi32(_mm_loadu_si64(mask.data() + i));
+        mask_x8 = _mm256_sub_epi32(_mm256_setzero_si256(), mask_x8);
+
+        const __m256i topColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&topColors[i]));
+        const __m256i btmColor_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&btmColors[i]));
+
+        const __m256i topColor16lo = _mm256_unpacklo_epi8(topColor_x8, _mm256_setzero_si256());
+        const __m256i btmColor16lo = _mm256_unpacklo_epi8(btmColor_x8, _mm256_setzero_si256());
+
+        const __m256i topColor16hi = _mm256_unpackhi_epi8(topColor_x8, _mm256_setzero_si256());
+        const __m256i btmColor16hi = _mm256_unpackhi_epi8(btmColor_x8, _mm256_setzero_si256());
+
+        // Lerp
+        const __m256i dstColor16lo = _mm256_add_epi16(
+            btmColor16lo,
+            _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(topColor16lo, btmColor16lo), ratio16lo_x8), 5));
+        const __m256i dstColor16hi = _mm256_add_epi16(
+            btmColor16hi,
+            _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(topColor16hi, btmColor16hi), ratio16hi_x8), 5));
+
+        // Pack back into 8-bit values, be sure to truncate to avoid saturation
+        __m256i dstColor_x8 = _mm256_packus_epi16(_mm256_and_si256(dstColor16lo, _mm256_set1_epi16(0xFF)),
+                                                  _mm256_and_si256(dstColor16hi, _mm256_set1_epi16(0xFF)));
+
+        // Blend with mask
+        dstColor_x8 = _mm256_blendv_epi8(topColor_x8, dstColor_x8, mask_x8);
+
+        // Write
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), dstColor_x8);
+    }
+    #endif
+
+    #if defined(__SSE2__)
+    // Four pixels at a time
+    const __m128i ratio_x4 = _mm_set1_epi32(0x01'01'01'01 * ratio);
+    // Expand to 16-bit values
+    const __m128i ratio16lo_x4 = _mm_unpacklo_epi8(ratio_x4, _mm_setzero_si128());
+    const __m128i ratio16hi_x4 = _mm_unpackhi_epi8(ratio_x4, _mm_setzero_si128());
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        const __m128i mask_x4 = ExpandMask_x4(mask.data() + i);
+
+        const __m128i topColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&topColors[i]));
+        const __m128i btmColor_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&btmColors[i]));
+
+        const __m128i topColor16lo = _mm_unpacklo_epi8(topColor_x4, _mm_setzero_si128());
+        const __m128i btmColor16lo = _mm_unpacklo_epi8(btmColor_x4, _mm_setzero_si128());
+
+        const __m128i topColor16hi = _mm_unpackhi_epi8(topColor_x4, _mm_setzero_si128());
+        const __m128i btmColor16hi = _mm_unpackhi_epi8(btmColor_x4, _mm_setzero_si128());
+
+        // Composite
+        const __m128i dstColor16lo = _mm_add_epi16(
+            btmColor16lo, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(topColor16lo, btmColor16lo), ratio16lo_x4), 5));
+        const __m128i dstColor16hi = _mm_add_epi16(
+            btmColor16hi, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(topColor16hi, btmColor16hi), ratio16hi_x4), 5));
+
+        // Pack back into 8-bit values, be sure to truncate to avoid saturation
+        __m128i dstColor_x4 = _mm_packus_epi16(_mm_and_si128(dstColor16lo, _mm_set1_epi16(0xFF)),
+                                               _mm_and_si128(dstColor16hi, _mm_set1_epi16(0xFF)));
+
+        // Blend with mask
+        dstColor_x4 = Blend_x4(topColor_x4, dstColor_x4, mask_x4);
+
+        // Write
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), dstColor_x4);
+    }
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // Four pixels at a time
+    const uint8x16_t ratio_x4 = vdupq_n_u8(ratio);
+    for (; (i + 4) < dest.size(); i += 4) {
+        // Load four mask values and expand each byte into 32-bit 000... or 111...
+        uint32x4_t mask_x4 = vld1q_lane_u32(reinterpret_cast<const uint32 *>(mask.data() + i), vdupq_n_u32(0), 0);
+        mask_x4 = vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(mask_x4))));
+        mask_x4 = vnegq_s32(mask_x4);
+
+        const uint32x4_t topColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&topColors[i]));
+        const uint32x4_t btmColor_x4 = vld1q_u32(reinterpret_cast<const uint32 *>(&btmColors[i]));
+
+        const uint16x8_t topColor16lo = vmovl_u8(vget_low_u8(topColor_x4));
+        const uint16x8_t btmColor16lo = vmovl_u8(vget_low_u8(btmColor_x4));
+
+        const uint16x8_t topColor16hi = vmovl_high_u8(topColor_x4);
+        const uint16x8_t btmColor16hi = vmovl_high_u8(btmColor_x4);
+
+        // Composite
+        int16x8_t composite16lo = vsubq_s16(topColor16lo, btmColor16lo);
+        int16x8_t composite16hi = vsubq_s16(topColor16hi, btmColor16hi);
+
+        composite16lo = vmulq_u16(composite16lo, vmovl_u8(vget_low_s8(ratio_x4)));
+        composite16hi = vmulq_u16(composite16hi, vmovl_high_u8(ratio_x4));
+
+        composite16lo = vsraq_n_s16(vmovl_s8(vget_low_s8(btmColor_x4)), composite16lo, 5);
+        composite16hi = vsraq_n_s16(vmovl_high_s8(btmColor_x4), composite16hi, 5);
+
+        int8x16_t composite_x4 = vmovn_high_s16(vmovn_s16(composite16lo), composite16hi);
+
+        // Blend with mask
+        const uint32x4_t dstColor_x4 = vbslq_u32(mask_x4, composite_x4, topColor_x4);
+
+        // Write
+        vst1q_u32(reinterpret_cast<uint32 *>(&dest[i]), dstColor_x4);
+    }
+#endif
+
+    for (; i < dest.size(); i++) {
+        const Color888 &topColor = topColors[i];
+        const Color888 &btmColor = btmColors[i];
+        Color888 &dstColor = dest[i];
+        if (mask[i]) {
+            dstColor.r = btmColor.r + ((int)topColor.r - (int)btmColor.r) * ratio / 32;
+            dstColor.g = btmColor.g + ((int)topColor.g - (int)btmColor.g) * ratio / 32;
+            dstColor.b = btmColor.b + ((int)topColor.b - (int)btmColor.b) * ratio / 32;
+        } else {
+            dstColor = topColor;
+        }
+    }
+}
+
+// Builds the kernel table for this instruction set
+constexpr VDPKernels MakeKernels(util::SIMDLevel level) {
+    return VDPKernels{
+        .level = level,
+        .AllZeroU8 = AllZeroU8,
+        .AllBool = AllBool,
+        .AnyBool = AnyBool,
+        .Color888ShadowMasked = Color888ShadowMasked,
+        .Color888SatAddMasked = Color888SatAddMasked,
+        .Color888SelectMasked = Color888SelectMasked,
+        .Color888AverageMasked = Color888AverageMasked,
+        .Color888CompositeRatioPerPixelMasked = Color888CompositeRatioPerPixelMasked,
+        .Color888CompositeRatioMasked = Color888CompositeRatioMasked,
+    };
+}
+
+} // namespace
+
+} // namespace ymir::vdp::kernels::YMIR_VDP_KERNELS_NS
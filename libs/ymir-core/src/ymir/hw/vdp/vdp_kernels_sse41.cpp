@@ -0,0 +1,15 @@
+#define YMIR_VDP_KERNELS_NS sse41
+#include "vdp_kernels_impl.hpp"
+
+namespace ymir::vdp::kernels {
+
+const VDPKernels *GetSSE41Kernels() {
+#if defined(__SSE4_1__)
+    static constexpr VDPKernels kKernels = sse41::MakeKernels(util::SIMDLevel::SSE41);
+    return &kKernels;
+#else
+    return nullptr;
+#endif
+}
+
+} // namespace ymir::vdp::kernels
@@ -0,0 +1,155 @@
+#include <ymir/media/binary_reader/binary_reader_mem_lz4.hpp>
+
+#include <lz4.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <fstream>
+#include <thread>
+
+namespace ymir::media {
+
+CompressedMemoryBinaryReader::CompressedMemoryBinaryReader(std::filesystem::path path, std::error_code &error) {
+    error.clear();
+
+    // Get the file size
+    const uintmax_t size = std::filesystem::file_size(path, error);
+    if (error) {
+        return;
+    }
+
+    const uintmax_t numBlocks = (size + kBlockSize - 1) / kBlockSize;
+    m_blocks.resize(numBlocks);
+
+    // Compress blocks in parallel. Each worker uses its own file stream and claims blocks from a shared counter.
+    const uint32 numWorkers = static_cast<uint32>(
+        std::clamp<uintmax_t>(std::thread::hardware_concurrency(), 1u, std::max<uintmax_t>(numBlocks, 1u)));
+    std::atomic<uintmax_t> nextBlock = 0;
+    std::atomic_int firstErrno = 0;
+
+    auto worker = [&] {
+        std::ifstream in{path, std::ios::binary};
+        if (!in) {
+            int expected = 0;
+            firstErrno.compare_exchange_strong(expected, errno != 0 ? errno : EIO);
+            return;
+        }
+
+        std::vector<char> raw(kBlockSize);
+        std::vector<char> compressed(LZ4_compressBound(kBlockSize));
+
+        uintmax_t blockIndex;
+        while ((blockIndex = nextBlock.fetch_add(1, std::memory_order_relaxed)) < numBlocks) {
+            const uintmax_t offset = blockIndex * kBlockSize;
+            const uint32 blockSize = static_cast<uint32>(std::min<uintmax_t>(kBlockSize, size - offset));
+
+            in.seekg(offset);
+            in.read(raw.data(), blockSize);
+            if (static_cast<uintmax_t>(in.gcount()) != blockSize) {
+                int expected = 0;
+                firstErrno.compare_exchange_strong(expected, EIO);
+                return;
+            }
+
+            Block &block = m_blocks[blockIndex];
+            const int compressedSize =
+                LZ4_compress_default(raw.data(), compressed.data(), blockSize, compressed.size());
+            if (compressedSize > 0 && static_cast<uint32>(compressedSize) < blockSize) {
+                block.data.assign(compressed.begin(), compressed.begin() + compressedSize);
+                block.compressed = true;
+            } else {
+                // Incompressible; store as is
+                block.data.assign(raw.begin(), raw.begin() + blockSize);
+                block.compressed = false;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(numWorkers - 1);
+    for (uint32 i = 1; i < numWorkers; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+
+    if (firstErrno != 0) {
+        error.assign(firstErrno, std::generic_category());
+        m_blocks.clear();
+        return;
+    }
+
+    m_size = size;
+}
+
+uintmax_t CompressedMemoryBinaryReader::Read(uintmax_t offset, uintmax_t size, std::span<uint8> output) const {
+    if (offset >= m_size) {
+        return 0;
+    }
+    // Limit size to the smallest of the requested size, the output buffer size and the amount of bytes available in
+    // the file starting from offset
+    size = std::min(size, m_size - offset);
+    size = std::min<uintmax_t>(size, output.size());
+
+    uintmax_t outOffset = 0;
+    while (outOffset < size) {
+        const uintmax_t blockIndex = (offset + outOffset) / kBlockSize;
+        const uintmax_t blockOffset = (offset + outOffset) % kBlockSize;
+        const std::span<const uint8> block = DecodeBlock(blockIndex);
+        if (block.size() <= blockOffset) [[unlikely]] {
+            break;
+        }
+        const uintmax_t chunkSize = std::min<uintmax_t>(size - outOffset, block.size() - blockOffset);
+        std::copy_n(block.begin() + blockOffset, chunkSize, output.begin() + outOffset);
+        outOffset += chunkSize;
+    }
+    return outOffset;
+}
+
+uintmax_t CompressedMemoryBinaryReader::CompressedSize() const {
+    uintmax_t total = 0;
+    for (const Block &block : m_blocks) {
+        total += block.data.size();
+    }
+    return total;
+}
+
+std::span<const uint8> CompressedMemoryBinaryReader::DecodeBlock(uintmax_t blockIndex) const {
+    ++m_useCounter;
+
+    // Look up the block in the cache, tracking the least recently used entry in case of a miss
+    CacheEntry *victim = &m_cache[0];
+    for (CacheEntry &entry : m_cache) {
+        if (entry.blockIndex == blockIndex) {
+            entry.lastUse = m_useCounter;
+            return entry.data;
+        }
+        if (entry.lastUse < victim->lastUse) {
+            victim = &entry;
+        }
+    }
+
+    const Block &block = m_blocks[blockIndex];
+    const uint32 blockSize = static_cast<uint32>(std::min<uintmax_t>(kBlockSize, m_size - blockIndex * kBlockSize));
+    victim->data.resize(blockSize);
+    victim->blockIndex = blockIndex;
+    victim->lastUse = m_useCounter;
+
+    if (block.compressed) {
+        const int decodedSize = LZ4_decompress_safe(block.data.data(), reinterpret_cast<char *>(victim->data.data()),
+                                                    block.data.size(), blockSize);
+        if (decodedSize != static_cast<int>(blockSize)) [[unlikely]] {
+            victim->blockIndex = ~uintmax_t(0);
+            victim->data.clear();
+            return {};
+        }
+    } else {
+        std::copy(block.data.begin(), block.data.end(), reinterpret_cast<char *>(victim->data.data()));
+    }
+    return victim->data;
+}
+
+} // namespace ymir::media
@@ -327,7 +327,7 @@ static std::optional<CueSheet> LoadSheet(std::filesystem::path cuePath, CbLoader
     return sheet;
 }
 
-bool Load(std::filesystem::path cuePath, Disc &disc, bool preloadToRAM, CbLoaderMessage cbMsg) {
+bool Load(std::filesystem::path cuePath, Disc &disc, PreloadMode preload, CbLoaderMessage cbMsg) {
     util::ScopeGuard sgInvalidateDisc{[&] { disc.Invalidate(); }};
 
     auto errorMsg = [&](std::string message) { cbMsg(MessageType::Error, message); };
@@ -343,11 +343,7 @@ bool Load(std::filesystem::path cuePath, Disc &disc, bool preloadToRAM, CbLoader
         if (sheet.files.size() == 1) {
             auto &file = sheet.files.front();
             std::error_code err{};
-            if (preloadToRAM) {
-                reader = std::make_shared<MemoryBinaryReader>(file.path, err);
-            } else {
-                reader = std::make_shared<MemoryMappedBinaryReader>(file.path, err);
-            }
+            reader = OpenImageFile(file.path, preload, err);
             if (err) {
                 errorMsg(fmt::format("BIN/CUE: Failed to load {} - {}", file.path, err.message()));
                 return false;
@@ -358,13 +354,8 @@ bool Load(std::filesystem::path cuePath, Disc &disc, bool preloadToRAM, CbLoader
             for (uint32 fileIndex = 0; fileIndex < sheet.files.size(); ++fileIndex) {
                 auto &file = sheet.files[fileIndex];
 
-                std::shared_ptr<IBinaryReader> fileReader;
                 std::error_code err{};
-                if (preloadToRAM) {
-                    fileReader = std::make_shared<MemoryBinaryReader>(file.path, err);
-                } else {
-                    fileReader = std::make_shared<MemoryMappedBinaryReader>(file.path, err);
-                }
+                std::shared_ptr<IBinaryReader> fileReader = OpenImageFile(file.path, preload, err);
                 if (file.format == "WAVE") {
                     // Check if wave file is raw, uncompressed 16-bit PCM stereo at 44100 Hz and grab a subview if so
                     [&] {
@@ -559,7 +550,7 @@ bool Load(std::filesystem::path cuePath, Disc &disc, bool preloadToRAM, CbLoader
 
             const uintmax_t trackSizeBytes = static_cast<uintmax_t>(trackSectors) * prevTrack.sectorSize;
             prevTrack.endFrameAddress = prevTrack.startFrameAddress + trackSectors - 1;
-            prevTrack.binaryReader = std::make_unique<SharedSubviewBinaryReader>(reader, binOffset, trackSizeBytes);
+            prevTrack.binaryReader = std::make_shared<SharedSubviewBinaryReader>(reader, binOffset, trackSizeBytes);
 
             // TODO: for data tracks with at least the header bytes available, manually scan sectors to find the
             // *actual* end of the track, because some dumps are just bad
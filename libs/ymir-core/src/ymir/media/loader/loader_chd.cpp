@@ -177,7 +177,7 @@ static bool SetTrackInfo(const chd_header *header, std::string_view typestring,
     return true;
 }
 
-bool Load(std::filesystem::path chdPath, Disc &disc, bool preloadToRAM, CbLoaderMessage cbMsg) {
+bool Load(std::filesystem::path chdPath, Disc &disc, PreloadMode preload, CbLoaderMessage cbMsg) {
     util::ScopeGuard sgInvalidateDisc{[&] { disc.Invalidate(); }};
 
     auto invFmtMsg = [&](std::string message) { cbMsg(MessageType::InvalidFormat, message); };
@@ -196,7 +196,8 @@ bool Load(std::filesystem::path chdPath, Disc &disc, bool preloadToRAM, CbLoader
     }
     const chd_header *header = chd_get_header(file);
 
-    if (preloadToRAM) {
+    // CHD files are already compressed, so both preload modes load the compressed file into memory
+    if (preload != PreloadMode::None) {
         chd_precache(file);
     }
 
@@ -391,7 +392,7 @@ bool Load(std::filesystem::path chdPath, Disc &disc, bool preloadToRAM, CbLoader
                 subviewOffset += offset;
             }
             track.binaryReader =
-                std::make_unique<SharedSubviewBinaryReader>(binaryReader, subviewOffset, frames * track.unitSize);
+                std::make_shared<SharedSubviewBinaryReader>(binaryReader, subviewOffset, frames * track.unitSize);
             track.startFrameAddress = frameAddress;
             track.endFrameAddress = frameAddress + frames - 1;
             track.index01FrameAddress = frameAddress;
@@ -46,7 +46,7 @@ struct CaseInsensitiveStringCompare {
 const std::set<std::string, CaseInsensitiveStringCompare> kValidSectionNames = {"CloneCD", "Disc",  "CDText",
                                                                                 "Session", "Entry", "TRACK"};
 
-bool Load(std::filesystem::path ccdPath, Disc &disc, bool preloadToRAM, CbLoaderMessage cbMsg) {
+bool Load(std::filesystem::path ccdPath, Disc &disc, PreloadMode preload, CbLoaderMessage cbMsg) {
     std::ifstream in{ccdPath, std::ios::binary};
 
     util::ScopeGuard sgInvalidateDisc{[&] { disc.Invalidate(); }};
@@ -232,12 +232,7 @@ bool Load(std::filesystem::path ccdPath, Disc &disc, bool preloadToRAM, CbLoader
     std::filesystem::path imgPath = ccdPath;
     imgPath.replace_extension("img");
     std::error_code err{};
-    std::shared_ptr<IBinaryReader> imgFile;
-    if (preloadToRAM) {
-        imgFile = std::make_shared<MemoryBinaryReader>(imgPath, err);
-    } else {
-        imgFile = std::make_shared<MemoryMappedBinaryReader>(imgPath, err);
-    }
+    std::shared_ptr<IBinaryReader> imgFile = OpenImageFile(imgPath, preload, err);
     if (err) {
         errorMsg(fmt::format("IMG/CCD: Failed to load image file {}: {}", imgPath, err.message()));
         return false;
@@ -320,7 +315,7 @@ bool Load(std::filesystem::path ccdPath, Disc &disc, bool preloadToRAM, CbLoader
                     fileSize -= static_cast<uintmax_t>(pregapSize) * prevTrack.sectorSize;
                 }
 
-                prevTrack.binaryReader = std::make_unique<SharedSubviewBinaryReader>(imgFile, fileOffset, fileSize);
+                prevTrack.binaryReader = std::make_shared<SharedSubviewBinaryReader>(imgFile, fileOffset, fileSize);
             }
         }
 
@@ -339,7 +334,7 @@ bool Load(std::filesystem::path ccdPath, Disc &disc, bool preloadToRAM, CbLoader
             fileSize -= static_cast<uintmax_t>(pregapSize) * lastTrack.sectorSize;
         }
 
-        lastTrack.binaryReader = std::make_unique<SharedSubviewBinaryReader>(imgFile, fileOffset, fileSize);
+        lastTrack.binaryReader = std::make_shared<SharedSubviewBinaryReader>(imgFile, fileOffset, fileSize);
 
         // Finish session
         session.BuildTOC();
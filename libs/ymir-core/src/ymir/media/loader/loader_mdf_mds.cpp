@@ -93,7 +93,7 @@ struct MDSFooter {
 #pragma pack(pop)
 static_assert(sizeof(MDSFooter) == 0x10);
 
-bool Load(std::filesystem::path mdsPath, Disc &disc, bool preloadToRAM, CbLoaderMessage cbMsg) {
+bool Load(std::filesystem::path mdsPath, Disc &disc, PreloadMode preload, CbLoaderMessage cbMsg) {
     std::ifstream in{mdsPath, std::ios::binary};
 
     util::ScopeGuard sgInvalidateDisc{[&] { disc.Invalidate(); }};
@@ -251,7 +251,7 @@ bool Load(std::filesystem::path mdsPath, Disc &disc, bool preloadToRAM, CbLoader
                     const auto &mdfPath = trackMDFs[trackIndex - 1];
 
                     prevTrack.binaryReader =
-                        std::make_unique<SharedSubviewBinaryReader>(files.at(mdfPath), viewOffset, viewSize);
+                        std::make_shared<SharedSubviewBinaryReader>(files.at(mdfPath), viewOffset, viewSize);
                 }
 
                 if (trackData.footerOffset == 0) {
@@ -290,11 +290,7 @@ bool Load(std::filesystem::path mdsPath, Disc &disc, bool preloadToRAM, CbLoader
 
                 if (!files.contains(mdfPath)) {
                     std::error_code err{};
-                    if (preloadToRAM) {
-                        files.insert({mdfPath, std::make_shared<MemoryBinaryReader>(mdfPath, err)});
-                    } else {
-                        files.insert({mdfPath, std::make_shared<MemoryMappedBinaryReader>(mdfPath, err)});
-                    }
+                    files.insert({mdfPath, OpenImageFile(mdfPath, preload, err)});
                     if (err) {
                         errorMsg(fmt::format("MDF/MDS: Failed to load MDF file {} - {}", mdfPath, err.message()));
                         return false;
@@ -352,7 +348,7 @@ bool Load(std::filesystem::path mdsPath, Disc &disc, bool preloadToRAM, CbLoader
             const uintmax_t viewOffset = trackStartOffsets[sessionData.lastTrack - 1];
             const uintmax_t viewSize = file->Size() - viewOffset;
 
-            lastTrack.binaryReader = std::make_unique<SharedSubviewBinaryReader>(file, viewOffset, viewSize);
+            lastTrack.binaryReader = std::make_shared<SharedSubviewBinaryReader>(file, viewOffset, viewSize);
         }
         auto &lastIndex = lastTrack.indices.back();
         lastIndex.endFrameAddress = lastTrack.endFrameAddress;
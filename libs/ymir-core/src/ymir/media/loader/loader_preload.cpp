@@ -0,0 +1,17 @@
+#include <ymir/media/loader/loader_preload.hpp>
+
+#include <ymir/media/binary_reader/binary_reader_impl.hpp>
+
+namespace ymir::media {
+
+std::unique_ptr<IBinaryReader> OpenImageFile(const std::filesystem::path &path, PreloadMode preload,
+                                             std::error_code &error) {
+    switch (preload) {
+    case PreloadMode::Uncompressed: return std::make_unique<MemoryBinaryReader>(path, error);
+    case PreloadMode::Compressed: return std::make_unique<CompressedMemoryBinaryReader>(path, error);
+    case PreloadMode::None: [[fallthrough]];
+    default: return std::make_unique<MemoryMappedBinaryReader>(path, error);
+    }
+}
+
+} // namespace ymir::media
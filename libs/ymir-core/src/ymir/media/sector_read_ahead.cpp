@@ -0,0 +1,160 @@
+#include <ymir/media/sector_read_ahead.hpp>
+
+#include <ymir/util/thread_name.hpp>
+
+#include <algorithm>
+
+namespace ymir::media {
+
+SectorReadAhead::SectorReadAhead(const Disc &disc)
+    : m_disc(disc) {}
+
+SectorReadAhead::~SectorReadAhead() {
+    SetEnabled(false);
+}
+
+void SectorReadAhead::SetEnabled(bool enabled) {
+    if (m_enabled == enabled) {
+        return;
+    }
+
+    if (enabled) {
+        {
+            std::unique_lock lock{m_mutex};
+            m_shutdown = false;
+        }
+        m_thread = std::thread{[&] { WorkerThread(); }};
+        m_enabled = true;
+    } else {
+        {
+            std::unique_lock lock{m_mutex};
+            m_shutdown = true;
+        }
+        m_cv.notify_one();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        m_enabled = false;
+    }
+}
+
+void SectorReadAhead::Reset() {
+    // Wait for any in-flight read to finish before touching the ring
+    std::unique_lock readLock{m_readMutex};
+    std::unique_lock lock{m_mutex};
+
+    m_generation++;
+    for (Slot &slot : m_slots) {
+        slot.frameAddress = ~0u;
+        slot.state = SlotState::Empty;
+        slot.valid = false;
+    }
+    m_consumeFAD = 0;
+    m_fillFAD = 0;
+    m_endFAD = 0;
+}
+
+void SectorReadAhead::Prefetch(uint32 startFAD, uint32 endFAD, uint32 readSpeed) {
+    if (!m_enabled) {
+        return;
+    }
+
+    {
+        std::unique_lock lock{m_mutex};
+        m_depth = std::clamp<uint32>(readSpeed * 16u, 16u, kCapacity);
+        m_consumeFAD = startFAD;
+        m_fillFAD = startFAD;
+        m_endFAD = endFAD + 1;
+    }
+    m_cv.notify_one();
+}
+
+bool SectorReadAhead::ReadSector(const Track &track, uint32 frameAddress, std::span<uint8, 2352> outBuf) {
+    if (m_enabled) {
+        std::unique_lock lock{m_mutex};
+        Slot &slot = m_slots[frameAddress & (kCapacity - 1)];
+
+        // Wait for the sector if the worker is currently reading it
+        m_readyCV.wait(lock, [&] { return slot.frameAddress != frameAddress || slot.state != SlotState::Filling; });
+
+        // Advance the window past the requested sector
+        if (frameAddress >= m_endFAD || frameAddress + 1 < m_consumeFAD) {
+            // Out of the prefetch range; speculatively read ahead sequentially
+            m_endFAD = frameAddress + 1 + m_depth;
+        }
+        m_consumeFAD = frameAddress + 1;
+        m_fillFAD = std::max(m_fillFAD, m_consumeFAD);
+        if (m_fillFAD > m_consumeFAD + m_depth) {
+            m_fillFAD = m_consumeFAD;
+        }
+
+        if (slot.frameAddress == frameAddress && slot.state == SlotState::Ready) [[likely]] {
+            std::copy(slot.data.begin(), slot.data.end(), outBuf.begin());
+            const bool valid = slot.valid;
+            lock.unlock();
+            m_cv.notify_one();
+            return valid;
+        }
+
+        lock.unlock();
+        m_cv.notify_one();
+    }
+
+    // Cache miss or read-ahead disabled; read synchronously
+    std::unique_lock readLock{m_readMutex};
+    return track.ReadSector(frameAddress, outBuf);
+}
+
+bool SectorReadAhead::HasPendingWork() const {
+    return m_fillFAD < m_endFAD && m_fillFAD < m_consumeFAD + m_depth;
+}
+
+void SectorReadAhead::WorkerThread() {
+    util::SetCurrentThreadName("CD read-ahead thread");
+
+    std::unique_lock lock{m_mutex};
+    while (true) {
+        m_cv.wait(lock, [&] { return m_shutdown || HasPendingWork(); });
+        if (m_shutdown) {
+            break;
+        }
+
+        const uint32 frameAddress = m_fillFAD++;
+        Slot &slot = m_slots[frameAddress & (kCapacity - 1)];
+        if (slot.frameAddress == frameAddress && slot.state == SlotState::Ready) {
+            // Already buffered
+            continue;
+        }
+
+        // The window never spans more than kCapacity sectors, so the slot holds an already consumed sector
+        slot.frameAddress = frameAddress;
+        slot.state = SlotState::Filling;
+        slot.valid = false;
+        const uint64 generation = m_generation;
+        lock.unlock();
+
+        bool valid = false;
+        {
+            std::unique_lock readLock{m_readMutex};
+
+            // Bail out if the disc was reset while waiting for the lock
+            lock.lock();
+            const bool stale = generation != m_generation;
+            lock.unlock();
+
+            if (!stale && !m_disc.sessions.empty()) {
+                const Track *track = m_disc.sessions.back().FindTrack(frameAddress);
+                valid = track != nullptr && track->ReadSector(frameAddress, slot.data);
+            }
+
+            lock.lock();
+            if (generation == m_generation) {
+                slot.valid = valid;
+                slot.state = SlotState::Ready;
+            }
+        }
+        m_readyCV.notify_all();
+    }
+}
+
+} // namespace ymir::media
@@ -0,0 +1,311 @@
+#include <ymir/sys/input_movie.hpp>
+
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/util/dev_log.hpp>
+
+#include <algorithm>
+
+namespace ymir::sys {
+
+namespace grp {
+
+    // -----------------------------------------------------------------------------
+    // Dev log groups
+
+    // Hierarchy:
+    //
+    // movie
+
+    struct movie {
+        static constexpr bool enabled = true;
+        static constexpr devlog::Level level = devlog::level::debug;
+        static constexpr std::string_view name = "Movie";
+    };
+
+} // namespace grp
+
+struct MoviePlayer::SavedRTCConfig {
+    core::config::rtc::Mode mode;
+    core::config::rtc::HardResetStrategy virtHardResetStrategy;
+    sint64 virtHardResetTimestamp;
+};
+
+MoviePlayer::MoviePlayer(Saturn &saturn)
+    : m_saturn(saturn) {}
+
+MoviePlayer::~MoviePlayer() {
+    Stop();
+}
+
+void MoviePlayer::StartRecording(sint64 rtcTimestamp, uint64 checkpointInterval, size_t maxCheckpoints) {
+    Stop();
+
+    m_maxCheckpoints = std::max<size_t>(maxCheckpoints, 2);
+
+    m_movie = {};
+    m_movie.iplHash = m_saturn.GetIPLHash();
+    m_movie.discHash = m_saturn.GetDiscHash();
+    m_movie.rtcTimestamp = rtcTimestamp;
+    m_movie.checkpointInterval = checkpointInterval;
+    m_movie.peripheralTypes[0] = m_saturn.SMPC.GetPeripheralPort1().GetPeripheral().GetType();
+    m_movie.peripheralTypes[1] = m_saturn.SMPC.GetPeripheralPort2().GetPeripheral().GetType();
+
+    ConfigureRTC(rtcTimestamp);
+    m_saturn.Reset(true);
+
+    m_frame = 0;
+    m_mismatches = 0;
+    m_pending = {};
+    CaptureCheckpoint();
+
+    m_mode = Mode::Recording;
+    InstallHooks();
+    devlog::info<grp::movie>("Recording started");
+}
+
+bool MoviePlayer::StartPlayback(InputMovie &&movie) {
+    Stop();
+
+    if (movie.iplHash != m_saturn.GetIPLHash()) {
+        devlog::warn<grp::movie>("Cannot play back movie: IPL ROM hash mismatch");
+        return false;
+    }
+    if (movie.discHash != m_saturn.GetDiscHash()) {
+        devlog::warn<grp::movie>("Cannot play back movie: disc hash mismatch");
+        return false;
+    }
+    if (movie.peripheralTypes[0] != m_saturn.SMPC.GetPeripheralPort1().GetPeripheral().GetType() ||
+        movie.peripheralTypes[1] != m_saturn.SMPC.GetPeripheralPort2().GetPeripheral().GetType()) {
+        devlog::warn<grp::movie>("Cannot play back movie: connected peripherals do not match");
+        return false;
+    }
+
+    m_movie = std::move(movie);
+    std::sort(m_movie.checkpoints.begin(), m_movie.checkpoints.end(),
+              [](const InputMovie::Checkpoint &lhs, const InputMovie::Checkpoint &rhs) { return lhs.frame < rhs.frame; });
+
+    ConfigureRTC(m_movie.rtcTimestamp);
+    m_saturn.Reset(true);
+
+    m_frame = 0;
+    m_mismatches = 0;
+    m_reportIndex.fill(0);
+    m_hasLastReport.fill(false);
+
+    m_mode = Mode::Playback;
+    InstallHooks();
+    devlog::info<grp::movie>("Playback started; {} frames", m_movie.frames.size());
+    return true;
+}
+
+void MoviePlayer::Stop() {
+    if (m_mode == Mode::Idle) {
+        return;
+    }
+
+    RemoveHooks();
+    RestoreRTC();
+    if (m_mode == Mode::Recording && !m_pending.events.empty()) {
+        // Keep events issued after the last frame
+        m_movie.frames.push_back(std::move(m_pending));
+    }
+    m_pending = {};
+    m_mode = Mode::Idle;
+    devlog::info<grp::movie>("Movie stopped at frame {}", m_frame);
+}
+
+void MoviePlayer::RunFrame() {
+    switch (m_mode) {
+    case Mode::Idle: m_saturn.RunFrame(); break;
+    case Mode::Recording:
+        m_saturn.RunFrame();
+        m_movie.frames.push_back(std::move(m_pending));
+        m_pending = {};
+        ++m_frame;
+        if (m_movie.checkpointInterval > 0 && m_frame % m_movie.checkpointInterval == 0) {
+            CaptureCheckpoint();
+        }
+        break;
+    case Mode::Playback:
+        if (m_frame >= m_movie.frames.size()) {
+            Stop();
+            m_saturn.RunFrame();
+            break;
+        }
+        for (MovieEvent event : m_movie.frames[m_frame].events) {
+            ApplyEvent(event);
+        }
+        m_reportIndex.fill(0);
+        m_saturn.RunFrame();
+        ++m_frame;
+        if (m_frame >= m_movie.frames.size()) {
+            devlog::info<grp::movie>("Playback finished; {} mismatched reports", m_mismatches);
+            Stop();
+        }
+        break;
+    }
+}
+
+bool MoviePlayer::SeekTo(uint64 frame) {
+    if (m_mode == Mode::Idle || frame > m_movie.frames.size()) {
+        return false;
+    }
+
+    // Find the closest checkpoint at or before the target frame
+    auto it = std::upper_bound(m_movie.checkpoints.begin(), m_movie.checkpoints.end(), frame,
+                               [](uint64 value, const InputMovie::Checkpoint &cp) { return value < cp.frame; });
+    if (it == m_movie.checkpoints.begin()) {
+        if (m_mode == Mode::Playback) {
+            // No checkpoints; replay from power on
+            ConfigureRTC(m_movie.rtcTimestamp);
+            m_saturn.Reset(true);
+            m_frame = 0;
+        } else {
+            return false;
+        }
+    } else {
+        const InputMovie::Checkpoint &checkpoint = *std::prev(it);
+        if (!m_saturn.LoadState(*checkpoint.state)) {
+            devlog::warn<grp::movie>("Failed to load checkpoint at frame {}", checkpoint.frame);
+            return false;
+        }
+        m_frame = checkpoint.frame;
+    }
+
+    // Replay the remaining frames with the recorded inputs
+    const Mode prevMode = m_mode;
+    m_mode = Mode::Playback;
+    m_pending = {};
+    m_hasLastReport.fill(false);
+    while (m_frame < frame) {
+        for (MovieEvent event : m_movie.frames[m_frame].events) {
+            ApplyEvent(event);
+        }
+        m_reportIndex.fill(0);
+        m_saturn.RunFrame();
+        ++m_frame;
+    }
+    m_mode = prevMode;
+
+    if (m_mode == Mode::Recording) {
+        // Rerecord from this point
+        m_movie.frames.resize(frame);
+        std::erase_if(m_movie.checkpoints, [&](const InputMovie::Checkpoint &cp) { return cp.frame > frame; });
+    } else if (m_frame >= m_movie.frames.size()) {
+        Stop();
+    }
+    return true;
+}
+
+void MoviePlayer::Reset(bool hard) {
+    ApplyEvent(hard ? MovieEvent::HardReset : MovieEvent::SoftReset);
+}
+
+void MoviePlayer::OpenTray() {
+    ApplyEvent(MovieEvent::OpenTray);
+}
+
+void MoviePlayer::CloseTray() {
+    ApplyEvent(MovieEvent::CloseTray);
+}
+
+InputMovie MoviePlayer::TakeMovie() {
+    Stop();
+    return std::move(m_movie);
+}
+
+void MoviePlayer::ConfigureRTC(sint64 rtcTimestamp) {
+    auto &rtcConfig = m_saturn.configuration.rtc;
+    if (!m_savedRTCConfig) {
+        m_savedRTCConfig = std::make_unique<SavedRTCConfig>(SavedRTCConfig{
+            .mode = rtcConfig.mode,
+            .virtHardResetStrategy = rtcConfig.virtHardResetStrategy,
+            .virtHardResetTimestamp = rtcConfig.virtHardResetTimestamp,
+        });
+    }
+    rtcConfig.mode = core::config::rtc::Mode::Virtual;
+    rtcConfig.virtHardResetStrategy = core::config::rtc::HardResetStrategy::ResetToFixedTime;
+    rtcConfig.virtHardResetTimestamp = rtcTimestamp;
+}
+
+void MoviePlayer::RestoreRTC() {
+    if (!m_savedRTCConfig) {
+        return;
+    }
+    auto &rtcConfig = m_saturn.configuration.rtc;
+    rtcConfig.mode = m_savedRTCConfig->mode;
+    rtcConfig.virtHardResetStrategy = m_savedRTCConfig->virtHardResetStrategy;
+    rtcConfig.virtHardResetTimestamp = m_savedRTCConfig->virtHardResetTimestamp;
+    m_savedRTCConfig.reset();
+}
+
+void MoviePlayer::InstallHooks() {
+    m_saturn.SMPC.GetPeripheralPort1().SetPeripheralReportHook(
+        util::MakeClassMemberOptionalCallback<&MoviePlayer::ProcessReport<0>>(this));
+    m_saturn.SMPC.GetPeripheralPort2().SetPeripheralReportHook(
+        util::MakeClassMemberOptionalCallback<&MoviePlayer::ProcessReport<1>>(this));
+}
+
+void MoviePlayer::RemoveHooks() {
+    m_saturn.SMPC.GetPeripheralPort1().ClearPeripheralReportHook();
+    m_saturn.SMPC.GetPeripheralPort2().ClearPeripheralReportHook();
+}
+
+template <uint32 port>
+void MoviePlayer::ProcessReport(peripheral::PeripheralReport &report) {
+    switch (m_mode) {
+    case Mode::Idle: break;
+    case Mode::Recording: m_pending.reports[port].push_back(report); break;
+    case Mode::Playback: {
+        const auto &reports = m_movie.frames[m_frame].reports[port];
+        size_t &index = m_reportIndex[port];
+        if (index < reports.size()) {
+            m_lastReport[port] = reports[index++];
+            m_hasLastReport[port] = true;
+        } else if (!m_hasLastReport[port]) {
+            // The game requested more reports than were recorded before anything was replayed
+            ++m_mismatches;
+            break;
+        } else {
+            // More requests than recorded; repeat the last report
+            ++m_mismatches;
+        }
+        if (m_lastReport[port].type != report.type) {
+            ++m_mismatches;
+            break;
+        }
+        report = m_lastReport[port];
+        break;
+    }
+    }
+}
+
+void MoviePlayer::ApplyEvent(MovieEvent event) {
+    switch (event) {
+    case MovieEvent::SoftReset: m_saturn.Reset(false); break;
+    case MovieEvent::HardReset: m_saturn.Reset(true); break;
+    case MovieEvent::OpenTray: m_saturn.OpenTray(); break;
+    case MovieEvent::CloseTray: m_saturn.CloseTray(); break;
+    }
+    if (m_mode == Mode::Recording) {
+        m_pending.events.push_back(event);
+    }
+}
+
+void MoviePlayer::CaptureCheckpoint() {
+    auto state = std::make_unique<state::State>();
+    m_saturn.SaveState(*state);
+    m_movie.checkpoints.push_back({.frame = m_frame, .state = std::move(state)});
+
+    if (m_movie.checkpoints.size() > m_maxCheckpoints && m_movie.checkpointInterval > 0) {
+        // Keep the initial checkpoint and those that land on the doubled interval
+        const uint64 interval = m_movie.checkpointInterval * 2;
+        std::erase_if(m_movie.checkpoints,
+                      [&](const InputMovie::Checkpoint &cp) { return cp.frame > 0 && cp.frame % interval != 0; });
+        m_movie.checkpointInterval = interval;
+        devlog::debug<grp::movie>("Thinned out checkpoints; new interval is {} frames", interval);
+    }
+}
+
+} // namespace ymir::sys
@@ -2,7 +2,10 @@
 
 #include <ymir/db/game_db.hpp>
 
+#include <ymir/util/cpu_features.hpp>
 #include <ymir/util/dev_log.hpp>
+#include <ymir/util/scope_guard.hpp>
+#include <ymir/util/thread_name.hpp>
 
 #include <bit>
 #include <cassert>
@@ -55,9 +58,9 @@ Saturn::Saturn()
     , VDP(m_scheduler, configuration)
     , SMPC(m_scheduler, smpcOps, configuration.rtc)
     , SCSP(m_scheduler, configuration.audio)
-    , CDBlock(m_scheduler, m_disc, m_fs, configuration.cdblock)
+    , CDBlock(m_scheduler, m_disc, m_fs, m_readAhead, configuration.cdblock)
     , SH1(SH1Bus)
-    , CDDrive(m_scheduler, m_disc, m_fs, configuration.cdblock) {
+    , CDDrive(m_scheduler, m_disc, m_fs, m_readAhead, configuration.cdblock) {
 
     mainBus.MapNormal(
         0x000'0000, 0x7FF'FFFF, nullptr,
@@ -121,14 +124,25 @@ Saturn::Saturn()
     CDDrive.MapCallbacks(SH1.CbSetCOMSYNCn, SH1.CbSetCOMREQn, SH1.CbCDBDataSector, SCSP.CbCDDASector,
                          YGR.CbSectorTransferDone);
     YGR.MapCallbacks(SH1.CbAssertIRQ6, SH1.CbAssertIRQ7, SH1.CbSetDREQ0n, SH1.CbSetDREQ1n, SH1.CbStepDMAC1,
-                     SCU.CbTriggerExtIntr0);
+                     util::MakeClassMemberRequiredCallback<&Saturn::TriggerCDBlockExtIntr0>(this));
     CDBlock.MapCallbacks(SCU.CbTriggerExtIntr0, SCSP.CbCDDASector);
 
+    const auto cbEndWideSH2SyncQuantum = util::MakeClassMemberRequiredCallback<&Saturn::EndWideSH2SyncQuantum>(this);
+    masterSH2.SetFRTInputCaptureCallback(cbEndWideSH2SyncQuantum);
+    slaveSH2.SetFRTInputCaptureCallback(cbEndWideSH2SyncQuantum);
+    SCU.SetRegisterWriteCallback(cbEndWideSH2SyncQuantum);
+
     m_system.AddClockSpeedChangeCallback(SCSP.CbClockSpeedChange);
     m_system.AddClockSpeedChangeCallback(SMPC.CbClockSpeedChange);
     m_system.AddClockSpeedChangeCallback(CDDrive.CbClockSpeedChange);
     m_system.AddClockSpeedChangeCallback(CDBlock.CbClockSpeedChange);
 
+    {
+        const util::SIMDLevel simdLevel = util::GetHostCPUFeatures().GetBestSIMDLevel();
+        VDP.SetSIMDLevel(simdLevel);
+        devlog::info<grp::system>("Using {} VDP rendering kernels", util::GetSIMDLevelName(VDP.GetSIMDLevel()));
+    }
+
     masterSH2.UseDebugBreakManager(&m_debugBreakMgr);
     slaveSH2.UseDebugBreakManager(&m_debugBreakMgr);
 
@@ -180,14 +194,28 @@ Saturn::Saturn()
     configuration.system.preferredRegionOrder.Observe(
         [&](const std::vector<core::config::sys::Region> &regions) { UpdatePreferredRegionOrder(regions); });
     configuration.system.emulateSH2Cache.Observe([&](bool enabled) { UpdateSH2CacheEmulation(enabled); });
+    configuration.system.adaptiveSH2Sync.ObserveAndNotify([&](bool enabled) {
+        m_sh2SyncAdaptive = enabled;
+        if (!enabled) {
+            m_sh2SyncWide = false;
+        }
+    });
     configuration.system.videoStandard.Observe(
         [&](core::config::sys::VideoStandard videoStandard) { UpdateVideoStandard(videoStandard); });
     configuration.cdblock.useLLE.Observe([&](bool enabled) { SetCDBlockLLE(enabled); });
+    configuration.cdblock.readAhead.ObserveAndNotify([&](bool enabled) { m_readAhead.SetEnabled(enabled); });
+    configuration.cdblock.threadedLLE.ObserveAndNotify([&](bool enabled) { EnableThreadedCDBlock(enabled); });
 
     Reset(true);
 }
 
+Saturn::~Saturn() {
+    EnableThreadedCDBlock(false);
+}
+
 void Saturn::Reset(bool hard) {
+    SyncCDBlock();
+
     m_system.clockSpeed = sys::ClockSpeed::_320;
     m_system.UpdateClockRatios();
 
@@ -204,6 +232,7 @@ void Saturn::Reset(bool hard) {
     m_sh1FracCycles = 0;
 
     SCU.Reset(hard);
+    ResetSH2SyncQuantum();
     VDP.Reset(hard);
     SMPC.Reset(hard);
     SCSP.Reset(hard);
@@ -228,6 +257,7 @@ sys::ClockSpeed Saturn::GetClockSpeed() const noexcept {
 }
 
 void Saturn::SetClockSpeed(sys::ClockSpeed clockSpeed) {
+    SyncCDBlock();
     m_system.clockSpeed = clockSpeed;
     m_system.UpdateClockRatios();
 }
@@ -241,6 +271,7 @@ void Saturn::LoadIPL(std::span<uint8, sys::kIPLSize> ipl) {
 }
 
 void Saturn::LoadCDBlockROM(std::span<uint8, sh1::kROMSize> rom) {
+    SyncCDBlock();
     SH1.LoadROM(rom);
 }
 
@@ -261,8 +292,11 @@ XXH128Hash Saturn::GetDiscHash() const noexcept {
 }
 
 void Saturn::LoadDisc(media::Disc &&disc) {
+    SyncCDBlock();
+
     // Configure area code based on compatible area codes from the disc
     AutodetectRegion(disc.header.compatAreaCode);
+    m_readAhead.Reset();
     m_disc.Swap(std::move(disc));
 
     // Try building filesystem structure
@@ -289,7 +323,9 @@ void Saturn::LoadDisc(media::Disc &&disc) {
 }
 
 void Saturn::EjectDisc() {
+    SyncCDBlock();
     if (!m_disc.sessions.empty()) {
+        m_readAhead.Reset();
         m_disc = {};
         m_fs.Clear();
         if (m_cdblockLLE) {
@@ -301,6 +337,7 @@ void Saturn::EjectDisc() {
 }
 
 void Saturn::OpenTray() {
+    SyncCDBlock();
     if (m_cdblockLLE) {
         CDDrive.OpenTray();
     } else {
@@ -309,6 +346,7 @@ void Saturn::OpenTray() {
 }
 
 void Saturn::CloseTray() {
+    SyncCDBlock();
     if (m_cdblockLLE) {
         CDDrive.CloseTray();
     } else {
@@ -388,17 +426,67 @@ void Saturn::EnableDebugTracing(bool enable) {
         DetachAllTracers();
     }
     m_systemFeatures.enableDebugTracing = enable;
+    m_sh2DebugInstrumented = masterSH2.IsDebugInstrumentationNeeded() || slaveSH2.IsDebugInstrumentationNeeded();
     UpdateFunctionPointers();
     SCSP.SetDebugTracing(enable);
 }
 
+void Saturn::UpdateDebugInstrumentation() {
+    const bool instrumented = masterSH2.IsDebugInstrumentationNeeded() || slaveSH2.IsDebugInstrumentationNeeded();
+    if (instrumented != m_sh2DebugInstrumented) {
+        m_sh2DebugInstrumented = instrumented;
+        UpdateFunctionPointers();
+    }
+}
+
+void Saturn::EnablePerfStats(bool enable) {
+    if constexpr (!debug::kPerfStatsEnabled) {
+        return;
+    }
+    if (m_perfStatsEnabled == enable) {
+        return;
+    }
+
+    debug::PerfCounters *counters = enable ? &m_perfCounters : nullptr;
+    m_scheduler.UsePerfCounters(counters);
+    masterSH2.UsePerfCounters(counters);
+    slaveSH2.UsePerfCounters(counters);
+    SCU.UsePerfCounters(counters);
+    VDP.UsePerfCounters(counters);
+    SCSP.UsePerfCounters(counters);
+
+    if (enable) {
+        // Discard anything counted before enabling
+        debug::PerfFrameStats discard{};
+        m_perfCounters.Collect(discard);
+        m_perfHistory.Clear();
+        m_perfFrame = 0;
+    }
+    m_perfStatsEnabled = enable;
+}
+
+void Saturn::CollectPerfStats() {
+    debug::PerfFrameStats stats{};
+    stats.frame = m_perfFrame++;
+    m_perfCounters.Collect(stats);
+    for (core::EventID id = 0; id < core::kNumScheduledEvents; ++id) {
+        stats.eventUserIDs[id] = m_scheduler.GetUserID(id);
+    }
+    m_perfHistory.Push(stats);
+}
+
 void Saturn::SaveState(state::State &state) const {
+    // The CD block thread is always synchronized between frames, so there's no quantum in flight here
+    assert(!m_cdblockQuantumInFlight);
     m_scheduler.SaveState(state.scheduler);
     m_system.SaveState(state.system);
     mem.SaveState(state.system);
     state.system.slaveSH2Enabled = slaveSH2Enabled;
     state.msh2SpilloverCycles = m_msh2SpilloverCycles;
     state.ssh2SpilloverCycles = m_ssh2SpilloverCycles;
+    state.sh2SyncWide = m_sh2SyncWide;
+    state.sh2SyncQuietQuanta = m_sh2SyncQuietQuanta;
+    state.sh2SyncPendingComms = GetSH2SyncCommCount() - m_sh2SyncCommCount;
     masterSH2.SaveState(state.msh2);
     slaveSH2.SaveState(state.ssh2);
     SCU.SaveState(state.scu);
@@ -467,6 +555,8 @@ bool Saturn::LoadState(const state::State &state, bool skipROMChecks) {
         return false;
     }
 
+    SyncCDBlock();
+
     // Changing this option causes a hard reset, so do it before loading the state
     SetCDBlockLLE(state.cdblockLLE);
 
@@ -479,6 +569,10 @@ bool Saturn::LoadState(const state::State &state, bool skipROMChecks) {
     masterSH2.LoadState(state.msh2);
     slaveSH2.LoadState(state.ssh2);
     SCU.LoadState(state.scu);
+    // The communication counters are not part of the save state, so restore the count relative to their current values
+    m_sh2SyncWide = state.sh2SyncWide && m_sh2SyncAdaptive;
+    m_sh2SyncQuietQuanta = state.sh2SyncQuietQuanta;
+    m_sh2SyncCommCount = GetSH2SyncCommCount() - state.sh2SyncPendingComms;
     SMPC.LoadState(state.smpc);
     VDP.LoadState(state.vdp);
     SCSP.LoadState(state.scsp);
@@ -522,6 +616,13 @@ void Saturn::DumpCDBlockDRAM(std::ostream &out) {
 
 template <bool debug, bool enableSH2Cache, bool cdblockLLE>
 void Saturn::RunFrameImpl() {
+    // Leave the system in a consistent state between frames
+    util::ScopeGuard sgSyncCDBlock{[&] {
+        if constexpr (cdblockLLE) {
+            SyncCDBlock();
+        }
+    }};
+
     // Use the last line phase as reference to give some leeway if we overshoot the target cycles
     while (VDP.InLastLinePhase()) {
         if (!Run<debug, enableSH2Cache, cdblockLLE>()) {
@@ -539,24 +640,35 @@ template <bool debug, bool enableSH2Cache, bool cdblockLLE>
 bool Saturn::Run() {
     static constexpr uint64 kSH2SyncMaxStep = 32;
 
+    using PerfComponent = ::ymir::debug::PerfComponent;
+    using PerfScopeTimer = ::ymir::debug::PerfScopeTimer;
+
     const uint64 cycles = static_config::max_timing_granularity ? 1 : std::max<sint64>(m_scheduler.RemainingCount(), 0);
 
     uint64 execCycles;
     if (SCU.IsDMAActive()) {
         // Stall both SH2 CPUs and only run the SCU and other stuff
         execCycles = cycles;
+        PerfScopeTimer timer{GetPerfTimerCounter(PerfComponent::SCU)};
         SCU.Advance<debug>(execCycles);
     } else {
+        // SCU time slices interleaved with the CPUs are attributed to the SH-2s
+        PerfScopeTimer timer{GetPerfTimerCounter(PerfComponent::SH2)};
         execCycles = m_msh2SpilloverCycles;
         m_msh2SpilloverCycles = 0;
         if (slaveSH2Enabled) {
             uint64 slaveCycles = m_ssh2SpilloverCycles;
             do {
-                const uint64 prevExecCycles = execCycles;
-                const uint64 targetCycles = std::min(execCycles + kSH2SyncMaxStep, cycles);
+                const uint64 step = m_sh2SyncWide ? cycles : kSH2SyncMaxStep;
+                const uint64 targetCycles = std::min(execCycles + step, cycles);
+                m_sh2SyncSCUCycles = execCycles;
+                m_sh2SyncSlaveCycles = slaveCycles;
+                m_sh2SyncInWideQuantum = m_sh2SyncWide;
                 execCycles = masterSH2.Advance<debug, enableSH2Cache>(targetCycles, execCycles);
-                slaveCycles = slaveSH2.Advance<debug, enableSH2Cache>(execCycles, slaveCycles);
-                SCU.Advance<debug>(execCycles - prevExecCycles);
+                m_sh2SyncInWideQuantum = false;
+                slaveCycles = slaveSH2.Advance<debug, enableSH2Cache>(execCycles, m_sh2SyncSlaveCycles);
+                SCU.Advance<debug>(execCycles - m_sh2SyncSCUCycles);
+                UpdateSH2SyncQuantum();
                 if constexpr (debug) {
                     if (m_debugBreakMgr.IsDebugBreakRaised()) {
                         break;
@@ -575,10 +687,14 @@ bool Saturn::Run() {
             }
         } else {
             do {
-                const uint64 prevExecCycles = execCycles;
-                const uint64 targetCycles = std::min(execCycles + kSH2SyncMaxStep, cycles);
+                const uint64 step = m_sh2SyncWide ? cycles : kSH2SyncMaxStep;
+                const uint64 targetCycles = std::min(execCycles + step, cycles);
+                m_sh2SyncSCUCycles = execCycles;
+                m_sh2SyncInWideQuantum = m_sh2SyncWide;
                 execCycles = masterSH2.Advance<debug, enableSH2Cache>(targetCycles, execCycles);
-                SCU.Advance<debug>(execCycles - prevExecCycles);
+                m_sh2SyncInWideQuantum = false;
+                SCU.Advance<debug>(execCycles - m_sh2SyncSCUCycles);
+                UpdateSH2SyncQuantum();
                 if constexpr (debug) {
                     if (m_debugBreakMgr.IsDebugBreakRaised()) {
                         break;
@@ -587,12 +703,21 @@ bool Saturn::Run() {
             } while (execCycles < cycles);
         }
     }
-    VDP.Advance(execCycles);
+    {
+        PerfScopeTimer timer{GetPerfTimerCounter(PerfComponent::VDP)};
+        VDP.Advance(execCycles);
+    }
 
     // SCSP+M68K and CD block are ticked by the scheduler
 
     if constexpr (cdblockLLE) {
-        AdvanceSH1(execCycles);
+        PerfScopeTimer timer{GetPerfTimerCounter(PerfComponent::SH1)};
+        if (!m_systemFeatures.enableDebugTracing && m_threadedCDBlock) {
+            // Catch up with the previous time slice before the scheduler ticks the CD drive
+            SyncCDBlock();
+        } else {
+            AdvanceSH1(execCycles);
+        }
         // CD drive is ticked by the scheduler
     }
 
@@ -605,7 +730,16 @@ bool Saturn::Run() {
         SMPC.Advance(smpcCycles);
     }*/
 
-    m_scheduler.Advance(execCycles);
+    {
+        PerfScopeTimer timer{GetPerfTimerCounter(PerfComponent::Scheduler)};
+        m_scheduler.Advance(execCycles);
+    }
+
+    if constexpr (cdblockLLE) {
+        if (!m_systemFeatures.enableDebugTracing && m_threadedCDBlock) {
+            PostCDBlockQuantum(execCycles);
+        }
+    }
 
     if constexpr (debug) {
         if (m_debugBreakMgr.LowerDebugBreak()) {
@@ -616,8 +750,66 @@ bool Saturn::Run() {
     return true;
 }
 
+FORCE_INLINE void Saturn::UpdateSH2SyncQuantum() {
+    // Number of quiet quanta required before widening the quantum
+    static constexpr uint32 kQuietQuantaThreshold = 8;
+
+    // The slave SH-2 must be stopped: even a tight loop may be polling shared memory for a message from the master
+    const uint64 commCount = GetSH2SyncCommCount();
+    const bool quiet = commCount == m_sh2SyncCommCount && !SCU.IsDSPRunning() && !SCU.IsDMAActive() &&
+                       (!slaveSH2Enabled || slaveSH2.IsSleeping());
+    m_sh2SyncCommCount = commCount;
+
+    if (!quiet) {
+        m_sh2SyncQuietQuanta = 0;
+        m_sh2SyncWide = false;
+    } else if (m_sh2SyncQuietQuanta < kQuietQuantaThreshold) {
+        ++m_sh2SyncQuietQuanta;
+    } else {
+        m_sh2SyncWide = m_sh2SyncAdaptive;
+    }
+}
+
+void Saturn::ResetSH2SyncQuantum() {
+    m_sh2SyncWide = false;
+    m_sh2SyncQuietQuanta = 0;
+    m_sh2SyncCommCount = GetSH2SyncCommCount();
+    m_sh2SyncInWideQuantum = false;
+    m_sh2SyncSCUCycles = 0;
+    m_sh2SyncSlaveCycles = 0;
+}
+
+void Saturn::EndWideSH2SyncQuantum() {
+    if (!m_sh2SyncInWideQuantum) [[likely]] {
+        return;
+    }
+    m_sh2SyncInWideQuantum = false;
+
+    // Only the master SH-2 executes code in a wide quantum: the slave SH-2 is either disabled or asleep.
+    // No SCU DMA transfer or DSP program can be running either, so the SCU can be caught up without debug tracing.
+    const uint64 commCycles = masterSH2.GetProbe().GetCycleCount() - m_scheduler.CurrentCount();
+    SCU.Advance<false>(commCycles - m_sh2SyncSCUCycles);
+    m_sh2SyncSCUCycles = commCycles;
+
+    // Bring the sleeping slave SH-2 up to this point too, so that its timers are current if the write triggers an
+    // input capture and it wakes up from here rather than from the start of the quantum. No instructions are executed.
+    if (slaveSH2Enabled && slaveSH2.IsSleeping() && commCycles > m_sh2SyncSlaveCycles) {
+        m_sh2SyncSlaveCycles = slaveSH2.Advance<false, false>(commCycles, commCycles);
+    }
+
+    masterSH2.EndAdvance();
+}
+
+uint64 Saturn::GetSH2SyncCommCount() const {
+    return masterSH2.GetFRTInputCaptureCount() + slaveSH2.GetFRTInputCaptureCount() + SCU.GetRegisterWriteCount();
+}
+
 template <bool debug, bool enableSH2Cache, bool cdblockLLE>
 uint64 Saturn::StepMasterSH2Impl() {
+    if constexpr (cdblockLLE) {
+        SyncCDBlock();
+    }
+
     while (SCU.IsDMAActive()) {
         const uint64 cycles = 64;
         SCU.Advance<debug>(cycles);
@@ -660,6 +852,10 @@ uint64 Saturn::StepSlaveSH2Impl() {
         return 0;
     }
 
+    if constexpr (cdblockLLE) {
+        SyncCDBlock();
+    }
+
     while (SCU.IsDMAActive()) {
         const uint64 cycles = 64;
         SCU.Advance<debug>(cycles);
@@ -695,7 +891,8 @@ uint64 Saturn::StepSlaveSH2Impl() {
 }
 
 void Saturn::UpdateFunctionPointers() {
-    UpdateFunctionPointersTemplate(m_systemFeatures.enableDebugTracing, m_systemFeatures.emulateSH2Cache, m_cdblockLLE);
+    const bool debug = m_systemFeatures.enableDebugTracing && m_sh2DebugInstrumented;
+    UpdateFunctionPointersTemplate(debug, m_systemFeatures.emulateSH2Cache, m_cdblockLLE);
 }
 
 template <bool... t_features>
@@ -722,6 +919,73 @@ FORCE_INLINE void Saturn::AdvanceSH1(uint64 cycles) {
     }
 }
 
+void Saturn::EnableThreadedCDBlock(bool enable) {
+    if (m_threadedCDBlock == enable) {
+        return;
+    }
+
+    devlog::debug<grp::system>("{} threaded LLE CD block", (enable ? "Enabling" : "Disabling"));
+
+    if (enable) {
+        m_cdblockThreadShutdown = false;
+        m_cdblockThread = std::thread{[&] { CDBlockThread(); }};
+        YGR.SetHostAccessCallback(util::MakeClassMemberOptionalCallback<&Saturn::SyncCDBlock>(this));
+    } else {
+        SyncCDBlock();
+        YGR.SetHostAccessCallback({});
+        m_cdblockThreadShutdown = true;
+        m_cdblockQuantumStartSignal.Set();
+        if (m_cdblockThread.joinable()) {
+            m_cdblockThread.join();
+        }
+    }
+    m_threadedCDBlock = enable;
+}
+
+FORCE_INLINE void Saturn::PostCDBlockQuantum(uint64 cycles) {
+    assert(!m_cdblockQuantumInFlight);
+    m_cdblockQuantumCycles = cycles;
+    m_cdblockQuantumInFlight = true;
+    m_cdblockQuantumStartSignal.Set();
+}
+
+void Saturn::SyncCDBlock() {
+    if (!m_cdblockQuantumInFlight) {
+        return;
+    }
+
+    m_cdblockQuantumDoneSignal.Wait();
+    m_cdblockQuantumDoneSignal.Reset();
+    m_cdblockQuantumInFlight = false;
+
+    if (m_cdblockDeferredExtIntr0.exchange(false, std::memory_order_acquire)) {
+        SCU.CbTriggerExtIntr0();
+    }
+}
+
+void Saturn::TriggerCDBlockExtIntr0() {
+    if (m_threadedCDBlock && std::this_thread::get_id() == m_cdblockThread.get_id()) {
+        m_cdblockDeferredExtIntr0.store(true, std::memory_order_release);
+    } else {
+        SCU.CbTriggerExtIntr0();
+    }
+}
+
+void Saturn::CDBlockThread() {
+    util::SetCurrentThreadName("CD block LLE thread");
+
+    while (true) {
+        m_cdblockQuantumStartSignal.Wait();
+        m_cdblockQuantumStartSignal.Reset();
+        if (m_cdblockThreadShutdown) {
+            break;
+        }
+
+        AdvanceSH1(m_cdblockQuantumCycles);
+        m_cdblockQuantumDoneSignal.Set();
+    }
+}
+
 void Saturn::ConfigureAccessCycles(bool fastTimings) {
     if (fastTimings) {
         // HACK: this fixes X-Men/Marvel Super Heroes vs. Street Fighter
@@ -784,12 +1048,14 @@ void Saturn::UpdateSH2CacheEmulation(bool enabled) {
 }
 
 void Saturn::UpdateVideoStandard(core::config::sys::VideoStandard videoStandard) {
+    SyncCDBlock();
     m_system.videoStandard = videoStandard;
     m_system.UpdateClockRatios();
 }
 
 void Saturn::SetCDBlockLLE(bool enabled) {
     if (m_cdblockLLE != enabled) {
+        SyncCDBlock();
         m_cdblockLLE = enabled;
         if (enabled) {
             YGR.MapMemory(mainBus);
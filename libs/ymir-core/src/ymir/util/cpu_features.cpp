@@ -0,0 +1,146 @@
+#include <ymir/util/cpu_features.hpp>
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #include <immintrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    #if defined(__linux__)
+        #include <asm/hwcap.h>
+        #include <sys/auxv.h>
+    #endif
+#endif
+
+namespace util {
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+namespace detail {
+
+    struct CPUIDResult {
+        uint32 eax, ebx, ecx, edx;
+    };
+
+    static CPUIDResult CPUID(uint32 leaf, uint32 subleaf) {
+        CPUIDResult result{};
+    #if defined(_MSC_VER)
+        int regs[4];
+        __cpuidex(regs, leaf, subleaf);
+        result.eax = regs[0];
+        result.ebx = regs[1];
+        result.ecx = regs[2];
+        result.edx = regs[3];
+    #else
+        __cpuid_count(leaf, subleaf, result.eax, result.ebx, result.ecx, result.edx);
+    #endif
+        return result;
+    }
+
+    // Reads the XCR0 register, which indicates which register states are saved by the OS
+    static uint64 ReadXCR0() {
+    #if defined(_MSC_VER)
+        return _xgetbv(0);
+    #else
+        uint32 eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<uint64>(edx) << 32ull) | eax;
+    #endif
+    }
+
+} // namespace detail
+
+static CPUFeatures DetectCPUFeatures() {
+    CPUFeatures features{};
+
+    const uint32 maxLeaf = detail::CPUID(0, 0).eax;
+    if (maxLeaf < 1) {
+        return features;
+    }
+
+    const auto leaf1 = detail::CPUID(1, 0);
+    features.sse2 = (leaf1.edx >> 26u) & 1u;
+    features.sse41 = (leaf1.ecx >> 19u) & 1u;
+
+    // AVX state must be enabled by the OS through XSAVE before AVX instructions can be used
+    const bool osxsave = (leaf1.ecx >> 27u) & 1u;
+    const bool avx = (leaf1.ecx >> 28u) & 1u;
+    if (!osxsave || !avx || maxLeaf < 7) {
+        return features;
+    }
+
+    const uint64 xcr0 = detail::ReadXCR0();
+    const bool osAVX = (xcr0 & 0x06) == 0x06;    // XMM and YMM state
+    const bool osAVX512 = (xcr0 & 0xE6) == 0xE6; // XMM, YMM, opmask and ZMM state
+
+    const auto leaf7 = detail::CPUID(7, 0);
+    features.avx2 = osAVX && ((leaf7.ebx >> 5u) & 1u);
+
+    const bool avx512f = (leaf7.ebx >> 16u) & 1u;
+    const bool avx512bw = (leaf7.ebx >> 30u) & 1u;
+    const bool avx512vl = (leaf7.ebx >> 31u) & 1u;
+    features.avx512bw = features.avx2 && osAVX512 && avx512f && avx512bw && avx512vl;
+
+    return features;
+}
+
+#elif defined(_M_ARM64) || defined(__aarch64__)
+
+static CPUFeatures DetectCPUFeatures() {
+    CPUFeatures features{};
+    #if defined(__linux__) && defined(HWCAP_ASIMD)
+    features.neon = (getauxval(AT_HWCAP) & HWCAP_ASIMD) != 0;
+    #else
+    // Advanced SIMD is mandatory on ARMv8-A
+    features.neon = true;
+    #endif
+    return features;
+}
+
+#else
+
+static CPUFeatures DetectCPUFeatures() {
+    return {};
+}
+
+#endif
+
+SIMDLevel CPUFeatures::GetBestSIMDLevel() const {
+    if (avx512bw) {
+        return SIMDLevel::AVX512;
+    }
+    if (avx2) {
+        return SIMDLevel::AVX2;
+    }
+    if (sse41) {
+        return SIMDLevel::SSE41;
+    }
+    if (sse2) {
+        return SIMDLevel::SSE2;
+    }
+    if (neon) {
+        return SIMDLevel::NEON;
+    }
+    return SIMDLevel::Scalar;
+}
+
+const CPUFeatures &GetHostCPUFeatures() {
+    static const CPUFeatures features = DetectCPUFeatures();
+    return features;
+}
+
+const char *GetSIMDLevelName(SIMDLevel level) {
+    switch (level) {
+    case SIMDLevel::Scalar: return "Scalar";
+    case SIMDLevel::SSE2: return "SSE2";
+    case SIMDLevel::SSE41: return "SSE4.1";
+    case SIMDLevel::AVX2: return "AVX2";
+    case SIMDLevel::AVX512: return "AVX-512";
+    case SIMDLevel::NEON: return "NEON";
+    default: return "Unknown";
+    }
+}
+
+} // namespace util
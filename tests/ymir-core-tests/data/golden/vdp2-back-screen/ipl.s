@@ -0,0 +1,41 @@
+! Source listing for ipl.bin, a minimal SH-2 program booted in place of the IPL ROM.
+! Enables the display and advances the VDP2 back screen color once per frame during VBlank.
+! Assembled by hand; the encodings are listed on the left of each instruction.
+
+        .org    0x000
+        .long   0x20000100      ! Power-on reset PC
+        .long   0x06004000      ! Power-on reset SP
+
+        .org    0x100
+start:
+D10A    mov.l   lit_vram,r1     ! r1 = VDP2 VRAM base (back screen color table)
+D20B    mov.l   lit_bktau,r2    ! r2 = &BKTAU
+D30B    mov.l   lit_tvmd,r3     ! r3 = &TVMD
+D40C    mov.l   lit_tvstat,r4   ! r4 = &TVSTAT
+D50C    mov.l   lit_disp,r5     ! r5 = TVMD.DISP
+E000    mov     #0,r0
+2201    mov.w   r0,@r2          ! BKTAU = 0
+7202    add     #2,r2
+2201    mov.w   r0,@r2          ! BKTAL = 0
+2101    mov.w   r0,@r1          ! back screen color = 0
+2351    mov.w   r5,@r3          ! TVMD = DISP, 320x224 NTSC
+E600    mov     #0,r6
+loop:
+6041    mov.w   @r4,r0          ! wait for VBlank
+C808    tst     #8,r0
+89FC    bt      loop
+7621    add     #0x21,r6        ! next color
+2161    mov.w   r6,@r1
+wait_out:
+6041    mov.w   @r4,r0          ! wait for VBlank to end
+C808    tst     #8,r0
+8BFC    bf      wait_out
+AFF6    bra     loop
+0009    nop
+
+        .align  4
+lit_vram:   .long   0x25E00000
+lit_bktau:  .long   0x25F800AC
+lit_tvmd:   .long   0x25F80000
+lit_tvstat: .long   0x25F80004
+lit_disp:   .long   0x00008000
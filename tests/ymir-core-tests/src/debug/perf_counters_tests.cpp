@@ -0,0 +1,143 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/debug/perf_counters.hpp>
+
+#include <array>
+#include <memory>
+
+// -----------------------------------------------------------------------------
+// Performance counter tests
+
+using namespace ymir;
+
+namespace perf_counters {
+
+// Boots the master SH-2 into a loop that polls VDP2 TVSTAT from the IPL ROM.
+// Instruction fetches go to array-backed memory and the TVSTAT reads go to a VDP2 register handler.
+static std::array<uint8, sys::kIPLSize> MakeIPL() {
+    // clang-format off
+    static constexpr std::array<uint16, 6> kProgram = {
+        0xD401,         // 100  mov.l @(TVSTAT),r4
+        // loop:
+        0x6041,         // 102  mov.w @r4,r0
+        0xAFFD,         // 104  bra loop
+        0x0009,         // 106  nop
+        0x25F8, 0x0004, // 108  TVSTAT
+    };
+    // clang-format on
+
+    std::array<uint8, sys::kIPLSize> ipl{};
+    auto write16 = [&](uint32 address, uint16 value) {
+        ipl[address + 0] = value >> 8u;
+        ipl[address + 1] = value >> 0u;
+    };
+
+    // Power-on reset vectors
+    write16(0x000, 0x2000);
+    write16(0x002, 0x0100);
+    write16(0x004, 0x0600);
+    write16(0x006, 0x4000);
+
+    for (uint32 i = 0; i < kProgram.size(); ++i) {
+        write16(0x100 + i * sizeof(uint16), kProgram[i]);
+    }
+    return ipl;
+}
+
+} // namespace perf_counters
+
+using namespace perf_counters;
+
+TEST_CASE("PerfCounters::Collect moves counts into the frame stats and resets them", "[debug][perf]") {
+    auto counters = std::make_unique<debug::PerfCounters>();
+    counters->sh2[0].instructions.Add(10);
+    counters->sh2[1].cycles.Add(20);
+    counters->sh2[0].memoryAccesses.Add(30);
+    counters->sh2[1].mmioAccesses.Add(40);
+    counters->vdp1Pixels.Add(50);
+    counters->eventsFired[3].Add(2);
+    counters->eventsFired[3].Add(5);
+
+    debug::PerfFrameStats stats{};
+    counters->Collect(stats);
+    CHECK(stats.sh2Instructions[0] == 10);
+    CHECK(stats.sh2Instructions[1] == 0);
+    CHECK(stats.sh2Cycles[1] == 20);
+    CHECK(stats.sh2MemoryAccesses[0] == 30);
+    CHECK(stats.sh2MMIOAccesses[0] == 0);
+    CHECK(stats.sh2MMIOAccesses[1] == 40);
+    CHECK(stats.vdp1Pixels == 50);
+    CHECK(stats.eventsFired[3] == 7);
+
+    counters->Collect(stats);
+    CHECK(stats.sh2Instructions[0] == 0);
+    CHECK(stats.sh2MemoryAccesses[0] == 0);
+    CHECK(stats.sh2MMIOAccesses[1] == 0);
+    CHECK(stats.eventsFired[3] == 0);
+}
+
+TEST_CASE("PerfHistory keeps the most recent frames in order", "[debug][perf]") {
+    auto history = std::make_unique<debug::PerfHistory>();
+    for (uint64 frame = 0; frame < debug::PerfHistory::kSize + 5; ++frame) {
+        history->Push({.frame = frame});
+    }
+
+    const debug::PerfStats stats = history->Snapshot();
+    REQUIRE(stats.frames.size() == debug::PerfHistory::kSize);
+    CHECK(stats.frames.front().frame == 5);
+    CHECK(stats.frames.back().frame == debug::PerfHistory::kSize + 4);
+
+    history->Clear();
+    CHECK(history->Snapshot().frames.empty());
+}
+
+TEST_CASE("Saturn collects performance counters only while enabled", "[debug][perf][saturn]") {
+    if constexpr (!debug::kPerfStatsEnabled) {
+        SKIP("Performance counters are not compiled in");
+    }
+
+    auto saturn = std::make_unique<Saturn>();
+    saturn->configuration.video.threadedVDP1 = false;
+    saturn->configuration.video.threadedVDP2 = false;
+    saturn->configuration.video.threadedDeinterlacer = false;
+    auto ipl = MakeIPL();
+    saturn->LoadIPL(ipl);
+    saturn->Reset(true);
+
+    // Nothing is collected while disabled
+    saturn->RunFrame();
+    CHECK(saturn->GetPerfStats().frames.empty());
+
+    saturn->EnablePerfStats(true);
+    REQUIRE(saturn->IsPerfStatsEnabled());
+    saturn->RunFrame();
+    saturn->RunFrame();
+
+    const debug::PerfStats stats = saturn->GetPerfStats();
+    REQUIRE(stats.frames.size() == 2);
+    for (const debug::PerfFrameStats &frame : stats.frames) {
+        CHECK(frame.sh2Instructions[0] > 0);
+        CHECK(frame.sh2Cycles[0] > 0);
+        // Instruction fetches from the IPL ROM and TVSTAT reads
+        CHECK(frame.sh2MemoryAccesses[0] > 0);
+        CHECK(frame.sh2MMIOAccesses[0] > 0);
+        // Every third instruction reads TVSTAT
+        CHECK(frame.sh2MMIOAccesses[0] * 3 + 3 >= frame.sh2Instructions[0]);
+        CHECK(frame.sh2MMIOAccesses[0] * 3 <= frame.sh2Instructions[0] + 3);
+
+        // The slave SH-2 is never started
+        CHECK(frame.sh2Instructions[1] == 0);
+        CHECK(frame.sh2MemoryAccesses[1] == 0);
+        CHECK(frame.sh2MMIOAccesses[1] == 0);
+
+        CHECK(frame.vdp2Lines > 0);
+    }
+    CHECK(stats.frames[1].frame == stats.frames[0].frame + 1);
+
+    saturn->EnablePerfStats(false);
+    REQUIRE_FALSE(saturn->IsPerfStatsEnabled());
+    saturn->RunFrame();
+    CHECK(saturn->GetPerfStats().frames.size() == 2);
+}
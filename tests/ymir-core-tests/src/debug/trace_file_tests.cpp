@@ -0,0 +1,290 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/debug/trace_file.hpp>
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Trace file tests
+
+using namespace ymir;
+
+namespace trace_file {
+
+// Number of events between frame markers
+static constexpr uint32 kFrameEvents = 1000;
+
+// Size of a chunk record header in the file format
+static constexpr uint64 kChunkHeaderSize = 33;
+
+// Stream 0 spans three chunks, stream 1 spans two and stream 2 fits in one
+static const std::array<std::string, 3> kStreamNames = {"Master SH-2", "Slave SH-2", "Extra"};
+static constexpr std::array<uint32, 3> kStreamEvents = {
+    debug::TraceFileWriter::kChunkEvents * 2 + 123,
+    debug::TraceFileWriter::kChunkEvents + 5,
+    10,
+};
+
+// Builds the events of a stream. Every kFrameEvents events start with a frame marker; frames are numbered from 1.
+static std::vector<debug::TraceEvent> MakeEvents(uint8 stream) {
+    std::vector<debug::TraceEvent> events(kStreamEvents[stream]);
+    for (uint32 i = 0; i < events.size(); ++i) {
+        debug::TraceEvent &event = events[i];
+        event.cycle = 1000 + uint64(i) * 8 * (stream + 1) + (i % 7);
+        if (i % kFrameEvents == 0) {
+            event.type = debug::TraceEventType::Frame;
+            event.data = i / kFrameEvents + 1;
+            event.ext = 0;
+            event.param = 0;
+        } else {
+            event.type = debug::TraceEventType::SH2Instruction;
+            event.data = 0x06000000 + i * 2;
+            event.ext = static_cast<uint16>(i * 0x9E37 + stream);
+            event.param = i % 5 == 0;
+        }
+    }
+    return events;
+}
+
+static uint32 FrameOf(uint32 index) {
+    return index / kFrameEvents + 1;
+}
+
+static void CheckEvent(const debug::TraceEvent &actual, const debug::TraceEvent &expected) {
+    CHECK(actual.cycle == expected.cycle);
+    CHECK(actual.data == expected.data);
+    CHECK(actual.ext == expected.ext);
+    CHECK(actual.type == expected.type);
+    CHECK(actual.param == expected.param);
+}
+
+// Reads all remaining events from the selected stream and checks them against expected[start..start+count).
+static void CheckRemaining(debug::TraceFileReader &reader, const std::vector<debug::TraceEvent> &expected,
+                           uint32 start, uint32 count) {
+    debug::TraceEvent event{};
+    uint32 index = start;
+    while (reader.Next(event)) {
+        REQUIRE(index < start + count);
+        CheckEvent(event, expected[index]);
+        CHECK(reader.CurrentFrame() == FrameOf(index));
+        ++index;
+    }
+    CHECK(index == start + count);
+}
+
+// Manages a temporary trace file path
+struct TempTraceFile {
+    explicit TempTraceFile(const char *name)
+        : path(std::filesystem::temp_directory_path() / name) {}
+
+    ~TempTraceFile() {
+        std::error_code error{};
+        std::filesystem::remove(path, error);
+    }
+
+    std::filesystem::path path;
+};
+
+// Writes all streams to the trace file, interleaving batches of different sizes across streams
+static void WriteTrace(const std::filesystem::path &path, const std::array<std::vector<debug::TraceEvent>, 3> &events) {
+    debug::TraceFileWriter writer{};
+    std::error_code error{};
+    REQUIRE(writer.Open(path, kStreamNames, error));
+    REQUIRE_FALSE(error);
+
+    std::array<size_t, 3> pos{};
+    size_t batch = 1;
+    bool done = false;
+    while (!done) {
+        done = true;
+        for (uint8 stream = 0; stream < events.size(); ++stream) {
+            const std::span<const debug::TraceEvent> remaining =
+                std::span{events[stream]}.subspan(std::min(pos[stream], events[stream].size()));
+            const size_t count = std::min(batch, remaining.size());
+            writer.Write(stream, remaining.first(count));
+            pos[stream] += count;
+            done &= pos[stream] >= events[stream].size();
+            batch = batch * 7 % 5003 + 1;
+        }
+    }
+
+    uint64 total = 0;
+    for (const auto &streamEvents : events) {
+        total += streamEvents.size();
+    }
+    CHECK(writer.EventCount() == total);
+    REQUIRE(writer.Close());
+    CHECK_FALSE(writer.IsOpen());
+}
+
+} // namespace trace_file
+
+using namespace trace_file;
+
+TEST_CASE("Trace files round-trip events across multiple chunks and streams", "[debug][trace]") {
+    const std::array<std::vector<debug::TraceEvent>, 3> events = {MakeEvents(0), MakeEvents(1), MakeEvents(2)};
+    TempTraceFile file{"ymir-trace-roundtrip.trace"};
+    WriteTrace(file.path, events);
+
+    debug::TraceFileReader reader{};
+    std::error_code error{};
+    REQUIRE(reader.Open(file.path, error));
+    REQUIRE_FALSE(error);
+    CHECK(reader.HasIndex());
+
+    const auto names = reader.GetStreamNames();
+    REQUIRE(names.size() == kStreamNames.size());
+    CHECK(std::equal(names.begin(), names.end(), kStreamNames.begin()));
+
+    // Chunks must cover every stream in full, with consistent cycle and frame ranges
+    const auto chunks = reader.GetChunks();
+    CHECK(chunks.size() == 6);
+    std::array<uint32, 3> chunkEvents{};
+    for (const debug::TraceChunkInfo &chunk : chunks) {
+        REQUIRE(chunk.stream < 3);
+        CHECK(chunk.eventCount <= debug::TraceFileWriter::kChunkEvents);
+        const uint32 first = chunkEvents[chunk.stream];
+        const uint32 last = first + chunk.eventCount - 1;
+        CHECK(chunk.firstCycle == events[chunk.stream][first].cycle);
+        CHECK(chunk.lastCycle == events[chunk.stream][last].cycle);
+        CHECK(chunk.firstFrame == FrameOf(first));
+        CHECK(chunk.lastFrame == FrameOf(last));
+        chunkEvents[chunk.stream] += chunk.eventCount;
+    }
+    CHECK(chunkEvents == kStreamEvents);
+
+    // Read the streams in reverse order to make sure stream selection doesn't depend on the previous one
+    for (int stream = 2; stream >= 0; --stream) {
+        INFO("stream " << stream);
+        REQUIRE(reader.SelectStream(stream));
+        CheckRemaining(reader, events[stream], 0, kStreamEvents[stream]);
+    }
+    CHECK_FALSE(reader.SelectStream(3));
+}
+
+TEST_CASE("Trace file readers seek to frames and cycles", "[debug][trace]") {
+    const std::array<std::vector<debug::TraceEvent>, 3> events = {MakeEvents(0), MakeEvents(1), MakeEvents(2)};
+    TempTraceFile file{"ymir-trace-seek.trace"};
+    WriteTrace(file.path, events);
+
+    debug::TraceFileReader reader{};
+    std::error_code error{};
+    REQUIRE(reader.Open(file.path, error));
+    REQUIRE(reader.SelectStream(0));
+    const auto &expected = events[0];
+    debug::TraceEvent event{};
+
+    SECTION("SeekFrame") {
+        // Frame 100 starts in the second chunk; the first event of a frame is its marker
+        const uint32 frame = 100;
+        const uint32 index = (frame - 1) * kFrameEvents;
+        REQUIRE(index > debug::TraceFileWriter::kChunkEvents);
+        REQUIRE(reader.SeekFrame(frame));
+        CHECK(reader.CurrentFrame() == frame);
+        CheckRemaining(reader, expected, index, kStreamEvents[0] - index);
+
+        // Seeking backwards works too
+        REQUIRE(reader.SeekFrame(1));
+        REQUIRE(reader.Next(event));
+        CheckEvent(event, expected[0]);
+
+        // Frame 66 straddles the boundary between the first and second chunks
+        REQUIRE(reader.SeekFrame(66));
+        CheckRemaining(reader, expected, 65 * kFrameEvents, kStreamEvents[0] - 65 * kFrameEvents);
+
+        // Past the last frame
+        CHECK_FALSE(reader.SeekFrame(FrameOf(kStreamEvents[0] - 1) + 1));
+        CHECK_FALSE(reader.Next(event));
+    }
+
+    SECTION("SeekCycle") {
+        // An exact match positions the reader at that event
+        const uint32 index = debug::TraceFileWriter::kChunkEvents * 2 + 50;
+        REQUIRE(reader.SeekCycle(expected[index].cycle));
+        CheckRemaining(reader, expected, index, kStreamEvents[0] - index);
+
+        // A cycle between two events positions the reader at the later one
+        const uint32 index2 = 12345;
+        REQUIRE(expected[index2].cycle > expected[index2 - 1].cycle + 1);
+        REQUIRE(reader.SeekCycle(expected[index2 - 1].cycle + 1));
+        REQUIRE(reader.Next(event));
+        CheckEvent(event, expected[index2]);
+        CHECK(reader.CurrentFrame() == FrameOf(index2));
+
+        // Cycles before the first event seek to the start of the stream
+        REQUIRE(reader.SeekCycle(0));
+        REQUIRE(reader.Next(event));
+        CheckEvent(event, expected[0]);
+
+        // First event of the second chunk
+        REQUIRE(reader.SeekCycle(expected[debug::TraceFileWriter::kChunkEvents - 1].cycle + 1));
+        REQUIRE(reader.Next(event));
+        CheckEvent(event, expected[debug::TraceFileWriter::kChunkEvents]);
+
+        // Past the last event
+        CHECK_FALSE(reader.SeekCycle(expected.back().cycle + 1));
+        CHECK_FALSE(reader.Next(event));
+    }
+}
+
+TEST_CASE("Trace file readers rebuild the index of truncated files", "[debug][trace]") {
+    const std::array<std::vector<debug::TraceEvent>, 3> events = {MakeEvents(0), MakeEvents(1), MakeEvents(2)};
+    TempTraceFile file{"ymir-trace-truncated.trace"};
+    WriteTrace(file.path, events);
+
+    std::vector<debug::TraceChunkInfo> chunks{};
+    {
+        debug::TraceFileReader reader{};
+        std::error_code error{};
+        REQUIRE(reader.Open(file.path, error));
+        chunks.assign(reader.GetChunks().begin(), reader.GetChunks().end());
+    }
+    REQUIRE(chunks.size() >= 2);
+
+    // Cut the file in the middle of the last chunk, dropping the index and trailer
+    const debug::TraceChunkInfo &lastChunk = chunks.back();
+    std::filesystem::resize_file(file.path, lastChunk.offset + kChunkHeaderSize + lastChunk.compressedSize / 2);
+    chunks.pop_back();
+
+    debug::TraceFileReader reader{};
+    std::error_code error{};
+    REQUIRE(reader.Open(file.path, error));
+    REQUIRE_FALSE(error);
+    CHECK_FALSE(reader.HasIndex());
+
+    // The rebuilt index contains every complete chunk
+    const auto rebuilt = reader.GetChunks();
+    REQUIRE(rebuilt.size() == chunks.size());
+    std::array<uint32, 3> chunkEvents{};
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        CHECK(rebuilt[i].offset == chunks[i].offset);
+        CHECK(rebuilt[i].compressedSize == chunks[i].compressedSize);
+        CHECK(rebuilt[i].eventCount == chunks[i].eventCount);
+        CHECK(rebuilt[i].firstCycle == chunks[i].firstCycle);
+        CHECK(rebuilt[i].lastCycle == chunks[i].lastCycle);
+        CHECK(rebuilt[i].firstFrame == chunks[i].firstFrame);
+        CHECK(rebuilt[i].lastFrame == chunks[i].lastFrame);
+        CHECK(rebuilt[i].stream == chunks[i].stream);
+        chunkEvents[chunks[i].stream] += chunks[i].eventCount;
+    }
+
+    // Every stream can be read up to the end of its last complete chunk
+    for (uint8 stream = 0; stream < 3; ++stream) {
+        INFO("stream " << static_cast<int>(stream));
+        REQUIRE(reader.SelectStream(stream));
+        CheckRemaining(reader, events[stream], 0, chunkEvents[stream]);
+    }
+
+    // Seeking works on the rebuilt index
+    REQUIRE(reader.SelectStream(0));
+    REQUIRE(reader.SeekFrame(70));
+    debug::TraceEvent event{};
+    REQUIRE(reader.Next(event));
+    CheckEvent(event, events[0][69 * kFrameEvents]);
+}
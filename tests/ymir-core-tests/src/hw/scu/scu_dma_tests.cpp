@@ -0,0 +1,186 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/hw/cart/cart_impl_dram.hpp>
+#include <ymir/state/state.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <memory>
+
+// -----------------------------------------------------------------------------
+// SCU DMA bulk transfer tests
+
+using namespace ymir;
+
+namespace scu_dma {
+
+static constexpr uint32 kSCURegs = 0x5FE'0000;
+
+// Runs SCU DMA transfers on a whole system.
+//
+// The bulk transfer path copies straight out of array-backed memory, so the reference subject remaps high WRAM through
+// handlers to force every transfer through the per-access path.
+struct TestSubject {
+    std::unique_ptr<Saturn> saturn = std::make_unique<Saturn>();
+
+    explicit TestSubject(bool bulk) {
+        saturn->configuration.video.threadedVDP1 = false;
+        saturn->configuration.video.threadedVDP2 = false;
+        saturn->configuration.video.threadedDeinterlacer = false;
+        saturn->Reset(true);
+        saturn->InsertCartridge<cart::DRAM32MbitCartridge>();
+
+        auto &wram = saturn->mem.WRAMHigh;
+        for (uint32 i = 0; i < wram.size(); ++i) {
+            wram[i] = (i * 37) ^ (i >> 8);
+        }
+
+        if (!bulk) {
+            saturn->mainBus.MapBoth(
+                0x600'0000, 0x7FF'FFFF, &saturn->mem,
+                [](uint32 address, void *ctx) -> uint8 { return Mem(ctx).WRAMHigh[address & 0xFFFFF]; },
+                [](uint32 address, void *ctx) -> uint16 {
+                    return util::ReadBE<uint16>(&Mem(ctx).WRAMHigh[address & 0xFFFFE]);
+                },
+                [](uint32 address, void *ctx) -> uint32 {
+                    return util::ReadBE<uint32>(&Mem(ctx).WRAMHigh[address & 0xFFFFC]);
+                },
+                [](uint32 address, uint8 value, void *ctx) { Mem(ctx).WRAMHigh[address & 0xFFFFF] = value; },
+                [](uint32 address, uint16 value, void *ctx) {
+                    util::WriteBE<uint16>(&Mem(ctx).WRAMHigh[address & 0xFFFFE], value);
+                },
+                [](uint32 address, uint32 value, void *ctx) {
+                    util::WriteBE<uint32>(&Mem(ctx).WRAMHigh[address & 0xFFFFC], value);
+                });
+        }
+        REQUIRE(saturn->mainBus.GetArrayBlock(0x600'0000).empty() == !bulk);
+    }
+
+    static sys::SystemMemory &Mem(void *ctx) {
+        return *static_cast<sys::SystemMemory *>(ctx);
+    }
+
+    // Fills the destination area and some bytes past its end with a known pattern
+    void FillDestination(uint32 dstAddr, uint32 size) {
+        for (uint32 offset = 0; offset < size + 0x100; offset += sizeof(uint16)) {
+            saturn->mainBus.Write<uint16>((dstAddr & ~1u) + offset, 0x5AA5 ^ offset);
+        }
+    }
+
+    // Runs an immediate level 0 DMA transfer with source increment +4, which completes synchronously
+    void Transfer(uint32 srcAddr, uint32 dstAddr, uint32 dstInc, uint32 count) {
+        auto &bus = saturn->mainBus;
+        const uint32 add = 0x100 | (dstInc == 2 ? 1 : 2);
+        bus.Write<uint32>(kSCURegs + 0x14, 0x7);     // D0MD: direct, no address updates, immediate trigger
+        bus.Write<uint32>(kSCURegs + 0x00, srcAddr); // D0R
+        bus.Write<uint32>(kSCURegs + 0x04, dstAddr); // D0W
+        bus.Write<uint32>(kSCURegs + 0x08, count);   // D0C
+        bus.Write<uint32>(kSCURegs + 0x0C, add);     // D0AD: read +4, write +2 or +4
+        bus.Write<uint32>(kSCURegs + 0x10, 0x101);   // D0EN: enable and start
+    }
+
+    std::unique_ptr<state::State> SaveState() const {
+        auto state = std::make_unique<state::State>();
+        saturn->SaveState(*state);
+        return state;
+    }
+};
+
+// Checks that the bulk and per-access transfers produced the same memory contents and DMA channel state
+static void CheckSameState(const state::State &bulk, const state::State &ref) {
+    CHECK(bulk.vdp.VRAM1 == ref.vdp.VRAM1);
+    CHECK(bulk.vdp.VRAM2 == ref.vdp.VRAM2);
+    CHECK(bulk.vdp.VDP1TimingPenalty == ref.vdp.VDP1TimingPenalty);
+    CHECK(bulk.scu.cartData == ref.scu.cartData);
+    CHECK(bulk.scu.intrStatus == ref.scu.intrStatus);
+
+    const state::SCUDMAState &b = bulk.scu.dma[0];
+    const state::SCUDMAState &r = ref.scu.dma[0];
+    CHECK(b.active == r.active);
+    CHECK(b.start == r.start);
+    CHECK(b.intrDelay == r.intrDelay);
+    CHECK(b.currSrcAddr == r.currSrcAddr);
+    CHECK(b.currDstAddr == r.currDstAddr);
+    CHECK(b.currXferCount == r.currXferCount);
+    CHECK(b.xfer.buf == r.xfer.buf);
+    CHECK(b.xfer.bufPos == r.xfer.bufPos);
+    CHECK(b.xfer.currDstAddr == r.xfer.currDstAddr);
+    CHECK(b.xfer.currDstOffset == r.xfer.currDstOffset);
+    CHECK(b.xfer.started == r.xfer.started);
+}
+
+struct TransferParams {
+    const char *name;
+    uint32 srcAddr;
+    uint32 dstAddr;
+    uint32 dstInc;
+    uint32 count;
+};
+
+} // namespace scu_dma
+
+using namespace scu_dma;
+
+TEST_CASE("SCU DMA bulk transfers match per-access transfers", "[scu][dma]") {
+    const TransferParams params = GENERATE(values<TransferParams>({
+        // A-Bus with +4 increments
+        {"WRAM to A-Bus, aligned", 0x600'1000, 0x240'0000, 4, 0x3000},
+        {"WRAM to A-Bus, unaligned source", 0x600'1003, 0x240'2000, 4, 0x2FFF},
+        {"WRAM to A-Bus, unaligned destination", 0x600'1000, 0x240'2002, 4, 0x2FFE},
+        {"WRAM to A-Bus, crossing pages", 0x600'FF04, 0x241'FF80, 4, 0x20000},
+        {"WRAM to A-Bus, short", 0x600'1000, 0x240'0000, 4, 7},
+
+        // B-Bus with +2 increments
+        {"WRAM to VDP2 VRAM, aligned", 0x600'1000, 0x5E0'0000, 2, 0x2000},
+        {"WRAM to VDP2 VRAM, unaligned source", 0x600'1002, 0x5E0'1000, 2, 0x1FFE},
+        {"WRAM to VDP2 VRAM, unaligned destination", 0x600'1000, 0x5E0'1002, 2, 0x2000},
+        {"WRAM to VDP2 VRAM, crossing pages", 0x600'FFF0, 0x5E0'FF00, 2, 0x1000},
+        {"WRAM to VDP1 VRAM, aligned", 0x600'2000, 0x5C0'0000, 2, 0x4000},
+
+        // B-Bus with +4 increments never takes the bulk path
+        {"WRAM to VDP2 VRAM, +4", 0x600'1000, 0x5E0'4000, 4, 0x800},
+    }));
+    INFO(params.name);
+
+    TestSubject bulk{true};
+    TestSubject ref{false};
+    for (TestSubject *subject : {&bulk, &ref}) {
+        REQUIRE(subject->saturn->mainBus.GetWriteBlockSize(params.dstAddr & ~3u) > 0);
+        subject->FillDestination(params.dstAddr, params.count * params.dstInc / 2);
+        subject->Transfer(params.srcAddr, params.dstAddr, params.dstInc, params.count);
+    }
+
+    const auto bulkState = bulk.SaveState();
+    const auto refState = ref.SaveState();
+    REQUIRE_FALSE(refState->scu.dma[0].active);
+    CHECK(refState->scu.dma[0].currXferCount == 0);
+    CheckSameState(*bulkState, *refState);
+}
+
+TEST_CASE("SCU DMA bulk transfers to VDP1 VRAM apply the drawing stall penalty", "[scu][dma]") {
+    const bool stall = GENERATE(false, true);
+    INFO("stall on VRAM writes: " << stall);
+
+    TestSubject bulk{true};
+    TestSubject ref{false};
+    for (TestSubject *subject : {&bulk, &ref}) {
+        subject->FillDestination(0x5C0'1000, 0x2000);
+        subject->saturn->VDP.SetStallVDP1OnVRAMWrites(stall);
+        subject->saturn->mainBus.Write<uint16>(0x5D0'0004, 0x1); // PTMR: start drawing now
+        subject->Transfer(0x600'3000, 0x5C0'1000, 2, 0x1000);
+    }
+
+    const auto bulkState = bulk.SaveState();
+    const auto refState = ref.SaveState();
+    CheckSameState(*bulkState, *refState);
+
+    // VDP1BeginFrame adds a fixed delay; the transfer writes 0x800 words to VRAM
+    if (stall) {
+        CHECK(bulkState->vdp.VDP1TimingPenalty > 1500);
+    } else {
+        CHECK(bulkState->vdp.VDP1TimingPenalty == 1500);
+    }
+}
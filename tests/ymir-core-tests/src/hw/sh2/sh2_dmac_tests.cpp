@@ -0,0 +1,220 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <ymir/hw/sh2/sh2.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// SH-2 DMAC bulk transfer tests
+
+using namespace ymir;
+
+namespace sh2_dmac {
+
+static constexpr uint32 kRAMSize = 0x10'0000;
+
+static constexpr uint32 kProgramAddress = 0x1000;
+static constexpr uint32 kISRAddress = 0x1100;
+static constexpr uint32 kStackAddress = 0x2000;
+static constexpr uint8 kDMAC0Vector = 0x50;
+
+// Number of instructions to run after starting a transfer
+static constexpr uint32 kSteps = 32;
+
+// clang-format off
+// Counts loop iterations in r0 until the transfer end interrupt is taken
+static constexpr std::array<uint16, 3> kProgram = {
+    // loop:
+    0x7001, // 1000  add #1,r0
+    0xAFFD, // 1002  bra loop
+    0x0009, // 1004  nop
+};
+
+static constexpr std::array<uint16, 2> kISR = {
+    // isr:
+    0xAFFE, // 1100  bra isr
+    0x0009, // 1102  nop
+};
+// clang-format on
+
+// Runs DMAC transfers on a standalone SH-2 with RAM at the bottom of the address space.
+//
+// The bulk transfer path copies straight out of array-backed memory, so the reference subject maps the RAM through
+// handlers to force every transfer through the per-unit path.
+struct TestSubject {
+    sys::SystemFeatures systemFeatures{};
+    core::Scheduler scheduler{};
+    sys::SH2Bus bus{};
+    sh2::SH2 sh2{scheduler, bus, true, systemFeatures};
+    sh2::SH2::Probe &probe{sh2.GetProbe()};
+
+    std::unique_ptr<std::array<uint8, kRAMSize>> ram = std::make_unique<std::array<uint8, kRAMSize>>();
+
+    explicit TestSubject(bool bulk) {
+        if (bulk) {
+            bus.MapArray(0x000'0000, kRAMSize - 1, *ram, true);
+        } else {
+            bus.MapBoth(
+                0x000'0000, kRAMSize - 1, ram->data(),
+                [](uint32 address, void *ctx) -> uint8 { return RAM(ctx)[address & (kRAMSize - 1)]; },
+                [](uint32 address, void *ctx) -> uint16 {
+                    return util::ReadBE<uint16>(&RAM(ctx)[address & (kRAMSize - 2)]);
+                },
+                [](uint32 address, void *ctx) -> uint32 {
+                    return util::ReadBE<uint32>(&RAM(ctx)[address & (kRAMSize - 4)]);
+                },
+                [](uint32 address, uint8 value, void *ctx) { RAM(ctx)[address & (kRAMSize - 1)] = value; },
+                [](uint32 address, uint16 value, void *ctx) {
+                    util::WriteBE<uint16>(&RAM(ctx)[address & (kRAMSize - 2)], value);
+                },
+                [](uint32 address, uint32 value, void *ctx) {
+                    util::WriteBE<uint32>(&RAM(ctx)[address & (kRAMSize - 4)], value);
+                });
+        }
+        REQUIRE(bus.GetArrayBlock(0x000'0000).empty() == !bulk);
+
+        for (uint32 i = 0; i < kRAMSize; ++i) {
+            (*ram)[i] = (i * 37) ^ (i >> 8);
+        }
+
+        // Power-on reset vectors and the transfer end interrupt vector
+        util::WriteBE<uint32>(&(*ram)[0x0], kProgramAddress);
+        util::WriteBE<uint32>(&(*ram)[0x4], kStackAddress);
+        util::WriteBE<uint32>(&(*ram)[kDMAC0Vector * sizeof(uint32)], kISRAddress);
+        for (uint32 i = 0; i < kProgram.size(); ++i) {
+            util::WriteBE<uint16>(&(*ram)[kProgramAddress + i * sizeof(uint16)], kProgram[i]);
+        }
+        for (uint32 i = 0; i < kISR.size(); ++i) {
+            util::WriteBE<uint16>(&(*ram)[kISRAddress + i * sizeof(uint16)], kISR[i]);
+        }
+
+        sh2.Reset(true);
+        probe.SR().ILevel = 0;
+    }
+
+    static uint8 *RAM(void *ctx) {
+        return static_cast<uint8 *>(ctx);
+    }
+
+    // Starts an auto-request transfer on channel 0 with both addresses incrementing.
+    // The transfer runs at the end of the next instruction.
+    void StartTransfer(uint32 srcAddress, uint32 dstAddress, uint32 count, uint32 xferSize, bool irqEnable) {
+        probe.MemWriteByte(0xFFFFFEE2, 0x0F, true);          // IPRA: DMAC interrupt level 15
+        probe.MemWriteLong(0xFFFFFFA0, kDMAC0Vector, true);  // VCRDMA0
+        probe.MemWriteLong(0xFFFFFF80, srcAddress, true);    // SAR0
+        probe.MemWriteLong(0xFFFFFF84, dstAddress, true);    // DAR0
+        probe.MemWriteLong(0xFFFFFF88, count, true);         // TCR0
+        probe.MemWriteLong(0xFFFFFFB0, 0x1, true);           // DMAOR: DME=1
+        const uint32 chcr = (0b01 << 14u) | (0b01 << 12u) |  // DM, SM: increment
+                            (xferSize << 10u) |              // TS
+                            (1u << 9u) |                     // AR: auto-request
+                            (irqEnable ? (1u << 2u) : 0u) |  // IE
+                            1u;                              // DE
+        probe.MemWriteLong(0xFFFFFF8C, chcr, true);          // CHCR0
+    }
+
+    uint64 Step() {
+        const uint64 cycles = sh2.Step<false, false>();
+        scheduler.Advance(cycles);
+        return cycles;
+    }
+};
+
+// State observed after each instruction
+struct StepRecord {
+    uint32 PC;
+    uint32 R0;
+    uint32 SR;
+    uint64 cycles;
+    bool xferEnded;
+
+    bool operator==(const StepRecord &) const = default;
+};
+
+static std::vector<StepRecord> RunSteps(TestSubject &subject) {
+    std::vector<StepRecord> records{};
+    for (uint32 i = 0; i < kSteps; ++i) {
+        const uint64 cycles = subject.Step();
+        records.push_back({
+            .PC = subject.probe.PC(),
+            .R0 = subject.probe.R(0),
+            .SR = subject.probe.SR().u32,
+            .cycles = cycles,
+            .xferEnded = subject.probe.DMAC0().xferEnded,
+        });
+    }
+    return records;
+}
+
+struct TransferParams {
+    const char *name;
+    uint32 srcAddress;
+    uint32 dstAddress;
+    uint32 count;    // TCR value; 16-byte transfers count longwords
+    uint32 xferSize; // CHCR.TS: 0=byte, 1=word, 2=longword, 3=16 bytes
+};
+
+} // namespace sh2_dmac
+
+using namespace sh2_dmac;
+
+TEST_CASE("SH-2 DMAC bulk transfers match per-unit transfers", "[sh2][dmac]") {
+    const TransferParams params = GENERATE(values<TransferParams>({
+        {"longwords, aligned", 0x1'0000, 0x4'0000, 0x1000, 2},
+        {"longwords, crossing pages", 0x1'FF00, 0x5'FFC0, 0x100, 2},
+        {"words, aligned", 0x1'0000, 0x4'0000, 0x2000, 1},
+        {"words, crossing pages", 0x2'FFF0, 0x7'0010, 0x800, 1},
+        {"words, unaligned to longwords", 0x1'0002, 0x4'0006, 0x7FF, 1},
+        {"16 bytes, aligned", 0x1'0000, 0x4'0000, 0x1000, 3},
+        {"16 bytes, count not a multiple of 4", 0x1'0000, 0x4'0000, 0x102, 3},
+        {"bytes", 0x1'0001, 0x4'0003, 0x1001, 0},
+        {"overlapping, destination ahead of source", 0x1'0000, 0x1'0040, 0x800, 2},
+        {"overlapping, destination behind source", 0x1'0040, 0x1'0000, 0x800, 2},
+        {"overlapping, destination ahead by one unit", 0x1'0000, 0x1'0002, 0x400, 1},
+    }));
+    const bool irqEnable = GENERATE(false, true);
+    INFO(params.name);
+    INFO("interrupt enabled: " << irqEnable);
+
+    TestSubject bulk{true};
+    TestSubject ref{false};
+
+    std::array<std::vector<StepRecord>, 2> records{};
+    for (TestSubject *subject : {&bulk, &ref}) {
+        // Let the program run for a bit before starting the transfer
+        for (uint32 i = 0; i < 5; ++i) {
+            subject->Step();
+        }
+        subject->StartTransfer(params.srcAddress, params.dstAddress, params.count, params.xferSize, irqEnable);
+    }
+    records[0] = RunSteps(bulk);
+    records[1] = RunSteps(ref);
+
+    // The transfer ends within the first instruction
+    REQUIRE(records[1][0].xferEnded);
+    CHECK(ref.probe.DMAC0().xferCount == 0);
+
+    // Instructions, cycles, transfer end flag and interrupt timing must match
+    for (uint32 i = 0; i < kSteps; ++i) {
+        CAPTURE(i);
+        CHECK(records[0][i] == records[1][i]);
+    }
+    if (irqEnable) {
+        CHECK(records[1].back().PC >= kISRAddress);
+    } else {
+        CHECK(records[1].back().PC < kISRAddress);
+    }
+
+    const auto &b = bulk.probe.DMAC0();
+    const auto &r = ref.probe.DMAC0();
+    CHECK(b.srcAddress == r.srcAddress);
+    CHECK(b.dstAddress == r.dstAddress);
+    CHECK(b.xferCount == r.xferCount);
+    CHECK(b.xferEnded == r.xferEnded);
+    CHECK(*bulk.ram == *ref.ram);
+}
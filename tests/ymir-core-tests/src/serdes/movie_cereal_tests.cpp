@@ -0,0 +1,184 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <serdes/movie_cereal.hpp>
+
+#include <ymir/sys/saturn.hpp>
+
+#include <cereal/archives/portable_binary.hpp>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// Input movie serialization tests
+
+using namespace ymir;
+
+namespace movie_cereal {
+
+static std::string Serialize(sys::InputMovie &movie) {
+    std::ostringstream out{std::ios::binary};
+    {
+        cereal::PortableBinaryOutputArchive archive{out};
+        archive(movie);
+    }
+    return out.str();
+}
+
+static sys::InputMovie Deserialize(const std::string &data) {
+    std::istringstream in{data, std::ios::binary};
+    cereal::PortableBinaryInputArchive archive{in};
+    sys::InputMovie movie{};
+    archive(movie);
+    return movie;
+}
+
+static peripheral::PeripheralReport MakeControlPadReport(peripheral::Button buttons) {
+    peripheral::PeripheralReport report{};
+    report.type = peripheral::PeripheralType::ControlPad;
+    report.report.controlPad.buttons = buttons;
+    return report;
+}
+
+static peripheral::PeripheralReport MakeAnalogPadReport(uint8 x, uint8 y) {
+    peripheral::PeripheralReport report{};
+    report.type = peripheral::PeripheralType::AnalogPad;
+    report.report.analogPad = {.buttons = peripheral::Button::Default & ~peripheral::Button::C,
+                               .analog = true,
+                               .x = x,
+                               .y = y,
+                               .l = 0x12,
+                               .r = 0xF0};
+    return report;
+}
+
+// Builds a movie with a couple of frames, events, reports and checkpoints from a real system
+static sys::InputMovie MakeMovie(Saturn &saturn) {
+    sys::InputMovie movie{};
+    movie.iplHash = MakeXXH128Hash(0x0123456789ABCDEF, 0xFEDCBA9876543210);
+    movie.discHash = MakeXXH128Hash(0x1111222233334444, 0x5555666677778888);
+    movie.rtcTimestamp = 820454400;
+    movie.peripheralTypes = {peripheral::PeripheralType::ControlPad, peripheral::PeripheralType::AnalogPad};
+    movie.checkpointInterval = 2;
+
+    for (uint64 frame = 0; frame < 5; ++frame) {
+        if (frame % movie.checkpointInterval == 0) {
+            auto state = std::make_unique<state::State>();
+            saturn.SaveState(*state);
+            movie.checkpoints.push_back({.frame = frame, .state = std::move(state)});
+        }
+
+        auto &f = movie.frames.emplace_back();
+        if (frame == 3) {
+            f.events = {sys::MovieEvent::OpenTray, sys::MovieEvent::CloseTray, sys::MovieEvent::SoftReset};
+        }
+        for (uint64 i = 0; i <= frame % 3; ++i) {
+            f.reports[0].push_back(MakeControlPadReport(peripheral::Button::Default & ~peripheral::Button::A));
+            f.reports[1].push_back(MakeAnalogPadReport(static_cast<uint8>(frame * 16), static_cast<uint8>(0x80 + i)));
+        }
+        saturn.RunFrame();
+    }
+    return movie;
+}
+
+} // namespace movie_cereal
+
+using namespace movie_cereal;
+
+TEST_CASE("Input movies round-trip through the movie file format", "[serdes][movie]") {
+    auto saturn = std::make_unique<Saturn>();
+    saturn->configuration.video.threadedVDP1 = false;
+    saturn->configuration.video.threadedVDP2 = false;
+    saturn->configuration.video.threadedDeinterlacer = false;
+    saturn->Reset(true);
+
+    sys::InputMovie movie = MakeMovie(*saturn);
+    const std::string data = Serialize(movie);
+    sys::InputMovie loaded = Deserialize(data);
+
+    CHECK(loaded.iplHash == movie.iplHash);
+    CHECK(loaded.discHash == movie.discHash);
+    CHECK(loaded.rtcTimestamp == movie.rtcTimestamp);
+    CHECK(loaded.peripheralTypes == movie.peripheralTypes);
+    CHECK(loaded.checkpointInterval == movie.checkpointInterval);
+
+    REQUIRE(loaded.frames.size() == movie.frames.size());
+    for (size_t i = 0; i < movie.frames.size(); ++i) {
+        CAPTURE(i);
+        const auto &expected = movie.frames[i];
+        const auto &actual = loaded.frames[i];
+        CHECK(actual.events == expected.events);
+        REQUIRE(actual.reports[0].size() == expected.reports[0].size());
+        REQUIRE(actual.reports[1].size() == expected.reports[1].size());
+        for (size_t j = 0; j < expected.reports[0].size(); ++j) {
+            CHECK(actual.reports[0][j].type == peripheral::PeripheralType::ControlPad);
+            CHECK(actual.reports[0][j].report.controlPad.buttons == expected.reports[0][j].report.controlPad.buttons);
+
+            const auto &analog = actual.reports[1][j].report.analogPad;
+            const auto &expectedAnalog = expected.reports[1][j].report.analogPad;
+            CHECK(actual.reports[1][j].type == peripheral::PeripheralType::AnalogPad);
+            CHECK(analog.buttons == expectedAnalog.buttons);
+            CHECK(analog.analog == expectedAnalog.analog);
+            CHECK(analog.x == expectedAnalog.x);
+            CHECK(analog.y == expectedAnalog.y);
+            CHECK(analog.l == expectedAnalog.l);
+            CHECK(analog.r == expectedAnalog.r);
+        }
+    }
+
+    REQUIRE(loaded.checkpoints.size() == movie.checkpoints.size());
+    for (size_t i = 0; i < movie.checkpoints.size(); ++i) {
+        CAPTURE(i);
+        const auto &expected = movie.checkpoints[i];
+        const auto &actual = loaded.checkpoints[i];
+        CHECK(actual.frame == expected.frame);
+        REQUIRE(actual.state != nullptr);
+        CHECK(actual.state->scheduler.currCount == expected.state->scheduler.currCount);
+        CHECK(actual.state->system.WRAMHigh == expected.state->system.WRAMHigh);
+        CHECK(actual.state->msh2.PC == expected.state->msh2.PC);
+    }
+
+    // Serializing the loaded movie must produce the exact same data, and checkpoints must be loadable
+    CHECK(Serialize(loaded) == data);
+    CHECK(saturn->LoadState(*loaded.checkpoints.back().state));
+}
+
+TEST_CASE("Malformed movie files are rejected", "[serdes][movie]") {
+    sys::InputMovie movie{};
+    movie.frames.resize(3);
+    movie.frames[1].events = {sys::MovieEvent::HardReset};
+    movie.frames[2].reports[0].push_back(MakeControlPadReport(peripheral::Button::Default));
+    const std::string data = Serialize(movie);
+    REQUIRE_NOTHROW(Deserialize(data));
+
+    // The version precedes the magic; fields are little-endian
+    const size_t magicPos = data.find("YMOV");
+    REQUIRE(magicPos != std::string::npos);
+    REQUIRE(magicPos >= sizeof(uint32));
+    std::string bad = data;
+
+    SECTION("Future version") {
+        bad[magicPos - sizeof(uint32)] = static_cast<char>(sys::kMovieVersion + 1);
+        CHECK_THROWS_AS(Deserialize(bad), cereal::Exception);
+    }
+
+    SECTION("Bad magic") {
+        bad[magicPos] = 'X';
+        CHECK_THROWS_AS(Deserialize(bad), cereal::Exception);
+    }
+
+    SECTION("Truncated file") {
+        bad.pop_back();
+        CHECK_THROWS_AS(Deserialize(bad), cereal::Exception);
+    }
+
+    SECTION("Oversized event list") {
+        // Magic, hashes, RTC timestamp, peripheral types, checkpoint interval and frame count precede the event count
+        const size_t eventCountPos = magicPos + 4 + 16 * 2 + 8 + 4 * 2 + 8 + 8;
+        REQUIRE(bad[eventCountPos + 2] == 0);
+        bad[eventCountPos + 2] = 1; // 65536 events
+        REQUIRE(sys::kMaxMovieEvents < 65536);
+        CHECK_THROWS_AS(Deserialize(bad), cereal::Exception);
+    }
+}
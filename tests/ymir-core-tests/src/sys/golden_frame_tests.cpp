@@ -0,0 +1,467 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/core/hash.hpp>
+
+#include <ymir/media/loader/loader.hpp>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Golden-frame regression harness
+//
+// Runs every scenario found in <test data>/golden/<name>/ through two Saturn instances in lockstep, one with all VDP
+// rendering threads disabled and one with all of them enabled. The framebuffer and audio output of every frame are
+// hashed with XXH128 and compared against the scenario's golden file as well as between both instances.
+//
+// Scenario directory contents:
+//   scenario.txt   key = value pairs (see Scenario below)
+//   golden.txt     one line per frame: <frame> <framebuffer hash> <audio hash>
+//   ref/           optional reference frames (frame_NNNNN.png) used to produce image diffs
+//
+// The test data directory defaults to the Ymir_TEST_DATA_DIR CMake cache variable and can be overridden at runtime
+// with the YMIR_TEST_DATA_DIR environment variable. Set YMIR_UPDATE_GOLDEN to any non-empty value to regenerate golden
+// files and reference frames from the non-threaded instance instead of checking them.
+//
+// On a mismatch, the offending frame's image and audio are written to <test output>/<scenario>/ as PNG and WAV files,
+// along with XOR delta images against the reference frame and the other instance when available.
+
+using namespace ymir;
+
+namespace golden {
+
+namespace fs = std::filesystem;
+
+struct Scenario {
+    std::string name;
+    fs::path path;
+
+    fs::path iplPath;  // ipl     = <file>; searched in the scenario directory, then in the test data directory
+    fs::path discPath; // disc    = <file>; optional
+    core::config::sys::VideoStandard videoStandard = core::config::sys::VideoStandard::NTSC; // video = ntsc|pal
+    uint64 frames = 0;       // frames      = <count>; taken from the golden file if omitted
+    uint64 refInterval = 60; // refinterval = <count>; reference frame interval when updating golden files
+};
+
+struct FrameHashes {
+    XXH128Hash video{};
+    XXH128Hash audio{};
+
+    bool operator==(const FrameHashes &) const = default;
+};
+
+static fs::path GetTestDataDir() {
+    if (const char *dir = std::getenv("YMIR_TEST_DATA_DIR"); dir != nullptr && *dir != '\0') {
+        return dir;
+    }
+    return Ymir_TEST_DATA_DIR;
+}
+
+static bool IsUpdatingGoldenFiles() {
+    const char *value = std::getenv("YMIR_UPDATE_GOLDEN");
+    return value != nullptr && *value != '\0';
+}
+
+static std::string_view Trim(std::string_view str) {
+    const auto first = str.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    const auto last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+}
+
+static std::optional<uint64> ParseUint(std::string_view str) {
+    uint64 value = 0;
+    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec != std::errc{} || ptr != str.data() + str.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+static std::optional<XXH128Hash> ParseHash(std::string_view str) {
+    XXH128Hash hash{};
+    if (str.size() != hash.size() * 2) {
+        return std::nullopt;
+    }
+    for (size_t i = 0; i < hash.size(); ++i) {
+        const char *begin = str.data() + i * 2;
+        const auto [ptr, ec] = std::from_chars(begin, begin + 2, hash[i], 16);
+        if (ec != std::errc{} || ptr != begin + 2) {
+            return std::nullopt;
+        }
+    }
+    return hash;
+}
+
+static std::optional<Scenario> LoadScenario(const fs::path &path, const fs::path &dataDir) {
+    std::ifstream in{path / "scenario.txt"};
+    if (!in) {
+        return std::nullopt;
+    }
+
+    Scenario scenario{};
+    scenario.name = path.filename().string();
+    scenario.path = path;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string_view view = Trim(line);
+        if (view.empty() || view.starts_with('#')) {
+            continue;
+        }
+        const auto sep = view.find('=');
+        if (sep == std::string_view::npos) {
+            return std::nullopt;
+        }
+        const std::string_view key = Trim(view.substr(0, sep));
+        const std::string_view value = Trim(view.substr(sep + 1));
+
+        if (key == "ipl") {
+            scenario.iplPath = fs::exists(path / value) ? path / value : dataDir / value;
+        } else if (key == "disc") {
+            scenario.discPath = path / value;
+        } else if (key == "video") {
+            if (value == "ntsc") {
+                scenario.videoStandard = core::config::sys::VideoStandard::NTSC;
+            } else if (value == "pal") {
+                scenario.videoStandard = core::config::sys::VideoStandard::PAL;
+            } else {
+                return std::nullopt;
+            }
+        } else if (key == "frames") {
+            const auto frames = ParseUint(value);
+            if (!frames) {
+                return std::nullopt;
+            }
+            scenario.frames = *frames;
+        } else if (key == "refinterval") {
+            const auto interval = ParseUint(value);
+            if (!interval) {
+                return std::nullopt;
+            }
+            scenario.refInterval = *interval;
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    if (scenario.iplPath.empty()) {
+        return std::nullopt;
+    }
+    return scenario;
+}
+
+static std::optional<std::vector<FrameHashes>> LoadGoldenFile(const fs::path &path) {
+    std::ifstream in{path};
+    if (!in) {
+        return std::nullopt;
+    }
+
+    std::vector<FrameHashes> hashes;
+    uint64 frame;
+    std::string video;
+    std::string audio;
+    while (in >> frame >> video >> audio) {
+        const auto videoHash = ParseHash(video);
+        const auto audioHash = ParseHash(audio);
+        if (frame != hashes.size() || !videoHash || !audioHash) {
+            return std::nullopt;
+        }
+        hashes.push_back({*videoHash, *audioHash});
+    }
+    return hashes;
+}
+
+static void SaveGoldenFile(const fs::path &path, const std::vector<FrameHashes> &hashes) {
+    std::ofstream out{path};
+    for (size_t frame = 0; frame < hashes.size(); ++frame) {
+        out << fmt::format("{} {} {}\n", frame, ToString(hashes[frame].video), ToString(hashes[frame].audio));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Image and audio output
+
+// Converts XRGB8888 pixels into opaque RGBA8888 pixels
+static std::vector<uint32> ToRGBA(const std::vector<uint32> &pixels) {
+    std::vector<uint32> rgba(pixels.size());
+    std::transform(pixels.begin(), pixels.end(), rgba.begin(), [](uint32 px) {
+        const uint32 r = (px >> 16u) & 0xFF;
+        const uint32 g = (px >> 8u) & 0xFF;
+        const uint32 b = (px >> 0u) & 0xFF;
+        return (0xFFu << 24u) | (b << 16u) | (g << 8u) | (r << 0u);
+    });
+    return rgba;
+}
+
+static void WritePNG(const fs::path &path, const std::vector<uint32> &rgba, uint32 width, uint32 height) {
+    fs::create_directories(path.parent_path());
+    stbi_write_png(path.string().c_str(), width, height, 4, rgba.data(), width * sizeof(uint32));
+}
+
+// Writes an image where pixels that differ between both inputs are opaque and contain the XOR of the inputs.
+// Returns false if the images are identical.
+static bool WriteDeltaPNG(const fs::path &path, const std::vector<uint32> &lhs, const std::vector<uint32> &rhs,
+                          uint32 width, uint32 height) {
+    std::vector<uint32> delta(lhs.size());
+    bool hasDelta = false;
+    for (size_t i = 0; i < delta.size(); ++i) {
+        delta[i] = (lhs[i] ^ rhs[i]) & 0xFFFFFF;
+        if (delta[i] != 0) {
+            delta[i] |= 0xFF000000;
+            hasDelta = true;
+        }
+    }
+    if (hasDelta) {
+        WritePNG(path, delta, width, height);
+    }
+    return hasDelta;
+}
+
+static void WriteWAV(const fs::path &path, const std::vector<sint16> &samples) {
+    fs::create_directories(path.parent_path());
+    std::ofstream out{path, std::ios::binary};
+
+    auto write16 = [&](uint16 value) {
+        out.put(static_cast<char>(value >> 0u));
+        out.put(static_cast<char>(value >> 8u));
+    };
+    auto write32 = [&](uint32 value) {
+        write16(value >> 0u);
+        write16(value >> 16u);
+    };
+
+    static constexpr uint32 kSampleRate = 44100;
+    static constexpr uint16 kChannels = 2;
+    const uint32 dataSize = samples.size() * sizeof(sint16);
+
+    out.write("RIFF", 4);
+    write32(36 + dataSize);
+    out.write("WAVEfmt ", 8);
+    write32(16);                                       // fmt chunk size
+    write16(1);                                        // PCM
+    write16(kChannels);                                // channels
+    write32(kSampleRate);                              // sample rate
+    write32(kSampleRate * kChannels * sizeof(sint16)); // byte rate
+    write16(kChannels * sizeof(sint16));               // block align
+    write16(16);                                       // bits per sample
+    out.write("data", 4);
+    write32(dataSize);
+    for (sint16 sample : samples) {
+        write16(static_cast<uint16>(sample));
+    }
+}
+
+static fs::path RefFramePath(const Scenario &scenario, uint64 frame) {
+    return scenario.path / "ref" / fmt::format("frame_{:05d}.png", frame);
+}
+
+// -----------------------------------------------------------------------------
+// Test subject
+
+struct Instance {
+    std::unique_ptr<Saturn> saturn = std::make_unique<Saturn>();
+
+    std::vector<uint32> framebuffer;
+    uint32 width = 0;
+    uint32 height = 0;
+    std::vector<sint16> audio; // Interleaved stereo samples output during the current frame
+
+    Instance(const Scenario &scenario, std::span<uint8, sys::kIPLSize> ipl, bool threaded) {
+        // Use a fixed virtual RTC time and avoid host-dependent disc access timing
+        saturn->configuration.rtc.mode = core::config::rtc::Mode::Virtual;
+        saturn->configuration.rtc.virtHardResetStrategy = core::config::rtc::HardResetStrategy::ResetToFixedTime;
+        saturn->configuration.cdblock.readAhead = false;
+        saturn->configuration.video.threadedVDP1 = threaded;
+        saturn->configuration.video.threadedVDP2 = threaded;
+        saturn->configuration.video.threadedDeinterlacer = threaded;
+        saturn->SetVideoStandard(scenario.videoStandard);
+
+        saturn->VDP.SetRenderCallback(util::MakeClassMemberOptionalCallback<&Instance::FrameComplete>(this));
+        saturn->SCSP.SetSampleCallback(util::MakeClassMemberOptionalCallback<&Instance::OutputSample>(this));
+
+        saturn->LoadIPL(ipl);
+        if (!scenario.discPath.empty()) {
+            media::Disc disc{};
+            const bool loaded = media::LoadDisc(scenario.discPath, disc, media::PreloadMode::Uncompressed,
+                                                [](media::MessageType type, std::string message) {
+                                                    if (type == media::MessageType::Error ||
+                                                        type == media::MessageType::NotValid) {
+                                                        UNSCOPED_INFO(message);
+                                                    }
+                                                });
+            REQUIRE(loaded);
+            saturn->LoadDisc(std::move(disc));
+        }
+        saturn->Reset(true);
+    }
+
+    FrameHashes RunFrame() {
+        audio.clear();
+        saturn->RunFrame();
+        return {
+            .video = CalcHash128(framebuffer.data(), framebuffer.size() * sizeof(uint32), (width << 16u) | height),
+            .audio = CalcHash128(audio.data(), audio.size() * sizeof(sint16)),
+        };
+    }
+
+    void FrameComplete(uint32 *fb, uint32 width, uint32 height) {
+        this->width = width;
+        this->height = height;
+        framebuffer.resize(width * height);
+        // Ignore the unused X component
+        std::transform(fb, fb + width * height, framebuffer.begin(), [](uint32 px) { return px & 0xFFFFFF; });
+    }
+
+    void OutputSample(sint16 left, sint16 right) {
+        audio.push_back(left);
+        audio.push_back(right);
+    }
+};
+
+// Dumps the frame and audio output of an instance along with image diffs against the reference frame and the other
+// instance, if available
+static void DumpMismatch(const Scenario &scenario, uint64 frame, std::string_view mode, const Instance &instance,
+                         const Instance &other) {
+    const fs::path outDir = fs::path{Ymir_TEST_OUTPUT_DIR} / scenario.name;
+    const std::string baseName = fmt::format("frame_{:05d}-{}", frame, mode);
+
+    const std::vector<uint32> rgba = ToRGBA(instance.framebuffer);
+    WritePNG(outDir / (baseName + ".png"), rgba, instance.width, instance.height);
+    WriteWAV(outDir / (baseName + ".wav"), instance.audio);
+    UNSCOPED_INFO("Wrote " << (outDir / baseName).string() << ".png/.wav");
+
+    int refWidth, refHeight, refChannels;
+    const fs::path refPath = RefFramePath(scenario, frame);
+    stbi_uc *ref = stbi_load(refPath.string().c_str(), &refWidth, &refHeight, &refChannels, 4);
+    if (ref != nullptr) {
+        if (static_cast<uint32>(refWidth) == instance.width && static_cast<uint32>(refHeight) == instance.height) {
+            const auto *refPixels = reinterpret_cast<const uint32 *>(ref);
+            const std::vector<uint32> refRGBA(refPixels, refPixels + refWidth * refHeight);
+            WriteDeltaPNG(outDir / (baseName + "-ref-delta.png"), rgba, refRGBA, instance.width, instance.height);
+        }
+        stbi_image_free(ref);
+    }
+
+    if (instance.width == other.width && instance.height == other.height) {
+        WriteDeltaPNG(outDir / (baseName + "-delta.png"), rgba, ToRGBA(other.framebuffer), instance.width,
+                      instance.height);
+    }
+}
+
+} // namespace golden
+
+// -----------------------------------------------------------------------------
+// Tests
+
+using namespace golden;
+
+TEST_CASE("Golden-frame scenarios match with threaded and non-threaded VDP", "[golden][saturn]") {
+    const fs::path dataDir = GetTestDataDir();
+    const fs::path goldenDir = dataDir / "golden";
+
+    std::vector<fs::path> scenarioPaths;
+    if (fs::is_directory(goldenDir)) {
+        for (const auto &entry : fs::directory_iterator{goldenDir}) {
+            if (entry.is_directory() && fs::exists(entry.path() / "scenario.txt")) {
+                scenarioPaths.push_back(entry.path());
+            }
+        }
+    }
+    std::sort(scenarioPaths.begin(), scenarioPaths.end());
+    if (scenarioPaths.empty()) {
+        SKIP("No golden-frame scenarios found in " << goldenDir.string());
+    }
+
+    const bool update = IsUpdatingGoldenFiles();
+
+    for (const fs::path &scenarioPath : scenarioPaths) {
+        DYNAMIC_SECTION(scenarioPath.filename().string()) {
+            const auto scenario = LoadScenario(scenarioPath, dataDir);
+            REQUIRE(scenario.has_value());
+
+            std::vector<FrameHashes> golden;
+            if (!update) {
+                auto loaded = LoadGoldenFile(scenario->path / "golden.txt");
+                REQUIRE(loaded.has_value());
+                golden = std::move(*loaded);
+            }
+            const uint64 frames = scenario->frames != 0 ? scenario->frames : golden.size();
+            REQUIRE(frames > 0);
+            REQUIRE((update || golden.size() >= frames));
+
+            std::vector<uint8> ipl(sys::kIPLSize);
+            {
+                std::ifstream in{scenario->iplPath, std::ios::binary};
+                REQUIRE(in.good());
+                in.read(reinterpret_cast<char *>(ipl.data()), ipl.size());
+            }
+            std::span<uint8, sys::kIPLSize> iplSpan{ipl.data(), sys::kIPLSize};
+
+            Instance direct{*scenario, iplSpan, false};
+            Instance threaded{*scenario, iplSpan, true};
+
+            std::vector<FrameHashes> recorded;
+            for (uint64 frame = 0; frame < frames; ++frame) {
+                const FrameHashes directHashes = direct.RunFrame();
+                const FrameHashes threadedHashes = threaded.RunFrame();
+
+                if (update) {
+                    recorded.push_back(directHashes);
+                    const bool lastFrame = frame + 1 == frames;
+                    if (lastFrame || (scenario->refInterval != 0 && frame % scenario->refInterval == 0)) {
+                        WritePNG(RefFramePath(*scenario, frame), ToRGBA(direct.framebuffer), direct.width,
+                                 direct.height);
+                    }
+                }
+
+                const FrameHashes &expected = update ? directHashes : golden[frame];
+                const bool directOK = directHashes == expected;
+                const bool threadedOK = threadedHashes == expected;
+                if (!directOK || !threadedOK) {
+                    INFO("Frame " << frame);
+                    INFO("Expected:        video " << ToString(expected.video) << "  audio "
+                                                   << ToString(expected.audio));
+                    INFO("Non-threaded VDP: video " << ToString(directHashes.video) << "  audio "
+                                                    << ToString(directHashes.audio));
+                    INFO("Threaded VDP:     video " << ToString(threadedHashes.video) << "  audio "
+                                                    << ToString(threadedHashes.audio));
+                    if (!directOK) {
+                        DumpMismatch(*scenario, frame, "direct", direct, threaded);
+                    }
+                    if (!threadedOK) {
+                        DumpMismatch(*scenario, frame, "threaded", threaded, direct);
+                    }
+                    CHECK(directOK);
+                    CHECK(threadedOK);
+                    break;
+                }
+            }
+
+            if (update) {
+                SaveGoldenFile(scenario->path / "golden.txt", recorded);
+            }
+        }
+    }
+}
@@ -0,0 +1,254 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/sys/input_movie.hpp>
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/core/hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Input movie tests
+//
+// Boots a small test program in place of the IPL ROM that reads the control pad on port 1 through SMPC INTBACK on every
+// VBlank and writes the button bits to the VDP2 back screen color, so that every frame's output depends on the inputs
+// read for that frame.
+
+using namespace ymir;
+
+namespace input_movie {
+
+// clang-format off
+inline constexpr std::array<uint16, 62> kProgram = {
+    // start:
+    0xD115, // 100  mov.l @(VRAM),r1
+    0xD216, // 102  mov.l @(BKTAU),r2
+    0xD316, // 104  mov.l @(TVMD),r3
+    0xD417, // 106  mov.l @(TVSTAT),r4
+    0xD517, // 108  mov.l @(DISP),r5
+    0xD818, // 10A  mov.l @(SMPC),r8
+    0xD918, // 10C  mov.l @(SF),r9
+    0xDA19, // 10E  mov.l @(COMREG),r10
+    0xDB19, // 110  mov.l @(OREG2),r11
+    0xE000, // 112  mov #0,r0
+    0x2201, // 114  mov.w r0,@r2
+    0x7202, // 116  add #2,r2
+    0x2201, // 118  mov.w r0,@r2
+    0x2101, // 11A  mov.w r0,@r1
+    0x2351, // 11C  mov.w r5,@r3
+    // loop:
+    0x6041, // 11E  mov.w @r4,r0
+    0xC808, // 120  tst #8,r0
+    0x89FC, // 122  bt loop
+    0xE000, // 124  mov #0x00,r0
+    0x8081, // 126  mov.b r0,@(1,r8)
+    0xE00A, // 128  mov #0x0A,r0
+    0x8083, // 12A  mov.b r0,@(3,r8)
+    0xE0F0, // 12C  mov #0xF0,r0
+    0x8085, // 12E  mov.b r0,@(5,r8)
+    0xE001, // 130  mov #1,r0
+    0x2900, // 132  mov.b r0,@r9
+    0xE010, // 134  mov #0x10,r0
+    0x2A00, // 136  mov.b r0,@r10
+    // wait_sf:
+    0x6090, // 138  mov.b @r9,r0
+    0xC801, // 13A  tst #1,r0
+    0x8BFC, // 13C  bf wait_sf
+    0x60B0, // 13E  mov.b @r11,r0
+    0x600C, // 140  extu.b r0,r0
+    0x4018, // 142  shll8 r0
+    0x6603, // 144  mov r0,r6
+    0x84B2, // 146  mov.b @(2,r11),r0
+    0x600C, // 148  extu.b r0,r0
+    0x260B, // 14A  or r0,r6
+    0x2161, // 14C  mov.w r6,@r1
+    // wait_out:
+    0x6041, // 14E  mov.w @r4,r0
+    0xC808, // 150  tst #8,r0
+    0x8BFC, // 152  bf wait_out
+    0xAFE3, // 154  bra loop
+    0x0009, // 156  nop
+    0x25E0, 0x0000, // 158  VRAM
+    0x25F8, 0x00AC, // 15C  BKTAU
+    0x25F8, 0x0000, // 160  TVMD
+    0x25F8, 0x0004, // 164  TVSTAT
+    0x0000, 0x8000, // 168  DISP
+    0x2010, 0x0000, // 16C  SMPC
+    0x2010, 0x0063, // 170  SF
+    0x2010, 0x001F, // 174  COMREG
+    0x2010, 0x0025, // 178  OREG2
+};
+// clang-format on
+
+static std::array<uint8, sys::kIPLSize> MakeIPL() {
+    std::array<uint8, sys::kIPLSize> ipl{};
+    auto write16 = [&](uint32 address, uint16 value) {
+        ipl[address + 0] = value >> 8u;
+        ipl[address + 1] = value >> 0u;
+    };
+
+    // Power-on reset vectors
+    write16(0x000, 0x2000);
+    write16(0x002, 0x0100);
+    write16(0x004, 0x0600);
+    write16(0x006, 0x4000);
+
+    for (uint32 i = 0; i < kProgram.size(); ++i) {
+        write16(0x100 + i * sizeof(uint16), kProgram[i]);
+    }
+    return ipl;
+}
+
+struct TestSubject {
+    std::unique_ptr<Saturn> saturn = std::make_unique<Saturn>();
+    sys::MoviePlayer player{*saturn};
+
+    peripheral::Button buttons = peripheral::Button::Default; // Frontend input state
+    XXH128Hash frameHash{};
+
+    TestSubject() {
+        saturn->configuration.video.threadedVDP1 = false;
+        saturn->configuration.video.threadedVDP2 = false;
+        saturn->configuration.video.threadedDeinterlacer = false;
+
+        saturn->VDP.SetRenderCallback(util::MakeClassMemberOptionalCallback<&TestSubject::FrameComplete>(this));
+
+        auto &port1 = saturn->SMPC.GetPeripheralPort1();
+        port1.SetPeripheralReportCallback(util::MakeClassMemberOptionalCallback<&TestSubject::Report>(this));
+        port1.ConnectControlPad();
+
+        auto ipl = MakeIPL();
+        saturn->LoadIPL(ipl);
+        saturn->Reset(true);
+    }
+
+    XXH128Hash RunFrame() {
+        player.RunFrame();
+        return frameHash;
+    }
+
+    void Report(peripheral::PeripheralReport &report) {
+        report.report.controlPad.buttons = buttons;
+    }
+
+    void FrameComplete(uint32 *fb, uint32 width, uint32 height) {
+        // Ignore the unused X component
+        std::vector<uint32> pixels(fb, fb + width * height);
+        std::transform(pixels.begin(), pixels.end(), pixels.begin(), [](uint32 px) { return px & 0xFFFFFF; });
+        frameHash = CalcHash128(pixels.data(), pixels.size() * sizeof(uint32), (width << 16u) | height);
+    }
+};
+
+// Button inputs pressed on the given frame while recording
+static peripheral::Button RecordedInputs(uint64 frame) {
+    static constexpr std::array<peripheral::Button, 4> kButtons = {
+        peripheral::Button::A, peripheral::Button::Start, peripheral::Button::Up | peripheral::Button::B,
+        peripheral::Button::L | peripheral::Button::R};
+    return peripheral::Button::Default & ~kButtons[(frame / 3) % kButtons.size()];
+}
+
+} // namespace input_movie
+
+using namespace input_movie;
+
+TEST_CASE("Recorded input movies play back deterministically", "[saturn][movie]") {
+    static constexpr uint64 kFrames = 60;
+    static constexpr uint64 kCheckpointInterval = 16;
+    static constexpr uint64 kResetFrame = 40;
+    static constexpr uint64 kSeekFrame = 37;
+
+    TestSubject subject{};
+
+    // Record a movie with changing inputs and a soft reset
+    std::vector<XXH128Hash> recordedHashes{};
+    subject.player.StartRecording(0, kCheckpointInterval);
+    REQUIRE(subject.player.GetMode() == sys::MoviePlayer::Mode::Recording);
+    for (uint64 frame = 0; frame < kFrames; ++frame) {
+        if (frame == kResetFrame) {
+            subject.player.Reset(false);
+        }
+        subject.buttons = RecordedInputs(frame);
+        recordedHashes.push_back(subject.RunFrame());
+    }
+    sys::InputMovie movie = subject.player.TakeMovie();
+    REQUIRE(subject.player.GetMode() == sys::MoviePlayer::Mode::Idle);
+    REQUIRE(movie.frames.size() == kFrames);
+    CHECK(movie.checkpoints.size() == (kFrames - 1) / kCheckpointInterval + 1);
+    CHECK(movie.frames[kResetFrame].events == std::vector{sys::MovieEvent::SoftReset});
+
+    // The inputs must be visible in the output for this test to be meaningful
+    std::vector<XXH128Hash> uniqueHashes = recordedHashes;
+    std::sort(uniqueHashes.begin(), uniqueHashes.end());
+    uniqueHashes.erase(std::unique(uniqueHashes.begin(), uniqueHashes.end()), uniqueHashes.end());
+    REQUIRE(uniqueHashes.size() >= 4);
+
+    // Play it back with different frontend inputs; the recorded inputs must take over
+    SECTION("Playback from power on") {
+        subject.buttons = peripheral::Button::Default;
+        REQUIRE(subject.player.StartPlayback(std::move(movie)));
+        for (uint64 frame = 0; frame < kFrames; ++frame) {
+            CAPTURE(frame);
+            REQUIRE(subject.player.GetMode() == sys::MoviePlayer::Mode::Playback);
+            CHECK(subject.RunFrame() == recordedHashes[frame]);
+        }
+        CHECK(subject.player.GetMismatchCount() == 0);
+        CHECK(subject.player.GetMode() == sys::MoviePlayer::Mode::Idle);
+    }
+
+    SECTION("Playback after seeking from a checkpoint") {
+        subject.buttons = peripheral::Button::Default;
+        REQUIRE(subject.player.StartPlayback(std::move(movie)));
+        REQUIRE(subject.player.SeekTo(kSeekFrame));
+        REQUIRE(subject.player.GetCurrentFrame() == kSeekFrame);
+        for (uint64 frame = kSeekFrame; frame < kFrames; ++frame) {
+            CAPTURE(frame);
+            CHECK(subject.RunFrame() == recordedHashes[frame]);
+        }
+        CHECK(subject.player.GetMismatchCount() == 0);
+    }
+
+    SECTION("Playback on a different IPL ROM is rejected") {
+        auto ipl = MakeIPL();
+        ipl[0x200] = 0xFF;
+        subject.saturn->LoadIPL(ipl);
+        CHECK_FALSE(subject.player.StartPlayback(std::move(movie)));
+        CHECK(subject.player.GetMode() == sys::MoviePlayer::Mode::Idle);
+    }
+}
+
+TEST_CASE("Input movie recordings cap the number of checkpoints", "[saturn][movie]") {
+    static constexpr uint64 kFrames = 50;
+    static constexpr uint64 kCheckpointInterval = 2;
+    static constexpr size_t kMaxCheckpoints = 4;
+
+    TestSubject subject{};
+
+    std::vector<XXH128Hash> recordedHashes{};
+    subject.player.StartRecording(0, kCheckpointInterval, kMaxCheckpoints);
+    for (uint64 frame = 0; frame < kFrames; ++frame) {
+        subject.buttons = RecordedInputs(frame);
+        recordedHashes.push_back(subject.RunFrame());
+        CHECK(subject.player.GetMovie().checkpoints.size() <= kMaxCheckpoints);
+    }
+    sys::InputMovie movie = subject.player.TakeMovie();
+
+    // 2 -> 4 -> 8 -> 16 frames between checkpoints; the initial checkpoint is always kept
+    CHECK(movie.checkpointInterval == 16);
+    REQUIRE(movie.checkpoints.size() == 4);
+    for (size_t i = 0; i < movie.checkpoints.size(); ++i) {
+        CHECK(movie.checkpoints[i].frame == i * movie.checkpointInterval);
+    }
+
+    // Seeking still lands on the recorded frames
+    subject.buttons = peripheral::Button::Default;
+    REQUIRE(subject.player.StartPlayback(std::move(movie)));
+    REQUIRE(subject.player.SeekTo(kFrames - 7));
+    for (uint64 frame = kFrames - 7; frame < kFrames; ++frame) {
+        CAPTURE(frame);
+        CHECK(subject.RunFrame() == recordedHashes[frame]);
+    }
+    CHECK(subject.player.GetMismatchCount() == 0);
+}
@@ -0,0 +1,479 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/core/hash.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Adaptive SH-2 synchronization quantum tests
+//
+// Runs a small test program booted in place of the IPL ROM with the adaptive SH-2 synchronization quantum enabled and
+// disabled, and checks that both produce the same frames, including across save states.
+//
+// The master SH-2 enables the display, starts or stops the slave SH-2 through SMPC, then waits for a short while after
+// every VBlank, increments a counter, writes it to the VDP2 back screen color and posts it to a mailbox in High Work
+// RAM. The delay moves the write away from scheduler event boundaries. The slave SH-2 spins on the mailbox, counting
+// iterations, and writes the iteration count to the back screen color whenever the mailbox changes. The count depends
+// on exactly when the slave observes the master's write, so any change in how the CPUs are interleaved while the slave
+// is polling shows up in the output.
+//
+// A second program checks that signals sent while the quantum is wide arrive on time. The master SH-2 waits for a short
+// while after every VBlank, which is long enough for the quantum to widen, then either writes to SINIT to wake up the
+// slave SH-2 from SLEEP or starts an immediate level 0 SCU DMA transfer, and counts up in High Work RAM. The handler of
+// the interrupt raised by the signal (FRT input capture on the slave SH-2, DMA end on the master SH-2) records the
+// count it observes, which measures how long the signal took to get through.
+
+using namespace ymir;
+
+namespace sh2_sync {
+
+inline constexpr uint8 kSSHON = 0x02;
+inline constexpr uint8 kSSHOFF = 0x03;
+
+inline constexpr uint32 kSMPCCommandIndex = (0x12A - 0x100) / sizeof(uint16);
+
+// clang-format off
+inline constexpr std::array<uint16, 68> kProgram = {
+    // start:
+    0xD118, // 100  mov.l @(BCR1),r1
+    0x6011, // 102  mov.w @r1,r0
+    0x4011, // 104  cmp/pz r0
+    0x8B21, // 106  bf slave
+    0xD117, // 108  mov.l @(VRAM),r1
+    0xD218, // 10A  mov.l @(BKTAU),r2
+    0xD318, // 10C  mov.l @(TVMD),r3
+    0xD419, // 10E  mov.l @(TVSTAT),r4
+    0xD519, // 110  mov.l @(DISP),r5
+    0xD81A, // 112  mov.l @(MAILBOX),r8
+    0xE000, // 114  mov #0,r0
+    0x2201, // 116  mov.w r0,@r2
+    0x7202, // 118  add #2,r2
+    0x2201, // 11A  mov.w r0,@r2
+    0x2101, // 11C  mov.w r0,@r1
+    0x2351, // 11E  mov.w r5,@r3
+    0x2802, // 120  mov.l r0,@r8
+    0xD917, // 122  mov.l @(SF),r9
+    0xE001, // 124  mov #1,r0
+    0x2900, // 126  mov.b r0,@r9
+    0xD916, // 128  mov.l @(COMREG),r9
+    0xE000, // 12A  mov #<SMPC command>,r0
+    0x2900, // 12C  mov.b r0,@r9
+    0xE600, // 12E  mov #0,r6
+    // loop:
+    0x6041, // 130  mov.w @r4,r0
+    0xC808, // 132  tst #8,r0
+    0x89FC, // 134  bt loop
+    0xE27F, // 136  mov #127,r2
+    // delay:
+    0x4210, // 138  dt r2
+    0x8BFD, // 13A  bf delay
+    0x7601, // 13C  add #1,r6
+    0x2161, // 13E  mov.w r6,@r1
+    0x2862, // 140  mov.l r6,@r8
+    // wait_out:
+    0x6041, // 142  mov.w @r4,r0
+    0xC808, // 144  tst #8,r0
+    0x8BFC, // 146  bf wait_out
+    0xAFF2, // 148  bra loop
+    0x0009, // 14A  nop
+    // slave:
+    0xD106, // 14C  mov.l @(VRAM),r1
+    0xD80B, // 14E  mov.l @(MAILBOX),r8
+    0xE600, // 150  mov #0,r6
+    0xE700, // 152  mov #0,r7
+    // spin:
+    0x6082, // 154  mov.l @r8,r0
+    0x3600, // 156  cmp/eq r0,r6
+    0x8DFC, // 158  bt/s spin
+    0x7701, // 15A  add #1,r7
+    0x6603, // 15C  mov r0,r6
+    0x2171, // 15E  mov.w r7,@r1
+    0xAFF8, // 160  bra spin
+    0x0009, // 162  nop
+    0xFFFF, 0xFFE0, // 164  BCR1
+    0x25E0, 0x0000, // 168  VRAM
+    0x25F8, 0x00AC, // 16C  BKTAU
+    0x25F8, 0x0000, // 170  TVMD
+    0x25F8, 0x0004, // 174  TVSTAT
+    0x0000, 0x8000, // 178  DISP
+    0x2600, 0x0000, // 17C  MAILBOX
+    0x2010, 0x0063, // 180  SF
+    0x2010, 0x001F, // 184  COMREG
+};
+// clang-format on
+
+static std::array<uint8, sys::kIPLSize> MakeIPL(uint8 smpcCommand) {
+    std::array<uint8, sys::kIPLSize> ipl{};
+    auto write16 = [&](uint32 address, uint16 value) {
+        ipl[address + 0] = value >> 8u;
+        ipl[address + 1] = value >> 0u;
+    };
+
+    // Power-on reset vectors
+    write16(0x000, 0x2000);
+    write16(0x002, 0x0100);
+    write16(0x004, 0x0600);
+    write16(0x006, 0x4000);
+
+    for (uint32 i = 0; i < kProgram.size(); ++i) {
+        write16(0x100 + i * sizeof(uint16), kProgram[i]);
+    }
+    write16(0x100 + kSMPCCommandIndex * sizeof(uint16), 0xE000 | smpcCommand);
+    return ipl;
+}
+
+inline constexpr uint8 kSignalSINIT = 0;
+inline constexpr uint8 kSignalSCUDMA = 1;
+
+inline constexpr uint32 kSignalSMPCCommandIndex = (0x224 - 0x200) / sizeof(uint16);
+inline constexpr uint32 kSignalSelectIndex = (0x238 - 0x200) / sizeof(uint16);
+
+inline constexpr uint32 kSignalSlaveISRAddress = 0x2000'0298;
+inline constexpr uint32 kSignalMasterISRAddress = 0x2000'02CC;
+
+inline constexpr uint32 kFRTICIVector = 0x60;
+inline constexpr uint32 kSCUDMA0EndVector = 0x4B;
+
+// High Work RAM offsets of the count observed by the interrupt handlers and of the time from the FRT input capture to
+// the slave SH-2 interrupt handler, in FRT ticks
+inline constexpr uint32 kSignalObservedOffset = 0x4;
+inline constexpr uint32 kSignalLatencyOffset = 0x8;
+
+// clang-format off
+inline constexpr std::array<uint16, 158> kSignalProgram = {
+    // start:
+    0xD137, // 200  mov.l @(BCR1),r1
+    0x6011, // 202  mov.w @r1,r0
+    0x4011, // 204  cmp/pz r0
+    0x8B3A, // 206  bf slave
+    0xE040, // 208  mov #0x40,r0
+    0x400E, // 20A  ldc r0,sr
+    0xD135, // 20C  mov.l @(ICR),r1
+    0xE001, // 20E  mov #1,r0
+    0x2101, // 210  mov.w r0,@r1
+    0xD335, // 212  mov.l @(TVMD),r3
+    0xD535, // 214  mov.l @(DISP),r5
+    0x2351, // 216  mov.w r5,@r3
+    0xD435, // 218  mov.l @(TVSTAT),r4
+    0xD936, // 21A  mov.l @(COUNTER),r9
+    0xD138, // 21C  mov.l @(SF),r1
+    0xE001, // 21E  mov #1,r0
+    0x2100, // 220  mov.b r0,@r1
+    0xD138, // 222  mov.l @(COMREG),r1
+    0xE000, // 224  mov #<SMPC command>,r0
+    0x2100, // 226  mov.b r0,@r1
+    // loop:
+    0x6041, // 228  mov.w @r4,r0
+    0xC808, // 22A  tst #8,r0
+    0x89FC, // 22C  bt loop
+    0xE600, // 22E  mov #0,r6
+    0x2962, // 230  mov.l r6,@r9
+    0xE27F, // 232  mov #127,r2
+    // delay:
+    0x4210, // 234  dt r2
+    0x8BFD, // 236  bf delay
+    0xE000, // 238  mov #<signal>,r0
+    0x8800, // 23A  cmp/eq #0,r0
+    0x8B03, // 23C  bf dma
+    0xD132, // 23E  mov.l @(SINIT),r1
+    0x2101, // 240  mov.w r0,@r1
+    0xA012, // 242  bra count
+    0x0009, // 244  nop
+    // dma:
+    0xD131, // 246  mov.l @(IST),r1
+    0xD031, // 248  mov.l @(IST_CLEAR),r0
+    0x2102, // 24A  mov.l r0,@r1
+    0xD131, // 24C  mov.l @(IMS),r1
+    0xD032, // 24E  mov.l @(IMS_DMA0),r0
+    0x2102, // 250  mov.l r0,@r1
+    0xD132, // 252  mov.l @(SCUREGS),r1
+    0xE007, // 254  mov #7,r0
+    0x1105, // 256  mov.l r0,@(0x14,r1)
+    0xD031, // 258  mov.l @(DMA_SRC),r0
+    0x1100, // 25A  mov.l r0,@(0x00,r1)
+    0xD031, // 25C  mov.l @(DMA_DST),r0
+    0x1101, // 25E  mov.l r0,@(0x04,r1)
+    0xD031, // 260  mov.l @(DMA_COUNT),r0
+    0x1102, // 262  mov.l r0,@(0x08,r1)
+    0xD031, // 264  mov.l @(DMA_START),r0
+    0x1103, // 266  mov.l r0,@(0x0C,r1)
+    0x1104, // 268  mov.l r0,@(0x10,r1)
+    // count:
+    0xD731, // 26A  mov.l @(COUNT),r7
+    // count_loop:
+    0x2962, // 26C  mov.l r6,@r9
+    0x7601, // 26E  add #1,r6
+    0x4710, // 270  dt r7
+    0x8BFB, // 272  bf count_loop
+    // wait_out:
+    0x6041, // 274  mov.w @r4,r0
+    0xC808, // 276  tst #8,r0
+    0x8BFC, // 278  bf wait_out
+    0xAFD5, // 27A  bra loop
+    0x0009, // 27C  nop
+    // slave:
+    0xD12D, // 27E  mov.l @(FRTREGS),r1
+    0xD22D, // 280  mov.l @(INTCREGS),r2
+    0xE060, // 282  mov #0x60,r0
+    0x8026, // 284  mov.b r0,@(6,r2)
+    0xE00A, // 286  mov #10,r0
+    0x8020, // 288  mov.b r0,@(0,r2)
+    0xE080, // 28A  mov #0x80,r0
+    0x8010, // 28C  mov.b r0,@(0,r1)
+    0xE070, // 28E  mov #0x70,r0
+    0x400E, // 290  ldc r0,sr
+    // sleep:
+    0x001B, // 292  sleep
+    0xAFFD, // 294  bra sleep
+    0x0009, // 296  nop
+    // slave_isr:
+    0xD116, // 298  mov.l @(COUNTER),r1
+    0x6012, // 29A  mov.l @r1,r0
+    0xD116, // 29C  mov.l @(OBSERVED),r1
+    0x2102, // 29E  mov.l r0,@r1
+    0xD124, // 2A0  mov.l @(FRTREGS),r1
+    0x8412, // 2A2  mov.b @(2,r1),r0
+    0x620C, // 2A4  extu.b r0,r2
+    0x4218, // 2A6  shll8 r2
+    0x8413, // 2A8  mov.b @(3,r1),r0
+    0x600C, // 2AA  extu.b r0,r0
+    0x220B, // 2AC  or r0,r2
+    0x8418, // 2AE  mov.b @(8,r1),r0
+    0x630C, // 2B0  extu.b r0,r3
+    0x4318, // 2B2  shll8 r3
+    0x8419, // 2B4  mov.b @(9,r1),r0
+    0x600C, // 2B6  extu.b r0,r0
+    0x230B, // 2B8  or r0,r3
+    0x3238, // 2BA  sub r3,r2
+    0x622D, // 2BC  extu.w r2,r2
+    0xD30F, // 2BE  mov.l @(LATENCY),r3
+    0x2322, // 2C0  mov.l r2,@r3
+    0x8411, // 2C2  mov.b @(1,r1),r0
+    0xE000, // 2C4  mov #0,r0
+    0x8011, // 2C6  mov.b r0,@(1,r1)
+    0x002B, // 2C8  rte
+    0x0009, // 2CA  nop
+    // master_isr:
+    0x2F06, // 2CC  mov.l r0,@-r15
+    0x2F16, // 2CE  mov.l r1,@-r15
+    0xD108, // 2D0  mov.l @(COUNTER),r1
+    0x6012, // 2D2  mov.l @r1,r0
+    0xD108, // 2D4  mov.l @(OBSERVED),r1
+    0x2102, // 2D6  mov.l r0,@r1
+    0x61F6, // 2D8  mov.l @r15+,r1
+    0x60F6, // 2DA  mov.l @r15+,r0
+    0x002B, // 2DC  rte
+    0x0009, // 2DE  nop
+    0xFFFF, 0xFFE0, // 2E0  BCR1
+    0xFFFF, 0xFEE0, // 2E4  ICR
+    0x25F8, 0x0000, // 2E8  TVMD
+    0x0000, 0x8000, // 2EC  DISP
+    0x25F8, 0x0004, // 2F0  TVSTAT
+    0x2600, 0x0000, // 2F4  COUNTER
+    0x2600, 0x0004, // 2F8  OBSERVED
+    0x2600, 0x0008, // 2FC  LATENCY
+    0x2010, 0x0063, // 300  SF
+    0x2010, 0x001F, // 304  COMREG
+    0x2100, 0x0000, // 308  SINIT
+    0x25FE, 0x00A4, // 30C  IST
+    0xFFFF, 0xF7FF, // 310  IST_CLEAR
+    0x25FE, 0x00A0, // 314  IMS
+    0x0000, 0xB7FF, // 318  IMS_DMA0
+    0x25FE, 0x0000, // 31C  SCUREGS
+    0x0600, 0x1000, // 320  DMA_SRC
+    0x05E0, 0x1000, // 324  DMA_DST
+    0x0000, 0x0200, // 328  DMA_COUNT
+    0x0000, 0x0101, // 32C  DMA_START
+    0x0000, 0x0400, // 330  COUNT
+    0xFFFF, 0xFE10, // 334  FRTREGS
+    0xFFFF, 0xFE60, // 338  INTCREGS
+};
+// clang-format on
+
+static std::array<uint8, sys::kIPLSize> MakeSignalIPL(uint8 smpcCommand, uint8 signal) {
+    std::array<uint8, sys::kIPLSize> ipl{};
+    auto write16 = [&](uint32 address, uint16 value) {
+        ipl[address + 0] = value >> 8u;
+        ipl[address + 1] = value >> 0u;
+    };
+    auto write32 = [&](uint32 address, uint32 value) {
+        write16(address + 0, value >> 16u);
+        write16(address + 2, value >> 0u);
+    };
+
+    // Power-on reset vectors
+    write32(0x000, 0x2000'0200);
+    write32(0x004, 0x0600'4000);
+
+    // Interrupt vectors; VBR is left at 0
+    write32(kFRTICIVector * sizeof(uint32), kSignalSlaveISRAddress);
+    write32(kSCUDMA0EndVector * sizeof(uint32), kSignalMasterISRAddress);
+
+    for (uint32 i = 0; i < kSignalProgram.size(); ++i) {
+        write16(0x200 + i * sizeof(uint16), kSignalProgram[i]);
+    }
+    write16(0x200 + kSignalSMPCCommandIndex * sizeof(uint16), 0xE000 | smpcCommand);
+    write16(0x200 + kSignalSelectIndex * sizeof(uint16), 0xE000 | signal);
+    return ipl;
+}
+
+struct TestSubject {
+    std::unique_ptr<Saturn> saturn = std::make_unique<Saturn>();
+    XXH128Hash frameHash{};
+
+    TestSubject(std::array<uint8, sys::kIPLSize> &ipl, bool adaptive) {
+        saturn->configuration.rtc.mode = core::config::rtc::Mode::Virtual;
+        saturn->configuration.rtc.virtHardResetStrategy = core::config::rtc::HardResetStrategy::ResetToFixedTime;
+        saturn->configuration.video.threadedVDP1 = false;
+        saturn->configuration.video.threadedVDP2 = false;
+        saturn->configuration.video.threadedDeinterlacer = false;
+        saturn->configuration.system.adaptiveSH2Sync = adaptive;
+
+        saturn->VDP.SetRenderCallback(util::MakeClassMemberOptionalCallback<&TestSubject::FrameComplete>(this));
+
+        saturn->LoadIPL(ipl);
+        saturn->Reset(true);
+    }
+
+    XXH128Hash RunFrame() {
+        saturn->RunFrame();
+        return frameHash;
+    }
+
+    // Runs a frame of the signal test program and returns the count observed by the interrupt handler, or
+    // kNoSignal if no signal got through.
+    uint32 RunSignalFrame() {
+        util::WriteBE<uint32>(&saturn->mem.WRAMHigh[kSignalObservedOffset], kNoSignal);
+        util::WriteBE<uint32>(&saturn->mem.WRAMHigh[kSignalLatencyOffset], kNoSignal);
+        saturn->RunFrame();
+        return util::ReadBE<uint32>(&saturn->mem.WRAMHigh[kSignalObservedOffset]);
+    }
+
+    // Returns the FRT input capture latency measured by the slave SH-2 in the last frame, or kNoSignal if it wasn't
+    // interrupted.
+    uint32 SignalLatency() const {
+        return util::ReadBE<uint32>(&saturn->mem.WRAMHigh[kSignalLatencyOffset]);
+    }
+
+    static constexpr uint32 kNoSignal = 0xFFFFFFFF;
+
+    void FrameComplete(uint32 *fb, uint32 width, uint32 height) {
+        // Ignore the unused X component
+        std::vector<uint32> pixels(fb, fb + width * height);
+        std::transform(pixels.begin(), pixels.end(), pixels.begin(), [](uint32 px) { return px & 0xFFFFFF; });
+        frameHash = CalcHash128(pixels.data(), pixels.size() * sizeof(uint32), (width << 16u) | height);
+    }
+};
+
+} // namespace sh2_sync
+
+using namespace sh2_sync;
+
+TEST_CASE("Adaptive SH-2 synchronization quantum does not change emulation results", "[saturn][sh2sync]") {
+    static constexpr uint32 kFrames = 30;
+
+    auto smpcCommand = GENERATE(kSSHON, kSSHOFF);
+    CAPTURE(smpcCommand);
+
+    auto ipl = MakeIPL(smpcCommand);
+    TestSubject adaptive{ipl, true};
+    TestSubject fixed{ipl, false};
+
+    std::vector<XXH128Hash> hashes{};
+    for (uint32 frame = 0; frame < kFrames; ++frame) {
+        CAPTURE(frame);
+        const XXH128Hash hash = fixed.RunFrame();
+        REQUIRE(adaptive.RunFrame() == hash);
+        hashes.push_back(hash);
+    }
+
+    // The program must produce a different frame every time for this test to be meaningful
+    std::sort(hashes.begin(), hashes.end());
+    CHECK(std::unique(hashes.begin(), hashes.end()) == hashes.end());
+}
+
+TEST_CASE("Adaptive SH-2 synchronization quantum is preserved by save states", "[saturn][sh2sync]") {
+    static constexpr uint32 kFramesBeforeSave = 10;
+    static constexpr uint32 kFramesAfterSave = 20;
+
+    auto smpcCommand = GENERATE(kSSHON, kSSHOFF);
+    CAPTURE(smpcCommand);
+
+    auto ipl = MakeIPL(smpcCommand);
+    TestSubject original{ipl, true};
+    TestSubject restored{ipl, true};
+
+    for (uint32 frame = 0; frame < kFramesBeforeSave; ++frame) {
+        original.RunFrame();
+    }
+
+    auto state = std::make_unique<state::State>();
+    original.saturn->SaveState(*state);
+    REQUIRE(restored.saturn->LoadState(*state));
+
+    for (uint32 frame = 0; frame < kFramesAfterSave; ++frame) {
+        CAPTURE(frame);
+        REQUIRE(restored.RunFrame() == original.RunFrame());
+    }
+}
+
+TEST_CASE("Adaptive SH-2 synchronization quantum delivers signals sent during a wide quantum on time",
+          "[saturn][sh2sync]") {
+    static constexpr uint32 kFrames = 20;
+
+    // The short quantum lets a signal through up to one quantum (32 cycles) early or late. That is up to about eight
+    // iterations of the counting loop or four FRT ticks; allow twice as much. Signals held back until the end of a wide
+    // quantum are off by several times that.
+    static constexpr uint32 kCountTolerance = 16;
+    static constexpr uint32 kLatencyTolerance = 8;
+
+    struct SignalParams {
+        const char *name;
+        uint8 smpcCommand;
+        uint8 signal;
+    };
+    const SignalParams params = GENERATE(values<SignalParams>({
+        {"SINIT write waking up the slave SH-2 from SLEEP", kSSHON, kSignalSINIT},
+        {"SCU DMA transfer started by the master SH-2", kSSHOFF, kSignalSCUDMA},
+    }));
+    INFO(params.name);
+
+    auto ipl = MakeSignalIPL(params.smpcCommand, params.signal);
+    TestSubject adaptive{ipl, true};
+    TestSubject fixed{ipl, false};
+
+    uint32 signals = 0;
+    for (uint32 frame = 0; frame < kFrames; ++frame) {
+        CAPTURE(frame);
+        const uint32 expected = fixed.RunSignalFrame();
+        const uint32 actual = adaptive.RunSignalFrame();
+        CAPTURE(expected, actual);
+        REQUIRE((expected == TestSubject::kNoSignal) == (actual == TestSubject::kNoSignal));
+        if (expected == TestSubject::kNoSignal) {
+            continue;
+        }
+        CHECK(std::max(expected, actual) - std::min(expected, actual) <= kCountTolerance);
+        ++signals;
+
+        if (params.signal == kSignalSINIT) {
+            const uint32 expectedLatency = fixed.SignalLatency();
+            const uint32 actualLatency = adaptive.SignalLatency();
+            CAPTURE(expectedLatency, actualLatency);
+            REQUIRE(expectedLatency != TestSubject::kNoSignal);
+            REQUIRE(actualLatency != TestSubject::kNoSignal);
+            CHECK(std::max(expectedLatency, actualLatency) - std::min(expectedLatency, actualLatency) <=
+                  kLatencyTolerance);
+        }
+    }
+
+    // Every frame past the first few must have sent a signal
+    CHECK(signals >= kFrames - 2);
+}
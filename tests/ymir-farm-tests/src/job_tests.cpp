@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <job.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+// -----------------------------------------------------------------------------
+// Job file parser tests
+
+namespace job_file {
+
+namespace fs = std::filesystem;
+
+// Manages a temporary directory holding a job file
+struct TempJobFile {
+    explicit TempJobFile(const char *name)
+        : dir(fs::temp_directory_path() / name)
+        , path(dir / "jobs.ini") {
+        fs::create_directories(dir);
+    }
+
+    ~TempJobFile() {
+        std::error_code error{};
+        fs::remove_all(dir, error);
+    }
+
+    void Write(const std::string &contents) const {
+        std::ofstream out{path};
+        out << contents;
+    }
+
+    fs::path dir;
+    fs::path path;
+};
+
+struct InvalidJobFile {
+    const char *name;
+    const char *contents;
+    const char *error;
+};
+
+} // namespace job_file
+
+using namespace job_file;
+
+TEST_CASE("Job files are parsed into jobs with defaults", "[farm][job]") {
+    TempJobFile file{"ymir-farm-job-parse"};
+    file.Write(R"(# Defaults
+ipl = bios/ipl.bin
+frames = 100
+hashes = true
+
+[no-disc]
+frames = 50
+screenshots = 40, 10 ,10, 0
+
+[game]
+  disc = discs/game.cue
+video = pal
+audio = yes
+hashes = false
+
+[movie]
+disc = discs/game.cue
+movie = movies/run.movie
+frames = 0
+)");
+
+    std::string error{};
+    const auto jobs = LoadJobFile(file.path, error);
+    INFO(error);
+    REQUIRE(jobs);
+    REQUIRE(jobs->size() == 3);
+
+    const Job &noDisc = (*jobs)[0];
+    CHECK(noDisc.name == "no-disc");
+    CHECK(noDisc.iplPath == file.dir / "bios/ipl.bin");
+    CHECK(noDisc.discPath.empty());
+    CHECK(noDisc.moviePath.empty());
+    CHECK(noDisc.frames == 50);
+    CHECK(noDisc.videoStandard == ymir::core::config::sys::VideoStandard::NTSC);
+    CHECK(noDisc.frameHashes);
+    CHECK_FALSE(noDisc.audioHash);
+    CHECK(noDisc.screenshots == std::vector<uint64>{0, 10, 40});
+
+    const Job &game = (*jobs)[1];
+    CHECK(game.name == "game");
+    CHECK(game.iplPath == file.dir / "bios/ipl.bin");
+    CHECK(game.discPath == file.dir / "discs/game.cue");
+    CHECK(game.frames == 100);
+    CHECK(game.videoStandard == ymir::core::config::sys::VideoStandard::PAL);
+    CHECK_FALSE(game.frameHashes);
+    CHECK(game.audioHash);
+    CHECK(game.screenshots.empty());
+
+    // Jobs with a movie may leave the frame count to the movie's length
+    const Job &movie = (*jobs)[2];
+    CHECK(movie.name == "movie");
+    CHECK(movie.moviePath == file.dir / "movies/run.movie");
+    CHECK(movie.frames == 0);
+}
+
+TEST_CASE("Invalid job files are rejected", "[farm][job]") {
+    const InvalidJobFile params = GENERATE(values<InvalidJobFile>({
+        {"missing ipl", "[a]\nframes = 1\n", "job a: missing ipl"},
+        {"missing frames", "ipl = ipl.bin\n[a]\n", "job a: missing or zero frames"},
+        {"zero frames", "ipl = ipl.bin\n[a]\nframes = 0\n", "job a: missing or zero frames"},
+        {"screenshot past the end", "ipl = ipl.bin\n[a]\nframes = 10\nscreenshots = 10\n",
+         "job a: screenshot frame 10 is past the last frame"},
+        {"unknown key", "ipl = ipl.bin\n[a]\nframes = 1\ncolor = red\n", "line 4: invalid key or value: color = red"},
+        {"invalid number", "ipl = ipl.bin\n[a]\nframes = ten\n", "line 3: invalid key or value: frames = ten"},
+        {"invalid video standard", "[a]\nvideo = secam\n", "line 2: invalid key or value: video = secam"},
+        {"invalid screenshot list", "[a]\nscreenshots = 1,,2\n", "line 2: invalid key or value: screenshots = 1,,2"},
+        {"duplicate name", "ipl = ipl.bin\nframes = 1\n[a]\n[a]\n", "line 4: duplicate job name a"},
+        {"malformed section", "[a\n", "line 1: malformed section header"},
+        {"path in job name", "[a/b]\n", "line 1: invalid job name"},
+        {"missing equals sign", "[a]\nframes 1\n", "line 2: expected key = value"},
+    }));
+    INFO(params.name);
+
+    TempJobFile file{"ymir-farm-job-invalid"};
+    file.Write(params.contents);
+
+    std::string error{};
+    CHECK_FALSE(LoadJobFile(file.path, error));
+    CHECK(error == params.error);
+}
+
+TEST_CASE("Missing job files are reported", "[farm][job]") {
+    std::string error{};
+    CHECK_FALSE(LoadJobFile(fs::temp_directory_path() / "ymir-farm-job-missing" / "jobs.ini", error));
+    CHECK(error.starts_with("could not open "));
+}
@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <thread_pool.hpp>
+
+#include <ymir/core/types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Work-stealing thread pool tests
+
+namespace thread_pool {
+
+// Spins until the condition holds or the timeout expires. Returns the last value of the condition.
+template <typename Fn>
+static bool WaitFor(Fn &&condition, std::chrono::seconds timeout = std::chrono::seconds{10}) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return condition();
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+} // namespace thread_pool
+
+using namespace thread_pool;
+
+TEST_CASE("Thread pools run every submitted task", "[farm][threadpool]") {
+    const size_t numThreads = GENERATE(0, 1, 4);
+    INFO("threads: " << numThreads);
+
+    static constexpr size_t kTasks = 1000;
+
+    WorkStealingThreadPool pool{numThreads};
+    CHECK(pool.ThreadCount() == std::max<size_t>(numThreads, 1));
+
+    std::vector<std::atomic<uint32>> runs(kTasks);
+    std::mutex threadIDsMutex{};
+    std::set<std::thread::id> threadIDs{};
+    for (size_t i = 0; i < kTasks; ++i) {
+        pool.Submit([&, i] {
+            runs[i].fetch_add(1);
+            std::unique_lock lock{threadIDsMutex};
+            threadIDs.insert(std::this_thread::get_id());
+        });
+    }
+    pool.Wait();
+
+    for (size_t i = 0; i < kTasks; ++i) {
+        CAPTURE(i);
+        CHECK(runs[i].load() == 1);
+    }
+    CHECK(threadIDs.size() <= pool.ThreadCount());
+    CHECK(threadIDs.count(std::this_thread::get_id()) == 0);
+
+    // The pool can be reused after waiting
+    std::atomic<size_t> count = 0;
+    for (size_t i = 0; i < kTasks; ++i) {
+        pool.Submit([&] { count.fetch_add(1); });
+    }
+    pool.Wait();
+    CHECK(count.load() == kTasks);
+}
+
+TEST_CASE("Thread pool workers steal tasks queued behind a blocked worker", "[farm][threadpool]") {
+    static constexpr size_t kTasks = 100;
+
+    WorkStealingThreadPool pool{2};
+
+    // Occupy one worker until every other task has run. Tasks are distributed round-robin, so half of them sit in the
+    // queue of the blocked worker and can only run if the other worker steals them.
+    std::atomic<bool> release = false;
+    std::atomic<bool> blocked = false;
+    pool.Submit([&] {
+        blocked = true;
+        WaitFor([&] { return release.load(); });
+    });
+    REQUIRE(WaitFor([&] { return blocked.load(); }));
+
+    std::atomic<size_t> count = 0;
+    for (size_t i = 0; i < kTasks; ++i) {
+        pool.Submit([&] { count.fetch_add(1); });
+    }
+    CHECK(WaitFor([&] { return count.load() == kTasks; }));
+
+    release = true;
+    pool.Wait();
+    CHECK(count.load() == kTasks);
+}
+
+TEST_CASE("Thread pools finish pending tasks on destruction", "[farm][threadpool]") {
+    static constexpr size_t kTasks = 200;
+
+    std::atomic<size_t> count = 0;
+    {
+        WorkStealingThreadPool pool{3};
+        for (size_t i = 0; i < kTasks; ++i) {
+            pool.Submit([&] {
+                std::this_thread::sleep_for(std::chrono::microseconds{50});
+                count.fetch_add(1);
+            });
+        }
+    }
+    CHECK(count.load() == kTasks);
+}